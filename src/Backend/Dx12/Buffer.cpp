@@ -550,6 +550,12 @@ namespace MMPEngine::Backend::Dx12
 
 		if (const auto tc = GetTaskContext() ; const auto entity = tc->entity)
 		{
+			if (entity->_ia.rawData == nullptr)
+			{
+				stream->Schedule(entity->_resident->CreateInitializationTask());
+				return;
+			}
+
 			stream->Schedule(entity->_upload->CreateInitializationTask());
 			stream->Schedule(entity->_resident->CreateInitializationTask());
 			stream->Schedule(Core::StreamBarrierTask::kInstance);
@@ -599,7 +605,7 @@ namespace MMPEngine::Backend::Dx12
 		Task::Run(stream);
 		if (const auto tc = GetTaskContext() ; const auto entity = tc->uploadBuffer)
 		{
-			std::memcpy((static_cast<char*>(GetMappedPtr(entity)) + static_cast<std::size_t>(entity->GetNativeGPUAddressWithRequiredOffset() - entity->GetNativeResource()->GetGPUVirtualAddress()) + tc->byteOffset), tc->src, tc->byteLength);
+			Core::UploadBuffer::Write(static_cast<char*>(GetMappedPtr(entity)) + static_cast<std::size_t>(entity->GetNativeGPUAddressWithRequiredOffset() - entity->GetNativeResource()->GetGPUVirtualAddress()), *tc);
 		}
 	}
 
@@ -615,7 +621,11 @@ namespace MMPEngine::Backend::Dx12
 	{
 		Task::OnScheduled(stream);
 
-		stream->Schedule(Core::StreamBarrierTask::kInstance);
+		if (GetTaskContext()->synchronize)
+		{
+			stream->Schedule(Core::StreamBarrierTask::kInstance);
+		}
+
 		stream->Schedule(_implTask);
 	}
 
@@ -0,0 +1,234 @@
+#ifndef MMPENGINE_DX12_COMPUTE_PRIMITIVES
+#define MMPENGINE_DX12_COMPUTE_PRIMITIVES 1
+
+#if MMPENGINE_HLSL
+
+#define MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE 256u
+#define MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE 16u
+#define MMPENGINE_COMPUTE_PRIMITIVES_MAX_GROUPS_COUNT 65535u
+#define MMPENGINE_COMPUTE_PRIMITIVES_INCLUSIVE 1u
+#define MMPENGINE_COMPUTE_PRIMITIVES_WRITE_BLOCK_SUMS 2u
+#define MMPENGINE_COMPUTE_PRIMITIVES_PAYLOAD 4u
+
+cbuffer ComputePrimitiveDataBuffer : register(b0)
+{
+	ComputePrimitiveData primitiveData;
+};
+
+RWStructuredBuffer<uint> primitiveInput : register(u0);
+RWStructuredBuffer<uint> primitiveInputPayload : register(u1);
+RWStructuredBuffer<uint> primitiveOutput : register(u2);
+RWStructuredBuffer<uint> primitiveOutputPayload : register(u3);
+RWStructuredBuffer<uint> primitiveAuxiliary : register(u4);
+
+groupshared uint primitiveShared[MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE];
+
+uint MMPEngineGetPrimitiveGroupsCount()
+{
+	return (primitiveData.count + MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE - 1u) / MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE;
+}
+
+uint MMPEngineGetRadixDigit(uint key)
+{
+	return (key >> primitiveData.shift) & (MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE - 1u);
+}
+
+uint MMPEngineScanGroupInclusive(uint value, uint t)
+{
+	primitiveShared[t] = value;
+	GroupMemoryBarrierWithGroupSync();
+
+	for (uint offset = 1u; offset < MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE; offset <<= 1)
+	{
+		const uint addend = t >= offset ? primitiveShared[t - offset] : 0u;
+		GroupMemoryBarrierWithGroupSync();
+		primitiveShared[t] += addend;
+		GroupMemoryBarrierWithGroupSync();
+	}
+
+	return primitiveShared[t];
+}
+
+uint MMPEngineGetRadixRank(uint digit, uint t)
+{
+	const uint word = digit >> 2;
+	const uint shift = (digit & 3u) << 3;
+	uint rank = 0u;
+
+	for (uint w = 0u; w < MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE / 4u; ++w)
+	{
+		const uint packed = w == word ? 1u << shift : 0u;
+		const uint exclusive = MMPEngineScanGroupInclusive(packed, t) - packed;
+		rank = w == word ? (exclusive >> shift) & 0xFFu : rank;
+	}
+
+	return rank;
+}
+
+[numthreads(MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE, 1, 1)]
+void MMPEngineClearCS(uint3 id : SV_DispatchThreadID)
+{
+	const uint i = id.x;
+
+	if (i < primitiveData.count)
+	{
+		primitiveOutput[i] = 0u;
+	}
+}
+
+[numthreads(MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE, 1, 1)]
+void MMPEngineScanBlocksCS(uint3 id : SV_DispatchThreadID, uint3 groupId : SV_GroupID, uint t : SV_GroupIndex)
+{
+	const uint i = id.x;
+	const uint value = i < primitiveData.count ? primitiveInput[i] : 0u;
+	const uint inclusive = MMPEngineScanGroupInclusive(value, t);
+
+	if (i < primitiveData.count)
+	{
+		primitiveOutput[i] = (primitiveData.flags & MMPENGINE_COMPUTE_PRIMITIVES_INCLUSIVE) != 0u ? inclusive : inclusive - value;
+	}
+
+	if ((primitiveData.flags & MMPENGINE_COMPUTE_PRIMITIVES_WRITE_BLOCK_SUMS) != 0u && t == MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE - 1u)
+	{
+		primitiveAuxiliary[groupId.x] = inclusive;
+	}
+}
+
+[numthreads(MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE, 1, 1)]
+void MMPEngineAddBlockOffsetsCS(uint3 id : SV_DispatchThreadID, uint3 groupId : SV_GroupID)
+{
+	const uint i = id.x;
+
+	if (i < primitiveData.count)
+	{
+		primitiveOutput[i] += primitiveAuxiliary[groupId.x];
+	}
+}
+
+[numthreads(MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE, 1, 1)]
+void MMPEngineCompactScatterCS(uint3 id : SV_DispatchThreadID)
+{
+	const uint i = id.x;
+
+	if (i < primitiveData.count)
+	{
+		const bool selected = primitiveInputPayload[i] != 0u;
+
+		if (selected)
+		{
+			primitiveOutput[primitiveAuxiliary[i]] = primitiveInput[i];
+		}
+
+		if (i == primitiveData.count - 1u)
+		{
+			primitiveOutputPayload[0] = primitiveAuxiliary[i] + (selected ? 1u : 0u);
+		}
+	}
+}
+
+[numthreads(MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE, 1, 1)]
+void MMPEngineRadixCountCS(uint3 id : SV_DispatchThreadID, uint3 groupId : SV_GroupID, uint t : SV_GroupIndex)
+{
+	const uint i = id.x;
+
+	if (t < MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE)
+	{
+		primitiveShared[t] = 0u;
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	if (i < primitiveData.count)
+	{
+		InterlockedAdd(primitiveShared[MMPEngineGetRadixDigit(primitiveInput[i])], 1u);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	if (t < MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE)
+	{
+		primitiveAuxiliary[t * MMPEngineGetPrimitiveGroupsCount() + groupId.x] = primitiveShared[t];
+	}
+}
+
+[numthreads(MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE, 1, 1)]
+void MMPEngineRadixScatterCS(uint3 id : SV_DispatchThreadID, uint3 groupId : SV_GroupID, uint t : SV_GroupIndex)
+{
+	const uint i = id.x;
+	const uint digit = i < primitiveData.count ? MMPEngineGetRadixDigit(primitiveInput[i]) : MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE;
+	const uint rank = MMPEngineGetRadixRank(digit, t);
+
+	if (i < primitiveData.count)
+	{
+		const uint dst = primitiveAuxiliary[digit * MMPEngineGetPrimitiveGroupsCount() + groupId.x] + rank;
+		primitiveOutput[dst] = primitiveInput[i];
+
+		if ((primitiveData.flags & MMPENGINE_COMPUTE_PRIMITIVES_PAYLOAD) != 0u)
+		{
+			primitiveOutputPayload[dst] = primitiveInputPayload[i];
+		}
+	}
+}
+
+[numthreads(MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE, 1, 1)]
+void MMPEngineSegmentedReduceCS(uint3 groupId : SV_GroupID, uint t : SV_GroupIndex)
+{
+	for (uint segment = groupId.x; segment < primitiveData.count; segment += MMPENGINE_COMPUTE_PRIMITIVES_MAX_GROUPS_COUNT)
+	{
+		const uint end = primitiveAuxiliary[segment + 1u];
+		uint sum = 0u;
+
+		for (uint j = primitiveAuxiliary[segment] + t; j < end; j += MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE)
+		{
+			sum += primitiveInput[j];
+		}
+
+		GroupMemoryBarrierWithGroupSync();
+		primitiveShared[t] = sum;
+		GroupMemoryBarrierWithGroupSync();
+
+		for (uint stride = MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE >> 1; stride > 0u; stride >>= 1)
+		{
+			if (t < stride)
+			{
+				primitiveShared[t] += primitiveShared[t + stride];
+			}
+
+			GroupMemoryBarrierWithGroupSync();
+		}
+
+		if (t == 0u)
+		{
+			primitiveOutput[segment] = primitiveShared[0];
+		}
+	}
+}
+
+[numthreads(MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE, 1, 1)]
+void MMPEngineHistogramCS(uint3 id : SV_DispatchThreadID, uint t : SV_GroupIndex)
+{
+	const uint i = id.x;
+
+	if (t < primitiveData.binsCount)
+	{
+		primitiveShared[t] = 0u;
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	if (i < primitiveData.count)
+	{
+		InterlockedAdd(primitiveShared[min(primitiveInput[i] >> primitiveData.shift, primitiveData.binsCount - 1u)], 1u);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	if (t < primitiveData.binsCount && primitiveShared[t] != 0u)
+	{
+		InterlockedAdd(primitiveOutput[t], primitiveShared[t]);
+	}
+}
+
+#endif
+
+#endif
@@ -480,8 +480,8 @@ namespace MMPEngine::Backend::Dx12
 				this->_specificStreamContext->PopulateCommandsInBuffer()->DrawIndexedInstanced(
 					ss.indexCount,
 					static_cast<std::uint32_t>(ctx->renderer->GetSettings().dynamicData.instancesCount),
-					ss.indexStart,
-					ss.baseVertex,
+					ss.indexStart + ctx->renderer->GetIndexStart(),
+					static_cast<std::int32_t>(ss.baseVertex + ctx->renderer->GetBaseVertex()),
 					0
 				);
 			}
@@ -12,8 +12,7 @@ namespace MMPEngine::Backend::Dx12
 	DeviceMemoryHeap::Handle DeviceMemoryHeap::Allocate(const Request& request)
 	{
 		const auto entry = AllocateEntry(request);
-		const auto block = dynamic_cast<Block*>(_blocks[entry.blockIndex].get());
-		return { shared_from_this(), entry, block->GetEntityBlock() };
+		return { shared_from_this(), entry, std::dynamic_pointer_cast<DeviceMemoryBlock>(GetBlockEntity(entry.blockIndex)) };
 	}
 
 	std::unique_ptr<Core::Heap::Block> DeviceMemoryHeap::InstantiateBlock(std::size_t size)
@@ -108,7 +107,6 @@ namespace MMPEngine::Backend::Dx12
 	ConstantBufferHeap::Handle ConstantBufferHeap::Allocate(const Request& request)
 	{
 		const auto entry = AllocateEntry(request);
-		const auto block = dynamic_cast<Block*>(_blocks[entry.blockIndex].get());
-		return { shared_from_this(), entry, block->GetUploadBuffer()};
+		return { shared_from_this(), entry, std::dynamic_pointer_cast<UploadBuffer>(GetBlockEntity(entry.blockIndex)) };
 	}
 }
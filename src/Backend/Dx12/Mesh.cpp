@@ -1,10 +1,11 @@
+#include <algorithm>
 #include <cassert>
 #include <Backend/Dx12/Mesh.hpp>
 #include <Backend/Dx12/Buffer.hpp>
 
 namespace MMPEngine::Backend::Dx12
 {
-	Mesh::Mesh(Core::GeometryPrototype&& proto) : Core::Mesh(std::move(proto))
+	Mesh::Mesh(Core::GeometryPrototype&& proto, const Settings& settings) : Core::Mesh(std::move(proto), settings)
 	{
 	}
 
@@ -13,7 +14,7 @@ namespace MMPEngine::Backend::Dx12
 		return Core::BaseTask::kEmpty;
 	}
 
-	std::shared_ptr<Core::VertexBuffer> Mesh::CreateVertexBuffer(const Core::VertexBufferPrototype* vbPrototype)
+	std::shared_ptr<Core::VertexBuffer> Mesh::CreateVertexBuffer(const Core::BaseGeometryBufferPrototype* vbPrototype)
 	{
 		return std::make_shared<VertexBuffer>(Core::InputAssemblerBuffer::Settings {
 		{vbPrototype->GetDataPtr()}, {vbPrototype->GetByteLength()}
@@ -66,6 +67,24 @@ namespace MMPEngine::Backend::Dx12
 			return DXGI_FORMAT_R32G32B32A32_FLOAT;
 		case Core::VertexBufferPrototype::Format::Uint4:
 			return DXGI_FORMAT_R32G32B32A32_UINT;
+		case Core::VertexBufferPrototype::Format::Half2:
+			return DXGI_FORMAT_R16G16_FLOAT;
+		case Core::VertexBufferPrototype::Format::Half4:
+			return DXGI_FORMAT_R16G16B16A16_FLOAT;
+		case Core::VertexBufferPrototype::Format::Snorm8x4:
+			return DXGI_FORMAT_R8G8B8A8_SNORM;
+		case Core::VertexBufferPrototype::Format::Unorm8x4:
+			return DXGI_FORMAT_R8G8B8A8_UNORM;
+		case Core::VertexBufferPrototype::Format::Snorm16x2:
+			return DXGI_FORMAT_R16G16_SNORM;
+		case Core::VertexBufferPrototype::Format::Snorm16x4:
+			return DXGI_FORMAT_R16G16B16A16_SNORM;
+		case Core::VertexBufferPrototype::Format::Unorm16x2:
+			return DXGI_FORMAT_R16G16_UNORM;
+		case Core::VertexBufferPrototype::Format::Unorm16x4:
+			return DXGI_FORMAT_R16G16B16A16_UNORM;
+		case Core::VertexBufferPrototype::Format::Unorm10_10_10_2:
+			return DXGI_FORMAT_R10G10B10A2_UNORM;
 		default:
 			throw Core::UnsupportedException("unsupported dx12 vertex buffer format");
 		}
@@ -114,6 +133,11 @@ namespace MMPEngine::Backend::Dx12
 		const auto renderer = GetTaskContext()->renderer;
 		assert(renderer);
 
+		if (renderer->GetSettings().staticData.indirect.has_value())
+		{
+			throw Core::UnsupportedException("indirect mesh rendering is not supported by dx12 backend");
+		}
+
 		const auto& ibInfo = renderer->GetMesh()->GetIndexBufferInfo();
 		const auto ib = std::dynamic_pointer_cast<ResourceEntity>(ibInfo.ptr->GetUnderlyingBuffer());
 		assert(ib);
@@ -127,24 +151,27 @@ namespace MMPEngine::Backend::Dx12
 		renderer->_vertexInputLayout.clear();
 		renderer->_vertexBuffers.clear();
 
-		std::uint32_t currentBufferSlotIndex = 0;
-
-		renderer->ForEachAvailableVertexAttributes([&currentBufferSlotIndex, &renderer](const auto& vbInfo, const auto& attr)
+		renderer->ForEachAvailableVertexAttributes([&renderer](const auto& vbInfo, const auto& attr)
 		{
 				const auto vb = std::dynamic_pointer_cast<ResourceEntity>(vbInfo.ptr->GetUnderlyingBuffer());
 				assert(vb);
 
-				D3D12_VERTEX_BUFFER_VIEW view{};
+				const auto existing = std::find(renderer->_vertexBuffers.cbegin(), renderer->_vertexBuffers.cend(), vb);
+				const auto slotIndex = static_cast<std::uint32_t>(std::distance(renderer->_vertexBuffers.cbegin(), existing));
 
-				view.SizeInBytes = static_cast<std::uint32_t>(vbInfo.stride * vbInfo.elementsCount);
-				view.StrideInBytes = static_cast<std::uint32_t>(vbInfo.stride);
-				view.BufferLocation = vb->GetNativeGPUAddressWithRequiredOffset();
+				if (existing == renderer->_vertexBuffers.cend())
+				{
+					D3D12_VERTEX_BUFFER_VIEW view{};
 
-				renderer->_vertexBufferViews.push_back(view);
-				renderer->_vertexInputLayout.push_back({ GetSemanticsName(attr.type), static_cast<std::uint32_t>(attr.index), GetVertexBufferFormat(vbInfo.format), currentBufferSlotIndex, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 });
-				renderer->_vertexBuffers.push_back(vb);
+					view.SizeInBytes = static_cast<std::uint32_t>(vbInfo.stride * vbInfo.elementsCount);
+					view.StrideInBytes = static_cast<std::uint32_t>(vbInfo.stride);
+					view.BufferLocation = vb->GetNativeGPUAddressWithRequiredOffset();
 
-				++currentBufferSlotIndex;
+					renderer->_vertexBufferViews.push_back(view);
+					renderer->_vertexBuffers.push_back(vb);
+				}
+
+				renderer->_vertexInputLayout.push_back({ GetSemanticsName(attr.type), static_cast<std::uint32_t>(attr.index), GetVertexBufferFormat(vbInfo.format), slotIndex, static_cast<std::uint32_t>(vbInfo.offset), D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 });
 		});
 	}
 
@@ -157,4 +184,9 @@ namespace MMPEngine::Backend::Dx12
 	{
 		return std::make_shared<UniformBuffer<Core::Mesh::Renderer::Data>>();
 	}
+
+	std::shared_ptr<Core::UniformBuffer<Core::Mesh::Renderer::AffineData>> Mesh::Renderer::CreateAffineUniformBuffer()
+	{
+		return std::make_shared<UniformBuffer<Core::Mesh::Renderer::AffineData>>();
+	}
 }
@@ -10,7 +10,7 @@ namespace MMPEngine::Backend::Dx12
 	class Mesh final : public Core::Mesh
 	{
 	public:
-		Mesh(Core::GeometryPrototype&& proto);
+		Mesh(Core::GeometryPrototype&& proto, const Settings& settings);
 
 		class Renderer final : public Core::Mesh::Renderer
 		{
@@ -26,6 +26,7 @@ namespace MMPEngine::Backend::Dx12
 
 		protected:
 			std::shared_ptr<Core::UniformBuffer<Data>> CreateUniformBuffer() override;
+			std::shared_ptr<Core::UniformBuffer<AffineData>> CreateAffineUniformBuffer() override;
 			std::shared_ptr<Core::BaseTask> CreateInternalInitializationTask() override;
 		private:
 
@@ -56,7 +57,7 @@ namespace MMPEngine::Backend::Dx12
 
 	protected:
 		std::shared_ptr<Core::BaseTask> CreateInternalInitializationTask() override;
-		std::shared_ptr<Core::VertexBuffer> CreateVertexBuffer(const Core::VertexBufferPrototype* vbPrototype) override;
+		std::shared_ptr<Core::VertexBuffer> CreateVertexBuffer(const Core::BaseGeometryBufferPrototype* vbPrototype) override;
 		std::shared_ptr<Core::IndexBuffer> CreateIndexBuffer(const Core::IndexBufferPrototype* ibPrototype) override;
 	};
 }
@@ -113,7 +113,7 @@ namespace MMPEngine::Backend::Metal
         Task::Run(stream);
         if (const auto tc = GetTaskContext(); const auto entity = tc->uploadBuffer)
         {
-            std::memcpy(static_cast<char*>(entity->_nativeBuffer->contents()) + tc->byteOffset, tc->src, tc->byteLength);
+            Core::UploadBuffer::Write(entity->_nativeBuffer->contents(), *tc);
         }
     }
 
@@ -174,7 +174,11 @@ namespace MMPEngine::Backend::Metal
     {
         Task::OnScheduled(stream);
 
-        stream->Schedule(Core::StreamBarrierTask::kInstance);
+        if (GetTaskContext()->synchronize)
+        {
+            stream->Schedule(Core::StreamBarrierTask::kInstance);
+        }
+
         stream->Schedule(_implTask);
     }
 
@@ -326,6 +330,12 @@ namespace MMPEngine::Backend::Metal
 
         if (const auto tc = GetTaskContext() ; const auto entity = tc->entity)
         {
+            if (entity->_ia.rawData == nullptr)
+            {
+                stream->Schedule(entity->_resident->CreateInitializationTask());
+                return;
+            }
+
             stream->Schedule(entity->_upload->CreateInitializationTask());
             stream->Schedule(entity->_resident->CreateInitializationTask());
             stream->Schedule(Core::StreamBarrierTask::kInstance);
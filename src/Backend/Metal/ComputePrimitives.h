@@ -0,0 +1,227 @@
+#ifndef MMPENGINE_METAL_COMPUTE_PRIMITIVES
+#define MMPENGINE_METAL_COMPUTE_PRIMITIVES 1
+
+#if MMPENGINE_MSL
+
+#define MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE 256u
+#define MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE 16u
+#define MMPENGINE_COMPUTE_PRIMITIVES_MAX_GROUPS_COUNT 65535u
+#define MMPENGINE_COMPUTE_PRIMITIVES_INCLUSIVE 1u
+#define MMPENGINE_COMPUTE_PRIMITIVES_WRITE_BLOCK_SUMS 2u
+#define MMPENGINE_COMPUTE_PRIMITIVES_PAYLOAD 4u
+
+#define MMPENGINE_COMPUTE_PRIMITIVES_ARGUMENTS \
+    constant ComputePrimitiveData& primitiveData [[buffer(0)]], \
+    device uint* primitiveInput [[buffer(1)]], \
+    device uint* primitiveInputPayload [[buffer(2)]], \
+    device uint* primitiveOutput [[buffer(3)]], \
+    device uint* primitiveOutputPayload [[buffer(4)]], \
+    device uint* primitiveAuxiliary [[buffer(5)]], \
+    uint i [[thread_position_in_grid]], \
+    uint group [[threadgroup_position_in_grid]], \
+    uint t [[thread_index_in_threadgroup]]
+
+uint MMPEngineGetPrimitiveGroupsCount(constant ComputePrimitiveData& primitiveData)
+{
+    return (primitiveData.count + MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE - 1u) / MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE;
+}
+
+uint MMPEngineGetRadixDigit(constant ComputePrimitiveData& primitiveData, uint key)
+{
+    return (key >> primitiveData.shift) & (MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE - 1u);
+}
+
+uint MMPEngineScanGroupInclusive(threadgroup uint* primitiveShared, uint value, uint t)
+{
+    primitiveShared[t] = value;
+    threadgroup_barrier(mem_flags::mem_threadgroup);
+
+    for (uint offset = 1u; offset < MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE; offset <<= 1)
+    {
+        const uint addend = t >= offset ? primitiveShared[t - offset] : 0u;
+        threadgroup_barrier(mem_flags::mem_threadgroup);
+        primitiveShared[t] += addend;
+        threadgroup_barrier(mem_flags::mem_threadgroup);
+    }
+
+    return primitiveShared[t];
+}
+
+uint MMPEngineGetRadixRank(threadgroup uint* primitiveShared, uint digit, uint t)
+{
+    const uint word = digit >> 2;
+    const uint shift = (digit & 3u) << 3;
+    uint rank = 0u;
+
+    for (uint w = 0u; w < MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE / 4u; ++w)
+    {
+        const uint packed = w == word ? 1u << shift : 0u;
+        const uint exclusive = MMPEngineScanGroupInclusive(primitiveShared, packed, t) - packed;
+        rank = w == word ? (exclusive >> shift) & 0xFFu : rank;
+    }
+
+    return rank;
+}
+
+kernel void MMPEngineClearCS(MMPENGINE_COMPUTE_PRIMITIVES_ARGUMENTS)
+{
+    if (i < primitiveData.count)
+    {
+        primitiveOutput[i] = 0u;
+    }
+}
+
+kernel void MMPEngineScanBlocksCS(MMPENGINE_COMPUTE_PRIMITIVES_ARGUMENTS)
+{
+    threadgroup uint primitiveShared[MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE];
+
+    const uint value = i < primitiveData.count ? primitiveInput[i] : 0u;
+    const uint inclusive = MMPEngineScanGroupInclusive(primitiveShared, value, t);
+
+    if (i < primitiveData.count)
+    {
+        primitiveOutput[i] = (primitiveData.flags & MMPENGINE_COMPUTE_PRIMITIVES_INCLUSIVE) != 0u ? inclusive : inclusive - value;
+    }
+
+    if ((primitiveData.flags & MMPENGINE_COMPUTE_PRIMITIVES_WRITE_BLOCK_SUMS) != 0u && t == MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE - 1u)
+    {
+        primitiveAuxiliary[group] = inclusive;
+    }
+}
+
+kernel void MMPEngineAddBlockOffsetsCS(MMPENGINE_COMPUTE_PRIMITIVES_ARGUMENTS)
+{
+    if (i < primitiveData.count)
+    {
+        primitiveOutput[i] += primitiveAuxiliary[group];
+    }
+}
+
+kernel void MMPEngineCompactScatterCS(MMPENGINE_COMPUTE_PRIMITIVES_ARGUMENTS)
+{
+    if (i < primitiveData.count)
+    {
+        const bool selected = primitiveInputPayload[i] != 0u;
+
+        if (selected)
+        {
+            primitiveOutput[primitiveAuxiliary[i]] = primitiveInput[i];
+        }
+
+        if (i == primitiveData.count - 1u)
+        {
+            primitiveOutputPayload[0] = primitiveAuxiliary[i] + (selected ? 1u : 0u);
+        }
+    }
+}
+
+kernel void MMPEngineRadixCountCS(MMPENGINE_COMPUTE_PRIMITIVES_ARGUMENTS)
+{
+    threadgroup atomic_uint counters[MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE];
+
+    if (t < MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE)
+    {
+        atomic_store_explicit(&counters[t], 0u, memory_order_relaxed);
+    }
+
+    threadgroup_barrier(mem_flags::mem_threadgroup);
+
+    if (i < primitiveData.count)
+    {
+        atomic_fetch_add_explicit(&counters[MMPEngineGetRadixDigit(primitiveData, primitiveInput[i])], 1u, memory_order_relaxed);
+    }
+
+    threadgroup_barrier(mem_flags::mem_threadgroup);
+
+    if (t < MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE)
+    {
+        primitiveAuxiliary[t * MMPEngineGetPrimitiveGroupsCount(primitiveData) + group] = atomic_load_explicit(&counters[t], memory_order_relaxed);
+    }
+}
+
+kernel void MMPEngineRadixScatterCS(MMPENGINE_COMPUTE_PRIMITIVES_ARGUMENTS)
+{
+    threadgroup uint primitiveShared[MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE];
+
+    const uint digit = i < primitiveData.count ? MMPEngineGetRadixDigit(primitiveData, primitiveInput[i]) : MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE;
+    const uint rank = MMPEngineGetRadixRank(primitiveShared, digit, t);
+
+    if (i < primitiveData.count)
+    {
+        const uint dst = primitiveAuxiliary[digit * MMPEngineGetPrimitiveGroupsCount(primitiveData) + group] + rank;
+        primitiveOutput[dst] = primitiveInput[i];
+
+        if ((primitiveData.flags & MMPENGINE_COMPUTE_PRIMITIVES_PAYLOAD) != 0u)
+        {
+            primitiveOutputPayload[dst] = primitiveInputPayload[i];
+        }
+    }
+}
+
+kernel void MMPEngineSegmentedReduceCS(MMPENGINE_COMPUTE_PRIMITIVES_ARGUMENTS)
+{
+    threadgroup uint primitiveShared[MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE];
+
+    for (uint segment = group; segment < primitiveData.count; segment += MMPENGINE_COMPUTE_PRIMITIVES_MAX_GROUPS_COUNT)
+    {
+        const uint end = primitiveAuxiliary[segment + 1u];
+        uint sum = 0u;
+
+        for (uint j = primitiveAuxiliary[segment] + t; j < end; j += MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE)
+        {
+            sum += primitiveInput[j];
+        }
+
+        threadgroup_barrier(mem_flags::mem_threadgroup);
+        primitiveShared[t] = sum;
+        threadgroup_barrier(mem_flags::mem_threadgroup);
+
+        for (uint stride = MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE >> 1; stride > 0u; stride >>= 1)
+        {
+            if (t < stride)
+            {
+                primitiveShared[t] += primitiveShared[t + stride];
+            }
+
+            threadgroup_barrier(mem_flags::mem_threadgroup);
+        }
+
+        if (t == 0u)
+        {
+            primitiveOutput[segment] = primitiveShared[0];
+        }
+    }
+}
+
+kernel void MMPEngineHistogramCS(MMPENGINE_COMPUTE_PRIMITIVES_ARGUMENTS)
+{
+    threadgroup atomic_uint counters[MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE];
+
+    if (t < primitiveData.binsCount)
+    {
+        atomic_store_explicit(&counters[t], 0u, memory_order_relaxed);
+    }
+
+    threadgroup_barrier(mem_flags::mem_threadgroup);
+
+    if (i < primitiveData.count)
+    {
+        atomic_fetch_add_explicit(&counters[min(primitiveInput[i] >> primitiveData.shift, primitiveData.binsCount - 1u)], 1u, memory_order_relaxed);
+    }
+
+    threadgroup_barrier(mem_flags::mem_threadgroup);
+
+    if (t < primitiveData.binsCount)
+    {
+        const uint count = atomic_load_explicit(&counters[t], memory_order_relaxed);
+
+        if (count != 0u)
+        {
+            atomic_fetch_add_explicit(reinterpret_cast<device atomic_uint*>(primitiveOutput) + t, count, memory_order_relaxed);
+        }
+    }
+}
+
+#endif
+
+#endif
@@ -447,9 +447,9 @@ namespace MMPEngine::Backend::Metal
                     ss.indexCount,
                     tc->renderer->GetNativeIndexType(),
                     tc->renderer->GetNativeIndexBuffer()->GetNative(),
-                    ss.indexStart,
+                    (ss.indexStart + tc->renderer->GetIndexStart()) * tc->renderer->GetMesh()->GetIndexBufferInfo().stride,
                     static_cast<NS::UInteger>(tc->renderer->GetSettings().dynamicData.instancesCount),
-                    ss.baseVertex,
+                    static_cast<NS::Integer>(ss.baseVertex + tc->renderer->GetBaseVertex()),
                     0
                 );
             }
@@ -9,8 +9,7 @@ namespace MMPEngine::Backend::Metal
     DeviceMemoryHeap::Handle DeviceMemoryHeap::Allocate(const Request& request)
     {
         const auto entry = AllocateEntry(request);
-        const auto block = dynamic_cast<Block*>(_blocks[entry.blockIndex].get());
-        return { shared_from_this(), entry, block->GetEntityBlock() };
+        return { shared_from_this(), entry, std::dynamic_pointer_cast<DeviceMemoryBlock>(GetBlockEntity(entry.blockIndex)) };
     }
     
     const DeviceMemoryBlock::MTLSettings& DeviceMemoryHeap::GetMtlSettings() const
@@ -4,7 +4,7 @@
 
 namespace MMPEngine::Backend::Metal
 {
-    Mesh::Mesh(Core::GeometryPrototype&& proto) : Core::Mesh(std::move(proto))
+    Mesh::Mesh(Core::GeometryPrototype&& proto, const Settings& settings) : Core::Mesh(std::move(proto), settings)
     {
     }
 
@@ -13,7 +13,7 @@ namespace MMPEngine::Backend::Metal
         return Core::BaseTask::kEmpty;
     }
 
-    std::shared_ptr<Core::VertexBuffer> Mesh::CreateVertexBuffer(const Core::VertexBufferPrototype* vbPrototype)
+    std::shared_ptr<Core::VertexBuffer> Mesh::CreateVertexBuffer(const Core::BaseGeometryBufferPrototype* vbPrototype)
     {
         return std::make_shared<VertexBuffer>(Core::InputAssemblerBuffer::Settings{
         {vbPrototype->GetDataPtr()}, {vbPrototype->GetByteLength()}
@@ -108,6 +108,24 @@ namespace MMPEngine::Backend::Metal
             return MTL::VertexFormatFloat4;
         case Core::VertexBufferPrototype::Format::Uint4:
             return MTL::VertexFormatUInt4;
+        case Core::VertexBufferPrototype::Format::Half2:
+            return MTL::VertexFormatHalf2;
+        case Core::VertexBufferPrototype::Format::Half4:
+            return MTL::VertexFormatHalf4;
+        case Core::VertexBufferPrototype::Format::Snorm8x4:
+            return MTL::VertexFormatChar4Normalized;
+        case Core::VertexBufferPrototype::Format::Unorm8x4:
+            return MTL::VertexFormatUChar4Normalized;
+        case Core::VertexBufferPrototype::Format::Snorm16x2:
+            return MTL::VertexFormatShort2Normalized;
+        case Core::VertexBufferPrototype::Format::Snorm16x4:
+            return MTL::VertexFormatShort4Normalized;
+        case Core::VertexBufferPrototype::Format::Unorm16x2:
+            return MTL::VertexFormatUShort2Normalized;
+        case Core::VertexBufferPrototype::Format::Unorm16x4:
+            return MTL::VertexFormatUShort4Normalized;
+        case Core::VertexBufferPrototype::Format::Unorm10_10_10_2:
+            return MTL::VertexFormatUInt1010102Normalized;
         default:
             throw Core::UnsupportedException("unsupported Metal vertex buffer format");
         }
@@ -122,6 +140,11 @@ namespace MMPEngine::Backend::Metal
         return std::make_shared<UniformBuffer<Core::Mesh::Renderer::Data>>();
     }
 
+    std::shared_ptr<Core::UniformBuffer<Core::Mesh::Renderer::AffineData>> Mesh::Renderer::CreateAffineUniformBuffer()
+    {
+        return std::make_shared<UniformBuffer<Core::Mesh::Renderer::AffineData>>();
+    }
+
 
 
     Mesh::Renderer::InitTask::InitTask(const std::shared_ptr<InitTaskContext>& ctx) : Task(ctx)
@@ -135,6 +158,11 @@ namespace MMPEngine::Backend::Metal
         const auto renderer = GetTaskContext()->entity;
         assert(renderer);
         
+        if (renderer->GetSettings().staticData.indirect.has_value())
+        {
+            throw Core::UnsupportedException("indirect mesh rendering is not supported by Metal backend");
+        }
+        
         renderer->_mtlVertexDescriptor = NS::TransferPtr(MTL::VertexDescriptor::alloc()->init());
         
         renderer->ForEachAvailableVertexAttributes([&renderer](const auto& vbInfo, const auto&){
@@ -146,7 +174,7 @@ namespace MMPEngine::Backend::Metal
             auto layout = renderer->_mtlVertexDescriptor->layouts()->object(bufferIndex);
             
             attribute->setFormat(GetVertexFormat(vbInfo.format));
-            attribute->setOffset(0U);
+            attribute->setOffset(static_cast<NS::UInteger>(vbInfo.offset));
             attribute->setBufferIndex(bufferIndex);
             
             layout->setStepRate(1);
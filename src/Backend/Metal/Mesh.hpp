@@ -9,7 +9,7 @@ namespace MMPEngine::Backend::Metal
     class Mesh final : public Core::Mesh
     {
     public:
-        Mesh(Core::GeometryPrototype&& proto);
+        Mesh(Core::GeometryPrototype&& proto, const Settings& settings);
 
         class Renderer final : public Core::Mesh::Renderer
         {
@@ -28,6 +28,7 @@ namespace MMPEngine::Backend::Metal
             
         protected:
             std::shared_ptr<Core::UniformBuffer<Data>> CreateUniformBuffer() override;
+            std::shared_ptr<Core::UniformBuffer<AffineData>> CreateAffineUniformBuffer() override;
             std::shared_ptr<Core::BaseTask> CreateInternalInitializationTask() override;
         private:
             class InitTaskContext final : public Core::EntityTaskContext<Renderer>
@@ -52,7 +53,7 @@ namespace MMPEngine::Backend::Metal
         
     protected:
         std::shared_ptr<Core::BaseTask> CreateInternalInitializationTask() override;
-        std::shared_ptr<Core::VertexBuffer> CreateVertexBuffer(const Core::VertexBufferPrototype* vbPrototype) override;
+        std::shared_ptr<Core::VertexBuffer> CreateVertexBuffer(const Core::BaseGeometryBufferPrototype* vbPrototype) override;
         std::shared_ptr<Core::IndexBuffer> CreateIndexBuffer(const Core::IndexBufferPrototype* ibPrototype) override;
     };
 }
@@ -3,6 +3,8 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/geometric.hpp>
 #include <glm/vec3.hpp>
+#include <glm/mat3x3.hpp>
+#include <glm/mat3x4.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <glm/gtx/transform.hpp>
 #include <glm/gtx/matrix_decompose.hpp>
@@ -128,6 +130,43 @@ namespace MMPEngine::Backend::Shared
 		std::memcpy(&res, &glmRes, sizeof(res));
 	}
 
+	void GLMMath::Multiply(Core::Affine3x4& res, const Core::Affine3x4& m1, const Core::Affine3x4& m2) const
+	{
+		const auto& glmM1 = reinterpret_cast<const glm::mat3x4&>(m1);
+		const auto& glmM2 = reinterpret_cast<const glm::mat3x4&>(m2);
+
+		glm::mat3x4 glmRes {};
+
+		for (glm::length_t i = 0; i < 3; ++i)
+		{
+			glmRes[i] = glmM1[i].x * glmM2[0] + glmM1[i].y * glmM2[1] + glmM1[i].z * glmM2[2] + glm::vec4(0.0f, 0.0f, 0.0f, glmM1[i].w);
+		}
+
+		std::memcpy(&res, &glmRes, sizeof(res));
+	}
+
+	void GLMMath::Inverse(Core::Affine3x4& res, const Core::Affine3x4& m) const
+	{
+		const auto& glmM = reinterpret_cast<const glm::mat3x4&>(m);
+		const auto glmInverseLinearT = glm::inverse(glm::mat3(glmM));
+		const auto glmTranslation = -(glm::transpose(glmInverseLinearT) * glm::vec3(glmM[0].w, glmM[1].w, glmM[2].w));
+
+		const glm::mat3x4 glmRes {
+			glm::vec4(glmInverseLinearT[0], glmTranslation.x),
+			glm::vec4(glmInverseLinearT[1], glmTranslation.y),
+			glm::vec4(glmInverseLinearT[2], glmTranslation.z)
+		};
+
+		std::memcpy(&res, &glmRes, sizeof(res));
+	}
+
+	void GLMMath::InverseTranspose(Core::Matrix3x3& res, const Core::Affine3x4& m) const
+	{
+		const auto& glmM = reinterpret_cast<const glm::mat3x4&>(m);
+		const auto glmRes = glm::transpose(glm::inverse(glm::mat3(glmM)));
+		std::memcpy(&res, &glmRes, sizeof(res));
+	}
+
 	void GLMMath::MultiplyMatrixAndPoint(Core::Vector3Float& res, const Core::Matrix4x4& m, const Core::Vector3Float& p) const
 	{
 		const glm::vec4 glmP = {p.x, p.y, p.z, 1.0f};
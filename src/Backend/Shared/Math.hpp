@@ -23,6 +23,9 @@ namespace MMPEngine::Backend::Shared
 		void Inverse(Core::Matrix4x4& res, const Core::Matrix4x4& m) const override;
 		void Transpose(Core::Matrix4x4& res, const Core::Matrix4x4& m) const override;
 		void InverseTranspose(Core::Matrix4x4& res, const Core::Matrix4x4& m) const override;
+		void Multiply(Core::Affine3x4& res, const Core::Affine3x4& m1, const Core::Affine3x4& m2) const override;
+		void Inverse(Core::Affine3x4& res, const Core::Affine3x4& m) const override;
+		void InverseTranspose(Core::Matrix3x3& res, const Core::Affine3x4& m) const override;
 		void MultiplyMatrixAndPoint(Core::Vector3Float& res, const Core::Matrix4x4& m, const Core::Vector3Float& p) const override;
 		void MultiplyMatrixAndVector(Core::Vector3Float& res, const Core::Matrix4x4& m, const Core::Vector3Float& v) const override;
 
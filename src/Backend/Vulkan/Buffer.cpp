@@ -1,4 +1,5 @@
 #include <Backend/Vulkan/Buffer.hpp>
+#include <algorithm>
 #include <cassert>
 
 namespace MMPEngine::Backend::Vulkan
@@ -20,6 +21,56 @@ namespace MMPEngine::Backend::Vulkan
 		return _info;
 	}
 
+	std::uint64_t Buffer::GetRelocationVersion() const
+	{
+		return _relocationVersion;
+	}
+
+	void Buffer::CreateNativeBuffer(VkDeviceSize byteSize)
+	{
+		VkBufferCreateInfo bufferInfo{};
+		bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		bufferInfo.usage = _usage;
+		bufferInfo.size = byteSize;
+		bufferInfo.pNext = nullptr;
+		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		bufferInfo.pQueueFamilyIndices = nullptr;
+		bufferInfo.queueFamilyIndexCount = 0;
+		bufferInfo.flags = 0;
+
+		vkCreateBuffer(_device->GetNativeLogical(), &bufferInfo, nullptr, &_nativeBuffer);
+
+		_info = {
+			_nativeBuffer,
+			0,
+			byteSize
+		};
+	}
+
+	void Buffer::BindNativeBuffer()
+	{
+		const auto res = vkBindBufferMemory(
+			_device->GetNativeLogical(),
+			_nativeBuffer,
+			_deviceMemoryHeapHandle.GetMemoryBlock()->GetNative(),
+			static_cast<VkDeviceSize>(_deviceMemoryHeapHandle.GetOffset())
+		);
+
+		assert(res == VK_SUCCESS);
+	}
+
+	void Buffer::OnRelocated()
+	{
+		// the heap has already copied the contents, only the view onto the new range has to be rebuilt
+		vkDestroyBuffer(_device->GetNativeLogical(), _nativeBuffer, nullptr);
+		CreateNativeBuffer(_info.range);
+		BindNativeBuffer();
+
+		_queueFamilyIndexOwnerShip = std::nullopt;
+		_queueOwnerStreamContext.reset();
+		++_relocationVersion;
+	}
+
 	Buffer::MemoryBarrierTask::MemoryBarrierTask(const std::shared_ptr<MemoryBarrierContext>& ctx) : Task<MMPEngine::Backend::Vulkan::Buffer::MemoryBarrierContext>(ctx)
 	{
 	}
@@ -29,41 +80,79 @@ namespace MMPEngine::Backend::Vulkan
 		Task::Run(stream);
 
 		const auto tc = GetTaskContext();
+		const auto entity = tc->entity;
+
+		VkPipelineStageFlags srcStage = 0;
+		const auto b = entity->TrackAccess(_specificStreamContext, tc->dstStage, tc->dstAccess, srcStage);
+
+		if (b.has_value() && (b->srcQueueFamilyIndex != b->dstQueueFamilyIndex || !entity->_frameGraphBarriers))
+		{
+			vkCmdPipelineBarrier(
+				_specificStreamContext->PopulateCommandsInBuffer()->GetNative(),
+				srcStage == 0 ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : srcStage,
+				tc->dstStage,
+				0,
+				0, nullptr,
+				1, &b.value(),
+				0, nullptr
+			);
+		}
+	}
+
+	std::optional<VkBufferMemoryBarrier> Buffer::TrackAccess(const std::shared_ptr<StreamContext>& streamContext, VkPipelineStageFlags dstStage, VkAccessFlags dstAccess, VkPipelineStageFlags& srcStage)
+	{
+		const auto familyIndex = streamContext->GetQueue()->GetFamilyIndex();
+
 		VkBufferMemoryBarrier b {};
 
 		b.pNext = nullptr;
 		b.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
 
-		b.buffer = tc->entity->_nativeBuffer;
+		b.buffer = _nativeBuffer;
 		b.offset = 0;
 		b.size = VK_WHOLE_SIZE;
 
-		b.srcAccessMask = tc->srcAccess;
-		b.dstAccessMask = tc->dstAccess;
+		b.srcAccessMask = _accessTracker.GetWriteAccess();
+		b.dstAccessMask = dstAccess;
 
-		b.srcQueueFamilyIndex = tc->entity->_queueFamilyIndexOwnerShip.value_or(_specificStreamContext->GetQueue()->GetFamilyIndex());
-		b.dstQueueFamilyIndex = _specificStreamContext->GetQueue()->GetFamilyIndex();
+		b.srcQueueFamilyIndex = _queueFamilyIndexOwnerShip.value_or(familyIndex);
+		b.dstQueueFamilyIndex = familyIndex;
 
-		vkCmdPipelineBarrier(
-			_specificStreamContext->PopulateCommandsInBuffer()->GetNative(),
-			tc->srcStage,
-			tc->dstStage,
-			0,
-			0, nullptr,
-			1, &b,
-			0, nullptr
-		);
+		std::optional<VkBufferMemoryBarrier> result = std::nullopt;
+		srcStage = 0;
 
-		tc->entity->_queueFamilyIndexOwnerShip = _specificStreamContext->GetQueue()->GetFamilyIndex();
+		if (b.srcQueueFamilyIndex != b.dstQueueFamilyIndex)
+		{
+			if (const auto owner = _queueOwnerStreamContext.lock(); owner && owner != streamContext)
+			{
+				auto release = b;
+				release.dstAccessMask = 0;
+				streamContext->AcquireOwnership(owner, release);
+			}
+
+			b.srcAccessMask = 0;
+			_accessTracker.Reset(dstStage, 0);
+			_accessTracker.Track(dstStage, dstAccess);
+			result = b;
+		}
+		else if (const auto barrier = _accessTracker.Track(dstStage, dstAccess))
+		{
+			srcStage = barrier->srcStage;
+			b.srcAccessMask = barrier->srcAccess;
+			result = b;
+		}
+
+		_queueFamilyIndexOwnerShip = familyIndex;
+		_queueOwnerStreamContext = streamContext;
+
+		return result;
 	}
 
-	std::shared_ptr<Core::BaseTask> Buffer::CreateMemoryBarrierTask(VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+	std::shared_ptr<Core::BaseTask> Buffer::CreateMemoryBarrierTask(VkAccessFlags dstAccess, VkPipelineStageFlags dstStage)
 	{
 		const auto ctx = std::make_shared<MemoryBarrierContext>();
 		ctx->entity = std::dynamic_pointer_cast<Vulkan::Buffer>(shared_from_this());
-		ctx->srcAccess = srcAccess;
 		ctx->dstAccess = dstAccess;
-		ctx->srcStage = srcStage;
 		ctx->dstStage = dstStage;
 		return std::make_shared<MemoryBarrierTask>(ctx);
 	}
@@ -78,33 +167,38 @@ namespace MMPEngine::Backend::Vulkan
 
 		const auto tc = GetTaskContext();
 
-		VkBufferCreateInfo bufferInfo{};
-		bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-		bufferInfo.usage = tc->entity->_usage;
-		bufferInfo.size = static_cast<VkDeviceSize>(tc->byteSize);
-		bufferInfo.pNext = nullptr;
-		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		bufferInfo.pQueueFamilyIndices = nullptr;
-		bufferInfo.queueFamilyIndexCount = 0;
-		bufferInfo.flags = 0;
-
 		tc->entity->_device = _specificGlobalContext->device;
-		vkCreateBuffer(tc->entity->_device->GetNativeLogical(), &bufferInfo, nullptr, &tc->entity->_nativeBuffer);
-
-		tc->entity->_info = {
-			tc->entity->_nativeBuffer,
-			0,
-			bufferInfo.size
-		};
+		tc->entity->CreateNativeBuffer(static_cast<VkDeviceSize>(tc->byteSize));
 
 		const auto memHeap = tc->entity->GetMemoryHeap(_specificGlobalContext);
-		VkMemoryRequirements memRequirements;
-		vkGetBufferMemoryRequirements(tc->entity->_device->GetNativeLogical(), tc->entity->_nativeBuffer, &memRequirements);
+		VkBufferMemoryRequirementsInfo2 memRequirementsInfo {};
+		memRequirementsInfo.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2;
+		memRequirementsInfo.pNext = nullptr;
+		memRequirementsInfo.buffer = tc->entity->_nativeBuffer;
 
-		tc->entity->_deviceMemoryHeapHandle = memHeap->Allocate(Core::Heap::Request {
-			static_cast<std::size_t>(memRequirements.size),
-				static_cast<std::size_t>(memRequirements.alignment)
-		});
+		VkMemoryDedicatedRequirements dedicatedRequirements {};
+		dedicatedRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+		dedicatedRequirements.pNext = nullptr;
+
+		VkMemoryRequirements2 memRequirements {};
+		memRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+		memRequirements.pNext = &dedicatedRequirements;
+
+		vkGetBufferMemoryRequirements2(tc->entity->_device->GetNativeLogical(), &memRequirementsInfo, &memRequirements);
+
+		const Core::Heap::Request request {
+			static_cast<std::size_t>(memRequirements.memoryRequirements.size),
+			static_cast<std::size_t>(memRequirements.memoryRequirements.alignment)
+		};
+
+		if (dedicatedRequirements.requiresDedicatedAllocation || dedicatedRequirements.prefersDedicatedAllocation || memHeap->IsDedicatedSize(request.size))
+		{
+			tc->entity->_deviceMemoryHeapHandle = memHeap->AllocateDedicated(request, tc->entity->_nativeBuffer);
+		}
+		else
+		{
+			tc->entity->_deviceMemoryHeapHandle = memHeap->Allocate(request);
+		}
 	}
 
 	Buffer::InitTask::Bind::Bind(const std::shared_ptr<InitTaskContext>& context) : Task<MMPEngine::Backend::Vulkan::Buffer::InitTaskContext>(context)
@@ -116,15 +210,12 @@ namespace MMPEngine::Backend::Vulkan
 		Task::Run(stream);
 
 		const auto tc = GetTaskContext();
+		const auto entity = tc->entity.get();
 
-		const auto res = vkBindBufferMemory(
-			tc->entity->_device->GetNativeLogical(), 
-			tc->entity->_nativeBuffer, 
-			tc->entity->_deviceMemoryHeapHandle.GetMemoryBlock()->GetNative(), 
-			static_cast<VkDeviceSize>(tc->entity->_deviceMemoryHeapHandle.GetOffset())
-		);
-
-		assert(res == VK_SUCCESS);
+		entity->BindNativeBuffer();
+		entity->_deviceMemoryHeapHandle.EnableRelocation([entity]() {
+			entity->OnRelocated();
+		});
 	}
 
 
@@ -151,8 +242,8 @@ namespace MMPEngine::Backend::Vulkan
 		assert(dstBuffer);
 
 		_commandTask = std::make_shared<Impl>(context);
-		_srcBufferBarrierTask = srcBuffer->CreateMemoryBarrierTask(VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT);
-		_dstBufferBarrierTask = dstBuffer->CreateMemoryBarrierTask(VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+		_srcBufferBarrierTask = srcBuffer->CreateMemoryBarrierTask(VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+		_dstBufferBarrierTask = dstBuffer->CreateMemoryBarrierTask(VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
 	}
 
 	void Buffer::CopyBufferTask::OnScheduled(const std::shared_ptr<Core::BaseStream>& stream)
@@ -176,17 +267,28 @@ namespace MMPEngine::Backend::Vulkan
 		const auto srcBuffer = tc->src;
 		const auto dstBuffer = tc->dst;
 
-		VkBufferCopy region {};
-		region.size = static_cast<VkDeviceSize>(tc->byteLength);
-		region.srcOffset = static_cast<VkDeviceSize>(tc->srcByteOffset);
-		region.dstOffset = static_cast<VkDeviceSize>(tc->dstByteOffset);
+		std::vector<VkBufferCopy> regions;
+
+		if (tc->regions.empty())
+		{
+			regions.push_back({ static_cast<VkDeviceSize>(tc->srcByteOffset), static_cast<VkDeviceSize>(tc->dstByteOffset), static_cast<VkDeviceSize>(tc->byteLength) });
+		}
+		else
+		{
+			regions.reserve(tc->regions.size());
+
+			for (const auto& region : tc->regions)
+			{
+				regions.push_back({ static_cast<VkDeviceSize>(region.srcByteOffset), static_cast<VkDeviceSize>(region.dstByteOffset), static_cast<VkDeviceSize>(region.byteLength) });
+			}
+		}
 
 		vkCmdCopyBuffer(
 			_specificStreamContext->PopulateCommandsInBuffer()->GetNative(),
 			srcBuffer->_nativeBuffer,
 			dstBuffer->_nativeBuffer,
-			1,
-			&region
+			static_cast<std::uint32_t>(regions.size()),
+			regions.data()
 		);
 	}
 
@@ -219,7 +321,7 @@ namespace MMPEngine::Backend::Vulkan
 		Task::Run(stream);
 		if (const auto tc = GetTaskContext(); const auto entity = tc->uploadBuffer)
 		{
-			std::memcpy(static_cast<char*>(entity->_deviceMemoryHeapHandle.GetMemoryBlock()->GetHost()) + entity->_deviceMemoryHeapHandle.GetOffset() + tc->byteOffset, tc->src, tc->byteLength);
+			Core::UploadBuffer::Write(static_cast<char*>(entity->_deviceMemoryHeapHandle.GetMemoryBlock()->GetHost()) + entity->_deviceMemoryHeapHandle.GetOffset(), *tc);
 		}
 	}
 
@@ -251,6 +353,16 @@ namespace MMPEngine::Backend::Vulkan
 		return std::make_shared<CopyBufferTask>(context);
 	}
 
+	std::shared_ptr<Core::BaseTask> UploadBuffer::CreateCopyRegionsToBufferTask(const std::shared_ptr<Core::Buffer>& dst, const std::vector<CopyRegion>& regions) const
+	{
+		const auto context = std::make_shared<CopyBufferTaskContext>();
+		context->src = std::dynamic_pointer_cast<Vulkan::Buffer>(std::const_pointer_cast<Core::Buffer>(GetUnderlyingBuffer()));
+		context->dst = std::dynamic_pointer_cast<Vulkan::Buffer>(dst->GetUnderlyingBuffer());
+		context->regions = regions;
+
+		return std::make_shared<CopyBufferTask>(context);
+	}
+
 	std::shared_ptr<Core::BaseTask> UploadBuffer::CreateInitializationTask()
 	{
 		const auto ctx = std::make_shared<InitTaskContext>();
@@ -280,7 +392,11 @@ namespace MMPEngine::Backend::Vulkan
 	{
 		Task::OnScheduled(stream);
 
-		stream->Schedule(Core::StreamBarrierTask::kInstance);
+		if (GetTaskContext()->synchronize)
+		{
+			stream->Schedule(Core::StreamBarrierTask::kInstance);
+		}
+
 		stream->Schedule(_implTask);
 	}
 
@@ -382,9 +498,9 @@ namespace MMPEngine::Backend::Vulkan
 		return globalContext->residentBufferHeap;
 	}
 
-	std::shared_ptr<Core::BaseTask> InputAssemblerBuffer::CreateMemoryBarrierTask(VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+	std::shared_ptr<Core::BaseTask> InputAssemblerBuffer::CreateMemoryBarrierTask(VkAccessFlags dstAccess, VkPipelineStageFlags dstStage)
 	{
-		return std::dynamic_pointer_cast<Vulkan::Buffer>(_storage)->CreateMemoryBarrierTask(srcAccess, dstAccess, srcStage, dstStage);
+		return std::dynamic_pointer_cast<Vulkan::Buffer>(_storage)->CreateMemoryBarrierTask(dstAccess, dstStage);
 	}
 
 	InputAssemblerBuffer::~InputAssemblerBuffer() = default;
@@ -399,6 +515,12 @@ namespace MMPEngine::Backend::Vulkan
 
 		if (const auto tc = GetTaskContext(); const auto entity = tc->entity)
 		{
+			if (entity->_ia.rawData == nullptr)
+			{
+				stream->Schedule(entity->_storage->CreateInitializationTask());
+				return;
+			}
+
 			stream->Schedule(entity->_upload->CreateInitializationTask());
 			stream->Schedule(entity->_storage->CreateInitializationTask());
 			stream->Schedule(Core::StreamBarrierTask::kInstance);
@@ -527,7 +649,7 @@ namespace MMPEngine::Backend::Vulkan
 	}
 
 
-	UnorderedAccessBuffer::UnorderedAccessBuffer(const Settings& settings) : Core::UnorderedAccessBuffer(settings), Vulkan::Buffer(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT)
+	UnorderedAccessBuffer::UnorderedAccessBuffer(const Settings& settings) : Core::UnorderedAccessBuffer(settings), Vulkan::Buffer(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT)
 	{
 	}
 
@@ -601,19 +723,16 @@ namespace MMPEngine::Backend::Vulkan
 		ctx->entity = _counterBuffer;
 
 		return std::make_shared<Core::StaticBatchTask>(std::initializer_list<std::shared_ptr<Core::BaseTask>>{
-			_counterBuffer->CreateMemoryBarrierTask(
-				VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT,
-				VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT
-			),
+			_counterBuffer->CreateMemoryBarrierTask(VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT),
 			std::make_shared<ResetCounterTaskImpl>(ctx)
 		});
 	}
 
-	std::shared_ptr<Core::BaseTask> CounteredUnorderedAccessBuffer::CreateMemoryBarrierTask(VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+	std::shared_ptr<Core::BaseTask> CounteredUnorderedAccessBuffer::CreateMemoryBarrierTask(VkAccessFlags dstAccess, VkPipelineStageFlags dstStage)
 	{
 		return std::make_shared<Core::StaticBatchTask>(std::initializer_list<std::shared_ptr<Core::BaseTask>>{
-			Vulkan::Buffer::CreateMemoryBarrierTask(srcAccess, dstAccess, srcStage, dstStage),
-				_counterBuffer->CreateMemoryBarrierTask(srcAccess, dstAccess, srcStage, dstStage)
+			Vulkan::Buffer::CreateMemoryBarrierTask(dstAccess, dstStage),
+				_counterBuffer->CreateMemoryBarrierTask(dstAccess, dstStage)
 		});
 	}
 
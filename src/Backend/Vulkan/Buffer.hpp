@@ -1,4 +1,6 @@
 #pragma once
+#include <optional>
+#include <Core/AccessTracker.hpp>
 #include <Core/Buffer.hpp>
 #include <Backend/Vulkan/Entity.hpp>
 #include <Backend/Vulkan/Context.hpp>
@@ -7,6 +9,7 @@ namespace MMPEngine::Backend::Vulkan
 {
 	class Buffer : public ResourceEntity
 	{
+		friend class FrameGraphJob;
 	public:
 		Buffer(VkBufferUsageFlags usage);
 		~Buffer() override;
@@ -16,15 +19,16 @@ namespace MMPEngine::Backend::Vulkan
 		Buffer& operator=(Buffer&&) noexcept = delete;
 
 		const VkDescriptorBufferInfo& GetDescriptorBufferInfo() const;
-		virtual std::shared_ptr<Core::BaseTask> CreateMemoryBarrierTask(VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkPipelineStageFlags srcStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VkPipelineStageFlags dstStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+		std::uint64_t GetRelocationVersion() const;
+		virtual std::shared_ptr<Core::BaseTask> CreateMemoryBarrierTask(VkAccessFlags dstAccess, VkPipelineStageFlags dstStage);
+
+		static constexpr VkAccessFlags kWriteAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
 	protected:
 
 		class MemoryBarrierContext final : public Core::EntityTaskContext<Buffer>
 		{
 		public:
-			VkAccessFlags srcAccess = VK_ACCESS_MEMORY_READ_BIT;
-			VkAccessFlags dstAccess = VK_ACCESS_MEMORY_WRITE_BIT;
-			VkPipelineStageFlags srcStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			VkAccessFlags dstAccess = VK_ACCESS_MEMORY_READ_BIT;
 			VkPipelineStageFlags dstStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
 		};
 
@@ -74,6 +78,7 @@ namespace MMPEngine::Backend::Vulkan
 			std::size_t byteLength = 0;
 			std::size_t srcByteOffset = 0;
 			std::size_t dstByteOffset = 0;
+			std::vector<Core::Buffer::CopyRegion> regions {};
 		};
 
 		class CopyBufferTask final : public Task<CopyBufferTaskContext>
@@ -99,6 +104,15 @@ namespace MMPEngine::Backend::Vulkan
 		std::shared_ptr<Wrapper::Device> _device;
 		VkBufferUsageFlags _usage;
 		VkDescriptorBufferInfo _info;
+	private:
+		void CreateNativeBuffer(VkDeviceSize byteSize);
+		void BindNativeBuffer();
+		void OnRelocated();
+		std::optional<VkBufferMemoryBarrier> TrackAccess(const std::shared_ptr<StreamContext>& streamContext, VkPipelineStageFlags dstStage, VkAccessFlags dstAccess, VkPipelineStageFlags& srcStage);
+
+		Core::AccessTracker _accessTracker { kWriteAccessMask };
+		bool _frameGraphBarriers = false;
+		std::uint64_t _relocationVersion = 0;
 	};
 
 	class UploadBuffer final : public Core::UploadBuffer, public Buffer
@@ -130,6 +144,7 @@ namespace MMPEngine::Backend::Vulkan
 		std::shared_ptr<Core::BaseTask> CreateCopyToBufferTask(const std::shared_ptr<Core::Buffer>& dst, std::size_t byteLength, std::size_t srcByteOffset, std::size_t dstByteOffset) const override;
 		std::shared_ptr<Core::BaseTask> CreateInitializationTask() override;
 	protected:
+		std::shared_ptr<Core::BaseTask> CreateCopyRegionsToBufferTask(const std::shared_ptr<Core::Buffer>& dst, const std::vector<CopyRegion>& regions) const override;
 		std::shared_ptr<DeviceMemoryHeap> GetMemoryHeap(const std::shared_ptr<GlobalContext>& globalContext) const override;
 	};
 
@@ -192,7 +207,7 @@ namespace MMPEngine::Backend::Vulkan
 		std::shared_ptr<Core::BaseTask> CreateInitializationTask() override;
 		std::shared_ptr<Core::BaseTask> CreateCopyCounterTask(const std::shared_ptr<Core::Buffer>& dst, std::size_t dstByteOffset) override;
 		std::shared_ptr<Core::BaseTask> CreateResetCounterTask() override;
-		std::shared_ptr<Core::BaseTask> CreateMemoryBarrierTask(VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage) override;
+		std::shared_ptr<Core::BaseTask> CreateMemoryBarrierTask(VkAccessFlags dstAccess, VkPipelineStageFlags dstStage) override;
 		std::shared_ptr<Vulkan::Buffer> GetCounterBuffer() const;
 	protected:
 		std::shared_ptr<DeviceMemoryHeap> GetMemoryHeap(const std::shared_ptr<GlobalContext>& globalContext) const override;
@@ -220,7 +235,7 @@ namespace MMPEngine::Backend::Vulkan
 		InputAssemblerBuffer(InputAssemblerBuffer&&) noexcept = delete;
 		InputAssemblerBuffer& operator=(const InputAssemblerBuffer&) = delete;
 		InputAssemblerBuffer& operator=(InputAssemblerBuffer&&) noexcept = delete;
-		std::shared_ptr<Core::BaseTask> CreateMemoryBarrierTask(VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkPipelineStageFlags srcStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VkPipelineStageFlags dstStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT) override;
+		std::shared_ptr<Core::BaseTask> CreateMemoryBarrierTask(VkAccessFlags dstAccess, VkPipelineStageFlags dstStage) override;
 	protected:
 		InputAssemblerBuffer(VkBufferUsageFlags usage, const Core::InputAssemblerBuffer::Settings& settings, const std::shared_ptr<UploadBuffer>& upload, const std::shared_ptr<Core::Buffer>& storage);
 		std::shared_ptr<DeviceMemoryHeap> GetMemoryHeap(const std::shared_ptr<GlobalContext>& globalContext) const override;
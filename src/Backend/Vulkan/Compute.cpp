@@ -93,6 +93,8 @@ namespace MMPEngine::Backend::Vulkan
 		const auto job = tc->job;
 		const auto& dim = tc->groups;
 
+		job->UpdateRelocatedBindings();
+
 		vkCmdBindPipeline(
 		_specificStreamContext->PopulateCommandsInBuffer()->GetNative(), 
 			VK_PIPELINE_BIND_POINT_COMPUTE, 
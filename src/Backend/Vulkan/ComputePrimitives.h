@@ -0,0 +1,279 @@
+#ifndef MMPENGINE_VULKAN_COMPUTE_PRIMITIVES
+#define MMPENGINE_VULKAN_COMPUTE_PRIMITIVES 1
+
+#if MMPENGINE_GLSL
+
+#define MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE 256u
+#define MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE 16u
+#define MMPENGINE_COMPUTE_PRIMITIVES_MAX_GROUPS_COUNT 65535u
+#define MMPENGINE_COMPUTE_PRIMITIVES_INCLUSIVE 1u
+#define MMPENGINE_COMPUTE_PRIMITIVES_WRITE_BLOCK_SUMS 2u
+#define MMPENGINE_COMPUTE_PRIMITIVES_PAYLOAD 4u
+
+#define MMPENGINE_COMPUTE_PRIMITIVES_CLEAR 0
+#define MMPENGINE_COMPUTE_PRIMITIVES_SCAN_BLOCKS 1
+#define MMPENGINE_COMPUTE_PRIMITIVES_ADD_BLOCK_OFFSETS 2
+#define MMPENGINE_COMPUTE_PRIMITIVES_COMPACT_SCATTER 3
+#define MMPENGINE_COMPUTE_PRIMITIVES_RADIX_COUNT 4
+#define MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SCATTER 5
+#define MMPENGINE_COMPUTE_PRIMITIVES_SEGMENTED_REDUCE 6
+#define MMPENGINE_COMPUTE_PRIMITIVES_HISTOGRAM 7
+
+layout(local_size_x = MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE, local_size_y = 1, local_size_z = 1) in;
+
+layout(set = 0, binding = 0) uniform ComputePrimitiveDataBuffer
+{
+	ComputePrimitiveData primitiveData;
+};
+
+layout(std430, set = 0, binding = 1) buffer PrimitiveInputBuffer
+{
+	uint primitiveInput[];
+};
+
+layout(std430, set = 0, binding = 2) buffer PrimitiveInputPayloadBuffer
+{
+	uint primitiveInputPayload[];
+};
+
+layout(std430, set = 0, binding = 3) buffer PrimitiveOutputBuffer
+{
+	uint primitiveOutput[];
+};
+
+layout(std430, set = 0, binding = 4) buffer PrimitiveOutputPayloadBuffer
+{
+	uint primitiveOutputPayload[];
+};
+
+layout(std430, set = 0, binding = 5) buffer PrimitiveAuxiliaryBuffer
+{
+	uint primitiveAuxiliary[];
+};
+
+shared uint primitiveShared[MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE];
+
+uint MMPEngineGetPrimitiveGroupsCount()
+{
+	return (primitiveData.count + MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE - 1u) / MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE;
+}
+
+uint MMPEngineGetRadixDigit(uint key)
+{
+	return (key >> primitiveData.shift) & (MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE - 1u);
+}
+
+uint MMPEngineScanGroupInclusive(uint value)
+{
+	const uint t = gl_LocalInvocationIndex;
+	primitiveShared[t] = value;
+	barrier();
+
+	for (uint offset = 1u; offset < MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE; offset <<= 1)
+	{
+		const uint addend = t >= offset ? primitiveShared[t - offset] : 0u;
+		barrier();
+		primitiveShared[t] += addend;
+		barrier();
+	}
+
+	return primitiveShared[t];
+}
+
+uint MMPEngineGetRadixRank(uint digit)
+{
+	const uint word = digit >> 2;
+	const uint shift = (digit & 3u) << 3;
+	uint rank = 0u;
+
+	for (uint w = 0u; w < MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE / 4u; ++w)
+	{
+		const uint packed = w == word ? 1u << shift : 0u;
+		const uint exclusive = MMPEngineScanGroupInclusive(packed) - packed;
+		rank = w == word ? (exclusive >> shift) & 0xFFu : rank;
+	}
+
+	return rank;
+}
+
+#if MMPENGINE_COMPUTE_PRIMITIVES_KERNEL == MMPENGINE_COMPUTE_PRIMITIVES_CLEAR
+
+void main()
+{
+	const uint i = gl_GlobalInvocationID.x;
+
+	if (i < primitiveData.count)
+	{
+		primitiveOutput[i] = 0u;
+	}
+}
+
+#elif MMPENGINE_COMPUTE_PRIMITIVES_KERNEL == MMPENGINE_COMPUTE_PRIMITIVES_SCAN_BLOCKS
+
+void main()
+{
+	const uint i = gl_GlobalInvocationID.x;
+	const uint value = i < primitiveData.count ? primitiveInput[i] : 0u;
+	const uint inclusive = MMPEngineScanGroupInclusive(value);
+
+	if (i < primitiveData.count)
+	{
+		primitiveOutput[i] = (primitiveData.flags & MMPENGINE_COMPUTE_PRIMITIVES_INCLUSIVE) != 0u ? inclusive : inclusive - value;
+	}
+
+	if ((primitiveData.flags & MMPENGINE_COMPUTE_PRIMITIVES_WRITE_BLOCK_SUMS) != 0u && gl_LocalInvocationIndex == MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE - 1u)
+	{
+		primitiveAuxiliary[gl_WorkGroupID.x] = inclusive;
+	}
+}
+
+#elif MMPENGINE_COMPUTE_PRIMITIVES_KERNEL == MMPENGINE_COMPUTE_PRIMITIVES_ADD_BLOCK_OFFSETS
+
+void main()
+{
+	const uint i = gl_GlobalInvocationID.x;
+
+	if (i < primitiveData.count)
+	{
+		primitiveOutput[i] += primitiveAuxiliary[gl_WorkGroupID.x];
+	}
+}
+
+#elif MMPENGINE_COMPUTE_PRIMITIVES_KERNEL == MMPENGINE_COMPUTE_PRIMITIVES_COMPACT_SCATTER
+
+void main()
+{
+	const uint i = gl_GlobalInvocationID.x;
+
+	if (i < primitiveData.count)
+	{
+		const bool selected = primitiveInputPayload[i] != 0u;
+
+		if (selected)
+		{
+			primitiveOutput[primitiveAuxiliary[i]] = primitiveInput[i];
+		}
+
+		if (i == primitiveData.count - 1u)
+		{
+			primitiveOutputPayload[0] = primitiveAuxiliary[i] + (selected ? 1u : 0u);
+		}
+	}
+}
+
+#elif MMPENGINE_COMPUTE_PRIMITIVES_KERNEL == MMPENGINE_COMPUTE_PRIMITIVES_RADIX_COUNT
+
+void main()
+{
+	const uint i = gl_GlobalInvocationID.x;
+	const uint t = gl_LocalInvocationIndex;
+
+	if (t < MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE)
+	{
+		primitiveShared[t] = 0u;
+	}
+
+	barrier();
+
+	if (i < primitiveData.count)
+	{
+		atomicAdd(primitiveShared[MMPEngineGetRadixDigit(primitiveInput[i])], 1u);
+	}
+
+	barrier();
+
+	if (t < MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE)
+	{
+		primitiveAuxiliary[t * MMPEngineGetPrimitiveGroupsCount() + gl_WorkGroupID.x] = primitiveShared[t];
+	}
+}
+
+#elif MMPENGINE_COMPUTE_PRIMITIVES_KERNEL == MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SCATTER
+
+void main()
+{
+	const uint i = gl_GlobalInvocationID.x;
+	const uint digit = i < primitiveData.count ? MMPEngineGetRadixDigit(primitiveInput[i]) : MMPENGINE_COMPUTE_PRIMITIVES_RADIX_SIZE;
+	const uint rank = MMPEngineGetRadixRank(digit);
+
+	if (i < primitiveData.count)
+	{
+		const uint dst = primitiveAuxiliary[digit * MMPEngineGetPrimitiveGroupsCount() + gl_WorkGroupID.x] + rank;
+		primitiveOutput[dst] = primitiveInput[i];
+
+		if ((primitiveData.flags & MMPENGINE_COMPUTE_PRIMITIVES_PAYLOAD) != 0u)
+		{
+			primitiveOutputPayload[dst] = primitiveInputPayload[i];
+		}
+	}
+}
+
+#elif MMPENGINE_COMPUTE_PRIMITIVES_KERNEL == MMPENGINE_COMPUTE_PRIMITIVES_SEGMENTED_REDUCE
+
+void main()
+{
+	const uint t = gl_LocalInvocationIndex;
+
+	for (uint segment = gl_WorkGroupID.x; segment < primitiveData.count; segment += MMPENGINE_COMPUTE_PRIMITIVES_MAX_GROUPS_COUNT)
+	{
+		const uint end = primitiveAuxiliary[segment + 1u];
+		uint sum = 0u;
+
+		for (uint j = primitiveAuxiliary[segment] + t; j < end; j += MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE)
+		{
+			sum += primitiveInput[j];
+		}
+
+		barrier();
+		primitiveShared[t] = sum;
+		barrier();
+
+		for (uint stride = MMPENGINE_COMPUTE_PRIMITIVES_GROUP_SIZE >> 1; stride > 0u; stride >>= 1)
+		{
+			if (t < stride)
+			{
+				primitiveShared[t] += primitiveShared[t + stride];
+			}
+
+			barrier();
+		}
+
+		if (t == 0u)
+		{
+			primitiveOutput[segment] = primitiveShared[0];
+		}
+	}
+}
+
+#elif MMPENGINE_COMPUTE_PRIMITIVES_KERNEL == MMPENGINE_COMPUTE_PRIMITIVES_HISTOGRAM
+
+void main()
+{
+	const uint i = gl_GlobalInvocationID.x;
+	const uint t = gl_LocalInvocationIndex;
+
+	if (t < primitiveData.binsCount)
+	{
+		primitiveShared[t] = 0u;
+	}
+
+	barrier();
+
+	if (i < primitiveData.count)
+	{
+		atomicAdd(primitiveShared[min(primitiveInput[i] >> primitiveData.shift, primitiveData.binsCount - 1u)], 1u);
+	}
+
+	barrier();
+
+	if (t < primitiveData.binsCount && primitiveShared[t] != 0u)
+	{
+		atomicAdd(primitiveOutput[t], primitiveShared[t]);
+	}
+}
+
+#endif
+
+#endif
+
+#endif
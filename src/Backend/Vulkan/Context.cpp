@@ -1,4 +1,7 @@
 #include <Backend/Vulkan/Context.hpp>
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
 
 namespace MMPEngine::Backend::Vulkan
 {
@@ -11,13 +14,18 @@ namespace MMPEngine::Backend::Vulkan
 		const std::shared_ptr<Wrapper::Queue>& queue, 
 		const std::shared_ptr<Wrapper::CommandAllocator>& allocator, 
 		const std::shared_ptr<Wrapper::CommandBuffer>& cmdBuffer,
-		const std::shared_ptr<Wrapper::Fence>& fence)
+		const std::shared_ptr<Wrapper::Fence>& fence,
+		const std::shared_ptr<Wrapper::Semaphore>& timelineSemaphore,
+		const std::shared_ptr<Wrapper::CommandAllocator>& releaseAllocator)
 			: Shared::StreamContext<
 				std::shared_ptr<MMPEngine::Backend::Vulkan::Wrapper::Queue>,
 				std::shared_ptr<MMPEngine::Backend::Vulkan::Wrapper::CommandAllocator>,
 				std::shared_ptr<MMPEngine::Backend::Vulkan::Wrapper::CommandBuffer>,
-				std::shared_ptr<MMPEngine::Backend::Vulkan::Wrapper::Fence>>(queue, allocator, cmdBuffer, fence)
+				std::shared_ptr<MMPEngine::Backend::Vulkan::Wrapper::Fence>>(queue, allocator, cmdBuffer, fence),
+			_timelineSemaphore(timelineSemaphore), _releaseAllocator(releaseAllocator)
 	{
+		assert(_timelineSemaphore);
+		assert(_releaseAllocator);
 	}
 
 	std::shared_ptr<Wrapper::CommandBuffer>& StreamContext::PopulateCommandsInBuffer()
@@ -37,4 +45,179 @@ namespace MMPEngine::Backend::Vulkan
 
 		return _cmdBuffer;
 	}
+
+	const std::shared_ptr<Wrapper::Semaphore>& StreamContext::GetTimelineSemaphore() const
+	{
+		return _timelineSemaphore;
+	}
+
+	std::uint64_t StreamContext::GetTimelineValue() const
+	{
+		std::lock_guard lock { _queueMutex };
+		return _timelineValue;
+	}
+
+	bool StreamContext::HasUnsubmittedCommands() const
+	{
+		return _commandsPopulated && !_commandsClosed;
+	}
+
+	void StreamContext::WaitFor(const std::shared_ptr<StreamContext>& producer, VkPipelineStageFlags dstStage)
+	{
+		assert(producer);
+
+		if (producer.get() == this)
+		{
+			return;
+		}
+
+		if (producer->HasUnsubmittedCommands())
+		{
+			throw std::logic_error("producer stream must be submitted before another stream waits for it");
+		}
+
+		if (const auto value = producer->GetTimelineValue(); value > 0)
+		{
+			AddWait(producer->_timelineSemaphore->GetNative(), value, dstStage);
+		}
+	}
+
+	void StreamContext::AcquireOwnership(const std::shared_ptr<StreamContext>& owner, const VkBufferMemoryBarrier& release)
+	{
+		assert(owner && owner.get() != this);
+		AddWait(owner->_timelineSemaphore->GetNative(), owner->SubmitRelease(&release, nullptr), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+	}
+
+	void StreamContext::AcquireOwnership(const std::shared_ptr<StreamContext>& owner, const VkImageMemoryBarrier& release)
+	{
+		assert(owner && owner.get() != this);
+		AddWait(owner->_timelineSemaphore->GetNative(), owner->SubmitRelease(nullptr, &release), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+	}
+
+	std::uint64_t StreamContext::SubmitRelease(const VkBufferMemoryBarrier* bufferRelease, const VkImageMemoryBarrier* imageRelease)
+	{
+		if (HasUnsubmittedCommands())
+		{
+			throw std::logic_error("owner stream must be submitted before another stream acquires its resources");
+		}
+
+		std::lock_guard lock { _queueMutex };
+
+		std::shared_ptr<Wrapper::CommandBuffer> cmdBuffer;
+
+		if (!_releaseCmdBuffers.empty() && _releaseCmdBuffers.front().first <= _timelineSemaphore->GetCompletedValue())
+		{
+			cmdBuffer = std::move(_releaseCmdBuffers.front().second);
+			_releaseCmdBuffers.pop_front();
+		}
+		else
+		{
+			const auto& device = _releaseAllocator->GetDevice();
+
+			VkCommandBufferAllocateInfo allocInfo {};
+			allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			allocInfo.commandPool = _releaseAllocator->GetNative();
+			allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			allocInfo.commandBufferCount = 1;
+
+			VkCommandBuffer vkCommandBuffer;
+			vkAllocateCommandBuffers(device->GetNativeLogical(), &allocInfo, &vkCommandBuffer);
+			cmdBuffer = std::make_shared<Wrapper::CommandBuffer>(device, _releaseAllocator, vkCommandBuffer);
+		}
+
+		VkCommandBufferBeginInfo beginInfo {};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		beginInfo.pInheritanceInfo = nullptr;
+		beginInfo.pNext = nullptr;
+
+		const auto cb = cmdBuffer->GetNative();
+		vkBeginCommandBuffer(cb, &beginInfo);
+		vkCmdPipelineBarrier(
+			cb,
+			VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+			VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+			0,
+			0, nullptr,
+			bufferRelease ? 1 : 0, bufferRelease,
+			imageRelease ? 1 : 0, imageRelease
+		);
+		vkEndCommandBuffer(cb);
+
+		const auto signalValue = ++_timelineValue;
+		const auto signalSemaphore = _timelineSemaphore->GetNative();
+
+		VkTimelineSemaphoreSubmitInfo timelineInfo;
+		timelineInfo.pNext = nullptr;
+		timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+		timelineInfo.waitSemaphoreValueCount = 0;
+		timelineInfo.pWaitSemaphoreValues = nullptr;
+		timelineInfo.signalSemaphoreValueCount = 1;
+		timelineInfo.pSignalSemaphoreValues = &signalValue;
+
+		VkSubmitInfo submitInfo;
+		submitInfo.pNext = &timelineInfo;
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &cb;
+		submitInfo.waitSemaphoreCount = 0;
+		submitInfo.pWaitSemaphores = nullptr;
+		submitInfo.pWaitDstStageMask = nullptr;
+		submitInfo.signalSemaphoreCount = 1;
+		submitInfo.pSignalSemaphores = &signalSemaphore;
+
+		vkQueueSubmit(_queue->GetNative(), 1, &submitInfo, nullptr);
+
+		_releaseCmdBuffers.emplace_back(signalValue, std::move(cmdBuffer));
+		return signalValue;
+	}
+
+	std::unique_lock<std::mutex> StreamContext::LockQueue() const
+	{
+		return std::unique_lock { _queueMutex };
+	}
+
+	std::uint64_t StreamContext::IncrementTimelineValue(PassControl)
+	{
+		return ++_timelineValue;
+	}
+
+	const std::vector<VkSemaphore>& StreamContext::GetWaitSemaphores(PassControl) const
+	{
+		return _waitSemaphores;
+	}
+
+	const std::vector<std::uint64_t>& StreamContext::GetWaitValues(PassControl) const
+	{
+		return _waitValues;
+	}
+
+	const std::vector<VkPipelineStageFlags>& StreamContext::GetWaitStages(PassControl) const
+	{
+		return _waitStages;
+	}
+
+	void StreamContext::ClearWaits(PassControl)
+	{
+		_waitSemaphores.clear();
+		_waitValues.clear();
+		_waitStages.clear();
+	}
+
+	void StreamContext::AddWait(VkSemaphore semaphore, std::uint64_t value, VkPipelineStageFlags dstStage)
+	{
+		for (std::size_t i = 0; i < _waitSemaphores.size(); ++i)
+		{
+			if (_waitSemaphores[i] == semaphore)
+			{
+				_waitValues[i] = (std::max)(_waitValues[i], value);
+				_waitStages[i] |= dstStage;
+				return;
+			}
+		}
+
+		_waitSemaphores.push_back(semaphore);
+		_waitValues.push_back(value);
+		_waitStages.push_back(dstStage);
+	}
 }
\ No newline at end of file
@@ -2,11 +2,15 @@
 #include <Core/Context.hpp>
 #include <Backend/Vulkan/Wrapper.hpp>
 #include <Backend/Shared/Context.hpp>
+#include <deque>
+#include <mutex>
+#include <vector>
 #include <vulkan/vulkan.h>
 
 namespace MMPEngine::Backend::Vulkan
 {
 	class DeviceMemoryHeap;
+	class DeviceMemoryBudget;
 	class DescriptorPool;
 
 	class GlobalContext : public Core::GlobalContext
@@ -17,10 +21,15 @@ namespace MMPEngine::Backend::Vulkan
 		std::shared_ptr<Wrapper::Instance> instance;
 		std::shared_ptr<Wrapper::Device> device;
 
+		std::shared_ptr<Wrapper::Queue> graphicsQueue;
+		std::shared_ptr<Wrapper::Queue> computeQueue;
+		std::shared_ptr<Wrapper::Queue> transferQueue;
+
 		std::shared_ptr<DeviceMemoryHeap> uploadBufferHeap;
 		std::shared_ptr<DeviceMemoryHeap> readBackBufferHeap;
 		std::shared_ptr<DeviceMemoryHeap> residentBufferHeap;
 		std::shared_ptr<DeviceMemoryHeap> uniformBufferHeap;
+		std::shared_ptr<DeviceMemoryBudget> memoryBudget;
 		std::shared_ptr<DescriptorPool> descriptorPool;
 	};
 
@@ -36,8 +45,40 @@ namespace MMPEngine::Backend::Vulkan
 			const std::shared_ptr<Wrapper::Queue>& queue,
 			const std::shared_ptr<Wrapper::CommandAllocator>& allocator,
 			const std::shared_ptr<Wrapper::CommandBuffer>& cmdBuffer,
-			const std::shared_ptr<Wrapper::Fence>& fence
+			const std::shared_ptr<Wrapper::Fence>& fence,
+			const std::shared_ptr<Wrapper::Semaphore>& timelineSemaphore,
+			const std::shared_ptr<Wrapper::CommandAllocator>& releaseAllocator
 		);
 		std::shared_ptr<Wrapper::CommandBuffer>& PopulateCommandsInBuffer() override;
+
+		const std::shared_ptr<Wrapper::Semaphore>& GetTimelineSemaphore() const;
+		std::uint64_t GetTimelineValue() const;
+		bool HasUnsubmittedCommands() const;
+		std::unique_lock<std::mutex> LockQueue() const;
+
+		void WaitFor(const std::shared_ptr<StreamContext>& producer, VkPipelineStageFlags dstStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+		void AcquireOwnership(const std::shared_ptr<StreamContext>& owner, const VkBufferMemoryBarrier& release);
+		void AcquireOwnership(const std::shared_ptr<StreamContext>& owner, const VkImageMemoryBarrier& release);
+
+		std::uint64_t IncrementTimelineValue(PassControl);
+		const std::vector<VkSemaphore>& GetWaitSemaphores(PassControl) const;
+		const std::vector<std::uint64_t>& GetWaitValues(PassControl) const;
+		const std::vector<VkPipelineStageFlags>& GetWaitStages(PassControl) const;
+		void ClearWaits(PassControl);
+
+	private:
+		void AddWait(VkSemaphore semaphore, std::uint64_t value, VkPipelineStageFlags dstStage);
+		std::uint64_t SubmitRelease(const VkBufferMemoryBarrier* bufferRelease, const VkImageMemoryBarrier* imageRelease);
+
+		std::shared_ptr<Wrapper::Semaphore> _timelineSemaphore;
+		std::uint64_t _timelineValue = 0;
+
+		std::vector<VkSemaphore> _waitSemaphores;
+		std::vector<std::uint64_t> _waitValues;
+		std::vector<VkPipelineStageFlags> _waitStages;
+
+		mutable std::mutex _queueMutex;
+		std::shared_ptr<Wrapper::CommandAllocator> _releaseAllocator;
+		std::deque<std::pair<std::uint64_t, std::shared_ptr<Wrapper::CommandBuffer>>> _releaseCmdBuffers;
 	};
 }
\ No newline at end of file
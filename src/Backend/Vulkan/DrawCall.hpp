@@ -217,19 +217,18 @@ namespace MMPEngine::Backend::Vulkan
 		if constexpr (std::is_base_of_v<Core::MeshMaterial, TCoreMaterial>)
 		{
 			const auto& ibInfo = ctx->renderer->GetIndexBufferPointer();
-			drawCallsJob->GetMemoryBarrierTasks(pc).push_back(ibInfo->CreateMemoryBarrierTask(
-				VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT,
-				VK_ACCESS_INDEX_READ_BIT
-			));
+			drawCallsJob->GetMemoryBarrierTasks(pc).push_back(ibInfo->CreateMemoryBarrierTask(VK_ACCESS_INDEX_READ_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT));
 
 			const auto& allVertexBuffers = ctx->renderer->GetVertexBufferPointers();
 
 			for (const auto& vb : allVertexBuffers)
 			{
-				drawCallsJob->GetMemoryBarrierTasks(pc).push_back(vb->CreateMemoryBarrierTask(
-					VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT,
-					VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT
-				));
+				drawCallsJob->GetMemoryBarrierTasks(pc).push_back(vb->CreateMemoryBarrierTask(VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT));
+			}
+
+			if (const auto& argumentsBuffer = ctx->renderer->GetIndirectArgumentsBufferPointer())
+			{
+				drawCallsJob->GetMemoryBarrierTasks(pc).push_back(argumentsBuffer->CreateMemoryBarrierTask(VK_ACCESS_INDIRECT_COMMAND_READ_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT));
 			}
 		}
 
@@ -609,6 +608,8 @@ namespace MMPEngine::Backend::Vulkan
 
 		const auto tc = this->GetTaskContext();
 
+		tc->job->UpdateRelocatedBindings();
+
 		vkCmdBindPipeline(this->_specificStreamContext->PopulateCommandsInBuffer()->GetNative(), VK_PIPELINE_BIND_POINT_GRAPHICS, tc->job->_pipeline);
 
 		if constexpr (std::is_base_of_v<Core::MeshMaterial, TCoreMaterial>)
@@ -639,6 +640,18 @@ namespace MMPEngine::Backend::Vulkan
 				nullptr
 			);
 
+			if (const auto& argumentsBuffer = tc->renderer->GetIndirectArgumentsBufferPointer())
+			{
+				vkCmdDrawIndexedIndirect(
+					this->_specificStreamContext->PopulateCommandsInBuffer()->GetNative(),
+					argumentsBuffer->GetDescriptorBufferInfo().buffer,
+					0,
+					1,
+					sizeof(VkDrawIndexedIndirectCommand)
+				);
+				return;
+			}
+
 			const auto& subsets = tc->renderer->GetMesh()->GetSubsets();
 
 			for (const auto& ss : subsets)
@@ -647,8 +660,8 @@ namespace MMPEngine::Backend::Vulkan
 					this->_specificStreamContext->PopulateCommandsInBuffer()->GetNative(), 
 					ss.indexCount,
 					static_cast<std::uint32_t>(tc->renderer->GetSettings().dynamicData.instancesCount),
-					ss.indexStart, 
-					ss.baseVertex, 
+					ss.indexStart + tc->renderer->GetIndexStart(), 
+					static_cast<std::int32_t>(ss.baseVertex + tc->renderer->GetBaseVertex()), 
 					0
 				);
 			}
@@ -22,5 +22,6 @@ namespace MMPEngine::Backend::Vulkan
 	protected:
 		DeviceMemoryHeap::Handle _deviceMemoryHeapHandle;
 		std::optional<std::uint32_t> _queueFamilyIndexOwnerShip = std::nullopt;
+		std::weak_ptr<StreamContext> _queueOwnerStreamContext;
 	};
 }
\ No newline at end of file
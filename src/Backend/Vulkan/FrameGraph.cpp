@@ -0,0 +1,257 @@
+#include <Backend/Vulkan/FrameGraph.hpp>
+#include <cassert>
+
+namespace MMPEngine::Backend::Vulkan
+{
+	FrameGraphJob::FrameGraphJob(const std::shared_ptr<Core::FrameGraph>& graph) : Core::FrameGraphJob(graph)
+	{
+	}
+
+	FrameGraphJob::~FrameGraphJob() = default;
+
+	VkPipelineStageFlags FrameGraphJob::GetNativeStageFlags(Core::FrameGraph::StageFlags stage)
+	{
+		using Stage = Core::FrameGraph::Stage;
+
+		VkPipelineStageFlags flags = 0;
+
+		if (stage & Stage::kHost)
+		{
+			flags |= VK_PIPELINE_STAGE_HOST_BIT;
+		}
+
+		if (stage & Stage::kTransfer)
+		{
+			flags |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+		}
+
+		if (stage & Stage::kDrawIndirect)
+		{
+			flags |= VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+		}
+
+		if (stage & Stage::kVertexInput)
+		{
+			flags |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+		}
+
+		if (stage & Stage::kVertexShader)
+		{
+			flags |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+		}
+
+		if (stage & Stage::kFragmentShader)
+		{
+			flags |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+		}
+
+		if (stage & Stage::kComputeShader)
+		{
+			flags |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+		}
+
+		return flags;
+	}
+
+	VkAccessFlags FrameGraphJob::GetNativeAccessFlags(Core::FrameGraph::AccessFlags access)
+	{
+		using Access = Core::FrameGraph::Access;
+
+		VkAccessFlags flags = 0;
+
+		if (access & Access::kIndirectRead)
+		{
+			flags |= VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+		}
+
+		if (access & Access::kIndexRead)
+		{
+			flags |= VK_ACCESS_INDEX_READ_BIT;
+		}
+
+		if (access & Access::kVertexRead)
+		{
+			flags |= VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+		}
+
+		if (access & Access::kUniformRead)
+		{
+			flags |= VK_ACCESS_UNIFORM_READ_BIT;
+		}
+
+		if (access & Access::kShaderRead)
+		{
+			flags |= VK_ACCESS_SHADER_READ_BIT;
+		}
+
+		if (access & Access::kShaderWrite)
+		{
+			flags |= VK_ACCESS_SHADER_WRITE_BIT;
+		}
+
+		if (access & Access::kTransferRead)
+		{
+			flags |= VK_ACCESS_TRANSFER_READ_BIT;
+		}
+
+		if (access & Access::kTransferWrite)
+		{
+			flags |= VK_ACCESS_TRANSFER_WRITE_BIT;
+		}
+
+		if (access & Access::kHostRead)
+		{
+			flags |= VK_ACCESS_HOST_READ_BIT;
+		}
+
+		if (access & Access::kHostWrite)
+		{
+			flags |= VK_ACCESS_HOST_WRITE_BIT;
+		}
+
+		return flags;
+	}
+
+	std::shared_ptr<Core::Buffer> FrameGraphJob::CreateTransientArena(std::size_t byteLength)
+	{
+		constexpr auto stride = sizeof(std::uint32_t);
+		return std::make_shared<UnorderedAccessBuffer>(Core::BaseUnorderedAccessBuffer::Settings {
+			stride,
+			(byteLength + stride - 1) / stride,
+			"FrameGraph.TransientArena"
+		});
+	}
+
+	std::shared_ptr<Vulkan::Buffer> FrameGraphJob::GetBuffer(const Core::FrameGraph& graph, Core::FrameGraph::ResourceId resource)
+	{
+		const auto buffer = graph.IsTransient(resource) ? graph.GetTransientArena() : graph.GetImportedBuffer(resource);
+		assert(buffer);
+		return std::dynamic_pointer_cast<Vulkan::Buffer>(buffer->GetUnderlyingBuffer());
+	}
+
+	std::shared_ptr<Core::BaseTask> FrameGraphJob::CreateBarrierTask(const Core::FrameGraph::CompiledPass& pass)
+	{
+		const auto ctx = std::make_shared<BarrierTaskContext>();
+		ctx->graph = _graph;
+		ctx->pass = pass;
+		return std::make_shared<BarrierTask>(ctx);
+	}
+
+	std::shared_ptr<Core::BaseTask> FrameGraphJob::CreateCompletionTask()
+	{
+		const auto ctx = std::make_shared<CompletionTaskContext>();
+		ctx->graph = _graph;
+		return std::make_shared<CompletionTask>(ctx);
+	}
+
+	FrameGraphJob::BarrierTask::BarrierTask(const std::shared_ptr<BarrierTaskContext>& ctx) : Task(ctx)
+	{
+	}
+
+	void FrameGraphJob::BarrierTask::Run(const std::shared_ptr<Core::BaseStream>& stream)
+	{
+		Task::Run(stream);
+
+		const auto tc = GetTaskContext();
+		const auto& graph = tc->graph;
+
+		VkPipelineStageFlags srcStage = 0;
+		VkPipelineStageFlags dstStage = 0;
+		std::vector<VkBufferMemoryBarrier> bufferBarriers {};
+
+		const auto addBarrier = [&](const std::shared_ptr<Vulkan::Buffer>& buffer, VkPipelineStageFlags src, VkAccessFlags srcAccess, VkPipelineStageFlags dst, VkAccessFlags dstAccess, VkDeviceSize offset, VkDeviceSize size)
+		{
+			VkBufferMemoryBarrier b {};
+			b.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+			b.pNext = nullptr;
+			b.srcAccessMask = srcAccess;
+			b.dstAccessMask = dstAccess;
+			b.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			b.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			b.buffer = buffer->GetDescriptorBufferInfo().buffer;
+			b.offset = offset;
+			b.size = size;
+
+			srcStage |= src;
+			dstStage |= dst;
+			bufferBarriers.push_back(b);
+		};
+
+		for (const auto& usage : tc->pass.usages)
+		{
+			const auto buffer = GetBuffer(*graph, usage.resource);
+			assert(buffer);
+			buffer->_frameGraphBarriers = true;
+
+			if (graph->IsTransient(usage.resource))
+			{
+				continue;
+			}
+
+			const auto stage = GetNativeStageFlags(usage.stage);
+			VkPipelineStageFlags src = 0;
+
+			if (const auto barrier = buffer->TrackAccess(_specificStreamContext, stage, GetNativeAccessFlags(usage.access), src))
+			{
+				srcStage |= src;
+				dstStage |= stage;
+				bufferBarriers.push_back(barrier.value());
+			}
+		}
+
+		for (const auto& barrier : tc->pass.barriers)
+		{
+			if (!graph->IsTransient(barrier.resource))
+			{
+				continue;
+			}
+
+			const auto& placement = graph->GetTransientPlacement(barrier.resource);
+			addBarrier(
+				GetBuffer(*graph, barrier.resource),
+				GetNativeStageFlags(barrier.srcStage),
+				GetNativeAccessFlags(barrier.srcAccess),
+				GetNativeStageFlags(barrier.dstStage),
+				GetNativeAccessFlags(barrier.dstAccess),
+				static_cast<VkDeviceSize>(placement.byteOffset),
+				static_cast<VkDeviceSize>(placement.byteLength)
+			);
+		}
+
+		if (bufferBarriers.empty())
+		{
+			return;
+		}
+
+		vkCmdPipelineBarrier(
+			_specificStreamContext->PopulateCommandsInBuffer()->GetNative(),
+			srcStage == 0 ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : srcStage,
+			dstStage == 0 ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : dstStage,
+			0,
+			0, nullptr,
+			static_cast<std::uint32_t>(bufferBarriers.size()), bufferBarriers.data(),
+			0, nullptr
+		);
+	}
+
+	FrameGraphJob::CompletionTask::CompletionTask(const std::shared_ptr<CompletionTaskContext>& ctx) : Task(ctx)
+	{
+	}
+
+	void FrameGraphJob::CompletionTask::Run(const std::shared_ptr<Core::BaseStream>& stream)
+	{
+		Task::Run(stream);
+
+		const auto& graph = GetTaskContext()->graph;
+
+		for (Core::FrameGraph::ResourceId resource = 0; resource < graph->GetResourcesCount(); ++resource)
+		{
+			if (graph->IsTransient(resource) && !graph->GetTransientArena())
+			{
+				continue;
+			}
+
+			GetBuffer(*graph, resource)->_frameGraphBarriers = false;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#include <Core/FrameGraph.hpp>
+#include <Backend/Vulkan/Task.hpp>
+#include <Backend/Vulkan/Buffer.hpp>
+
+namespace MMPEngine::Backend::Vulkan
+{
+	class FrameGraphJob final : public Core::FrameGraphJob
+	{
+	private:
+		class BarrierTaskContext final : public Core::TaskContext
+		{
+		public:
+			std::shared_ptr<Core::FrameGraph> graph;
+			Core::FrameGraph::CompiledPass pass;
+		};
+
+		class BarrierTask final : public Task<BarrierTaskContext>
+		{
+		public:
+			BarrierTask(const std::shared_ptr<BarrierTaskContext>& ctx);
+		protected:
+			void Run(const std::shared_ptr<Core::BaseStream>& stream) override;
+		};
+
+		class CompletionTaskContext final : public Core::TaskContext
+		{
+		public:
+			std::shared_ptr<Core::FrameGraph> graph;
+		};
+
+		class CompletionTask final : public Task<CompletionTaskContext>
+		{
+		public:
+			CompletionTask(const std::shared_ptr<CompletionTaskContext>& ctx);
+		protected:
+			void Run(const std::shared_ptr<Core::BaseStream>& stream) override;
+		};
+
+		static std::shared_ptr<Vulkan::Buffer> GetBuffer(const Core::FrameGraph& graph, Core::FrameGraph::ResourceId resource);
+
+	public:
+		FrameGraphJob(const std::shared_ptr<Core::FrameGraph>& graph);
+		FrameGraphJob(const FrameGraphJob&) = delete;
+		FrameGraphJob(FrameGraphJob&&) noexcept = delete;
+		FrameGraphJob& operator=(const FrameGraphJob&) = delete;
+		FrameGraphJob& operator=(FrameGraphJob&&) noexcept = delete;
+		~FrameGraphJob() override;
+
+		static VkPipelineStageFlags GetNativeStageFlags(Core::FrameGraph::StageFlags stage);
+		static VkAccessFlags GetNativeAccessFlags(Core::FrameGraph::AccessFlags access);
+	protected:
+		std::shared_ptr<Core::Buffer> CreateTransientArena(std::size_t byteLength) override;
+		std::shared_ptr<Core::BaseTask> CreateBarrierTask(const Core::FrameGraph::CompiledPass& pass) override;
+		std::shared_ptr<Core::BaseTask> CreateCompletionTask() override;
+	};
+}
@@ -9,8 +9,76 @@ namespace MMPEngine::Backend::Vulkan
 	DeviceMemoryHeap::Handle DeviceMemoryHeap::Allocate(const Request& request)
 	{
 		const auto entry = AllocateEntry(request);
-		const auto block = dynamic_cast<Block*>(_blocks[entry.blockIndex].get());
-		return { shared_from_this(), entry, block->GetEntityBlock() };
+		return { shared_from_this(), entry, GetEntityBlock(entry.blockIndex) };
+	}
+
+	DeviceMemoryHeap::Handle DeviceMemoryHeap::AllocateDedicated(const Request& request, VkBuffer buffer)
+	{
+		const auto entry = AllocateDedicatedEntry(std::make_unique<Block>(DeviceMemoryBlock::Settings {request.size, _includeFlags, _excludeFlags, buffer}), request);
+		return { shared_from_this(), entry, GetEntityBlock(entry.blockIndex) };
+	}
+
+	std::shared_ptr<DeviceMemoryBlock> DeviceMemoryHeap::GetEntityBlock(std::size_t blockIndex) const
+	{
+		return std::dynamic_pointer_cast<DeviceMemoryBlock>(GetBlockEntity(blockIndex));
+	}
+
+	std::shared_ptr<Core::BaseTask> DeviceMemoryHeap::CreateRelocationTask(const std::vector<Relocation>& relocations)
+	{
+		const auto ctx = std::make_shared<RelocationTaskContext>();
+		ctx->copies.reserve(relocations.size());
+
+		for (const auto& relocation : relocations)
+		{
+			ctx->copies.push_back({
+				GetEntityBlock(relocation.from.blockIndex),
+				GetEntityBlock(relocation.to.blockIndex),
+				VkBufferCopy {
+					static_cast<VkDeviceSize>(relocation.from.range.from),
+					static_cast<VkDeviceSize>(relocation.to.range.from),
+					static_cast<VkDeviceSize>(relocation.from.range.GetLength())
+				}
+			});
+		}
+
+		return std::make_shared<RelocationTask>(ctx);
+	}
+
+	void DeviceMemoryHeap::OnHandleRelocated(Core::Heap::Handle& handle)
+	{
+		Core::Heap::OnHandleRelocated(handle);
+
+		auto& specificHandle = static_cast<Handle&>(handle);
+		specificHandle._deviceMemoryBlock = GetEntityBlock(specificHandle._entry->blockIndex);
+	}
+
+	DeviceMemoryHeap::RelocationTask::RelocationTask(const std::shared_ptr<RelocationTaskContext>& ctx) : Task<MMPEngine::Backend::Vulkan::DeviceMemoryHeap::RelocationTaskContext>(ctx)
+	{
+	}
+
+	void DeviceMemoryHeap::RelocationTask::Run(const std::shared_ptr<Core::BaseStream>& stream)
+	{
+		Task::Run(stream);
+
+		const auto commandBuffer = _specificStreamContext->PopulateCommandsInBuffer()->GetNative();
+
+		VkMemoryBarrier barrier {};
+		barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		barrier.pNext = nullptr;
+		barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+		for (const auto& copy : GetTaskContext()->copies)
+		{
+			vkCmdCopyBuffer(commandBuffer, copy.src->GetTransferBuffer(), copy.dst->GetTransferBuffer(), 1, &copy.region);
+		}
+
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
 	}
 
 
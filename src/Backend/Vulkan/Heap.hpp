@@ -34,9 +34,35 @@ namespace MMPEngine::Backend::Vulkan
 
 		DeviceMemoryHeap(const Settings& settings, VkMemoryPropertyFlagBits includeFlags, VkMemoryPropertyFlagBits excludeFlags);
 		Handle Allocate(const Request& request);
+		Handle AllocateDedicated(const Request& request, VkBuffer buffer);
 	protected:
 		std::unique_ptr<Heap::Block> InstantiateBlock(std::size_t size) override;
+		std::shared_ptr<Core::BaseTask> CreateRelocationTask(const std::vector<Relocation>& relocations) override;
+		void OnHandleRelocated(Core::Heap::Handle& handle) override;
 	private:
+		class RelocationTaskContext final : public Core::TaskContext
+		{
+		public:
+			struct Copy final
+			{
+				std::shared_ptr<DeviceMemoryBlock> src;
+				std::shared_ptr<DeviceMemoryBlock> dst;
+				VkBufferCopy region;
+			};
+
+			std::vector<Copy> copies;
+		};
+
+		class RelocationTask final : public Task<RelocationTaskContext>
+		{
+		public:
+			RelocationTask(const std::shared_ptr<RelocationTaskContext>& ctx);
+		protected:
+			void Run(const std::shared_ptr<Core::BaseStream>& stream) override;
+		};
+
+		std::shared_ptr<DeviceMemoryBlock> GetEntityBlock(std::size_t blockIndex) const;
+
 		VkMemoryPropertyFlagBits _includeFlags;
 		VkMemoryPropertyFlagBits _excludeFlags;
 	};
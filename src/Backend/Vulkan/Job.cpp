@@ -95,7 +95,6 @@ namespace MMPEngine::Backend::Vulkan
 					writeSet.dstArrayElement = 0;
 					writeSet.descriptorCount = 1;
 
-					VkAccessFlags srcAccess = 0;
 					VkAccessFlags dstAccess = 0;
 
 					if (std::holds_alternative<Core::BaseMaterial::Parameters::Buffer>(ev.entryPtr->settings))
@@ -104,7 +103,6 @@ namespace MMPEngine::Backend::Vulkan
 						{
 							writeSet.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 
-							srcAccess = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
 							dstAccess = VK_ACCESS_UNIFORM_READ_BIT;
 						}
 						else
@@ -113,12 +111,10 @@ namespace MMPEngine::Backend::Vulkan
 
 							if (std::dynamic_pointer_cast<const Core::BaseUnorderedAccessBuffer>(ev.entryPtr->entity))
 							{
-								srcAccess = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT;
 								dstAccess = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
 							}
 							else
 							{
-								srcAccess = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
 								dstAccess = VK_ACCESS_SHADER_READ_BIT;
 							}
 						}
@@ -128,7 +124,8 @@ namespace MMPEngine::Backend::Vulkan
 						const auto& castedBufferInfo = castedBuffer->GetDescriptorBufferInfo();
 
 						writeSet.pBufferInfo = &castedBufferInfo;
-						_memoryBarrierTasks.push_back(const_cast<Buffer*>(castedBuffer.get())->CreateMemoryBarrierTask(srcAccess, dstAccess));
+						_bufferBindings.push_back({ writeSet.dstSet, writeSet.dstBinding, writeSet.descriptorType, castedBuffer, castedBuffer->GetRelocationVersion() });
+						_memoryBarrierTasks.push_back(const_cast<Buffer*>(castedBuffer.get())->CreateMemoryBarrierTask(dstAccess, GetPipelineStageFlags()));
 					}
 					else
 					{
@@ -152,8 +149,9 @@ namespace MMPEngine::Backend::Vulkan
 							counterWs.descriptorCount = 1;
 							counterWs.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
 
-							const auto& counterBufferDescInfo = castedCounteredUaBuffer->GetCounterBuffer()->GetDescriptorBufferInfo();
-							counterWs.pBufferInfo = &counterBufferDescInfo;
+							const auto counterBuffer = castedCounteredUaBuffer->GetCounterBuffer();
+							counterWs.pBufferInfo = &counterBuffer->GetDescriptorBufferInfo();
+							_bufferBindings.push_back({ counterWs.dstSet, counterWs.dstBinding, counterWs.descriptorType, counterBuffer, counterBuffer->GetRelocationVersion() });
 
 							writeSets.push_back(counterWs);
 						}
@@ -215,6 +213,38 @@ namespace MMPEngine::Backend::Vulkan
 		assert(_pipelineLayout);
 	}
 	
+	void BaseJob::UpdateRelocatedBindings()
+	{
+		std::vector<VkWriteDescriptorSet> writeSets;
+
+		for (auto& binding : _bufferBindings)
+		{
+			if (binding.relocationVersion == binding.buffer->GetRelocationVersion())
+			{
+				continue;
+			}
+
+			binding.relocationVersion = binding.buffer->GetRelocationVersion();
+
+			VkWriteDescriptorSet writeSet {};
+			writeSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			writeSet.pNext = nullptr;
+			writeSet.dstSet = binding.set;
+			writeSet.dstBinding = binding.binding;
+			writeSet.dstArrayElement = 0;
+			writeSet.descriptorCount = 1;
+			writeSet.descriptorType = binding.type;
+			writeSet.pBufferInfo = &binding.buffer->GetDescriptorBufferInfo();
+
+			writeSets.push_back(writeSet);
+		}
+
+		if (!writeSets.empty())
+		{
+			vkUpdateDescriptorSets(_device->GetNativeLogical(), static_cast<std::uint32_t>(writeSets.size()), writeSets.data(), 0, nullptr);
+		}
+	}
+
 	BaseJob::MemBarriersTask::MemBarriersTask(const std::shared_ptr<TaskContext>& context) : Task<TaskContext>(context)
 	{
 	}
@@ -243,4 +273,16 @@ namespace MMPEngine::Backend::Vulkan
 	{
 		return VK_SHADER_STAGE_ALL_GRAPHICS;
 	}
+
+	template<>
+	VkPipelineStageFlags Job<Core::ComputeMaterial>::GetPipelineStageFlags() const
+	{
+		return VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+	}
+
+	template<>
+	VkPipelineStageFlags Job<Core::MeshMaterial>::GetPipelineStageFlags() const
+	{
+		return VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+	}
 }
@@ -7,6 +7,8 @@
 
 namespace MMPEngine::Backend::Vulkan
 {
+	class Buffer;
+
 	class BaseJob
 	{
 	public:
@@ -20,9 +22,21 @@ namespace MMPEngine::Backend::Vulkan
 		virtual	~BaseJob();
 
 		void PrepareMaterialParameters(const std::shared_ptr<GlobalContext>& globalContext, const Core::BaseMaterial::Parameters& params);
+		void UpdateRelocatedBindings();
 		virtual VkShaderStageFlags GetStageFlags() const = 0;
+		virtual VkPipelineStageFlags GetPipelineStageFlags() const = 0;
+
+		struct BufferBinding final
+		{
+			VkDescriptorSet set;
+			std::uint32_t binding;
+			VkDescriptorType type;
+			std::shared_ptr<const Buffer> buffer;
+			std::uint64_t relocationVersion;
+		};
 
 		std::vector<std::shared_ptr<Core::BaseTask>> _memoryBarrierTasks;
+		std::vector<BufferBinding> _bufferBindings;
 		std::vector<DescriptorPool::Allocation> _setAllocations;
 		std::vector<VkDescriptorSet> _sets;
 		VkPipelineLayout _pipelineLayout = VK_NULL_HANDLE;
@@ -49,12 +63,17 @@ namespace MMPEngine::Backend::Vulkan
 		static_assert(std::is_base_of_v<Core::BaseMaterial, TCoreMaterial>, "TCoreMaterial must be derived from Core::BaseMaterial");
 	protected:
 		VkShaderStageFlags GetStageFlags() const override;
+		VkPipelineStageFlags GetPipelineStageFlags() const override;
 	};
 
 	template<>
 	VkShaderStageFlags Job<Core::ComputeMaterial>::GetStageFlags() const;
 	template<>
 	VkShaderStageFlags Job<Core::MeshMaterial>::GetStageFlags() const;
+	template<>
+	VkPipelineStageFlags Job<Core::ComputeMaterial>::GetPipelineStageFlags() const;
+	template<>
+	VkPipelineStageFlags Job<Core::MeshMaterial>::GetPipelineStageFlags() const;
 
 	template<typename TCoreMaterial>
 	inline VkShaderStageFlags Job<TCoreMaterial>::GetStageFlags() const
@@ -62,5 +81,11 @@ namespace MMPEngine::Backend::Vulkan
 		return VK_SHADER_STAGE_ALL;
 	}
 
+	template<typename TCoreMaterial>
+	inline VkPipelineStageFlags Job<TCoreMaterial>::GetPipelineStageFlags() const
+	{
+		return VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+	}
+
 
 }
\ No newline at end of file
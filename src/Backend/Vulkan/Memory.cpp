@@ -1,15 +1,24 @@
 #include <Backend/Vulkan/Memory.hpp>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <optional>
 
 namespace MMPEngine::Backend::Vulkan
 {
+	std::atomic<std::uint32_t> DeviceMemoryBlock::_allocationsCount { 0 };
+
 	DeviceMemoryBlock::DeviceMemoryBlock(const Settings& settings) : _settings(settings), _deviceMem(VK_NULL_HANDLE)
 	{
 	}
 
 	DeviceMemoryBlock::~DeviceMemoryBlock()
 	{
+		if (_transferBuffer && _device)
+		{
+			vkDestroyBuffer(_device->GetNativeLogical(), _transferBuffer, nullptr);
+		}
+
 		if(_hostMem && _device)
 		{
 			vkUnmapMemory(_device->GetNativeLogical(), _deviceMem);
@@ -18,6 +27,7 @@ namespace MMPEngine::Backend::Vulkan
 		if(_deviceMem && _device)
 		{
 			vkFreeMemory(_device->GetNativeLogical(), _deviceMem, nullptr);
+			--_allocationsCount;
 		}
 	}
 
@@ -31,6 +41,33 @@ namespace MMPEngine::Backend::Vulkan
 		return _hostMem;
 	}
 
+	VkBuffer DeviceMemoryBlock::GetTransferBuffer()
+	{
+		if (!_transferBuffer)
+		{
+			assert(_device);
+			assert(_deviceMem);
+
+			VkBufferCreateInfo bufferInfo {};
+			bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+			bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+			bufferInfo.size = static_cast<VkDeviceSize>(_settings.byteSize);
+			bufferInfo.pNext = nullptr;
+			bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+			bufferInfo.pQueueFamilyIndices = nullptr;
+			bufferInfo.queueFamilyIndexCount = 0;
+			bufferInfo.flags = 0;
+
+			const auto createRes = vkCreateBuffer(_device->GetNativeLogical(), &bufferInfo, nullptr, &_transferBuffer);
+			assert(createRes == VK_SUCCESS);
+
+			const auto bindRes = vkBindBufferMemory(_device->GetNativeLogical(), _transferBuffer, _deviceMem, 0);
+			assert(bindRes == VK_SUCCESS);
+		}
+
+		return _transferBuffer;
+	}
+
 	std::optional<std::uint32_t> DeviceMemoryBlock::FindMemoryType(VkPhysicalDevice physicalDevice, VkMemoryPropertyFlagBits includeFlags, VkMemoryPropertyFlagBits excludeFlags)
 	{
 		VkPhysicalDeviceMemoryProperties memProps{};
@@ -52,6 +89,26 @@ namespace MMPEngine::Backend::Vulkan
 		return std::nullopt;
 	}
 
+	std::size_t DeviceMemoryBlock::GetPreferredBlockSize(VkPhysicalDevice physicalDevice, VkMemoryPropertyFlagBits includeFlags, VkMemoryPropertyFlagBits excludeFlags)
+	{
+		constexpr std::size_t largeHeapBlockSize = 256 * 1024 * 1024;
+		constexpr std::size_t heapFraction = 8;
+
+		const auto memoryTypeIndex = FindMemoryType(physicalDevice, includeFlags, excludeFlags);
+		assert(memoryTypeIndex.has_value());
+
+		VkPhysicalDeviceMemoryProperties memProps{};
+		vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProps);
+
+		const auto heapSize = static_cast<std::size_t>(memProps.memoryHeaps[memProps.memoryTypes[memoryTypeIndex.value()].heapIndex].size);
+		return (std::min)(heapSize / heapFraction, largeHeapBlockSize);
+	}
+
+	std::uint32_t DeviceMemoryBlock::GetAllocationsCount()
+	{
+		return _allocationsCount.load();
+	}
+
 
 	DeviceMemoryBlock::InitTask::InitTask(const std::shared_ptr<InitTaskContext>& ctx) : Task<MMPEngine::Backend::Vulkan::DeviceMemoryBlock::InitTaskContext>(ctx)
 	{
@@ -68,6 +125,17 @@ namespace MMPEngine::Backend::Vulkan
 		info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
 		info.pNext = nullptr;
 
+		VkMemoryDedicatedAllocateInfo dedicatedInfo {};
+		dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+		dedicatedInfo.pNext = nullptr;
+		dedicatedInfo.buffer = entity->_settings.dedicatedBuffer;
+		dedicatedInfo.image = VK_NULL_HANDLE;
+
+		if (entity->_settings.dedicatedBuffer)
+		{
+			info.pNext = &dedicatedInfo;
+		}
+
 		const auto memoryTypeIndex = FindMemoryType(entity->_device->GetNativePhysical(), entity->_settings.includeFlags, entity->_settings.excludeFlags);
 		assert(memoryTypeIndex.has_value());
 		info.memoryTypeIndex = memoryTypeIndex.value();
@@ -75,6 +143,11 @@ namespace MMPEngine::Backend::Vulkan
 		const auto res = vkAllocateMemory(entity->_device->GetNativeLogical(), &info, nullptr, &entity->_deviceMem);
 		assert(res == VkResult::VK_SUCCESS);
 
+		VkPhysicalDeviceProperties deviceProps {};
+		vkGetPhysicalDeviceProperties(entity->_device->GetNativePhysical(), &deviceProps);
+		const auto allocationsCount = ++_allocationsCount;
+		assert(allocationsCount <= deviceProps.limits.maxMemoryAllocationCount);
+
 		if((entity->_settings.includeFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
 		{
 			const auto res = vkMapMemory(
@@ -96,4 +169,77 @@ namespace MMPEngine::Backend::Vulkan
 		return std::make_shared<InitTask>(ctx);
 	}
 
+
+	DeviceMemoryBudget::DeviceMemoryBudget(const Settings& settings, const std::shared_ptr<Wrapper::Device>& device, bool extensionEnabled)
+		: _settings(settings), _device(device), _extensionEnabled(extensionEnabled)
+	{
+		Update();
+	}
+
+	DeviceMemoryBudget::~DeviceMemoryBudget() = default;
+
+	bool DeviceMemoryBudget::IsExtensionSupported(VkPhysicalDevice physicalDevice)
+	{
+		std::uint32_t extensionsCount = 0;
+		vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionsCount, nullptr);
+
+		std::vector<VkExtensionProperties> extensions { extensionsCount };
+		vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionsCount, extensions.data());
+
+		return std::any_of(extensions.cbegin(), extensions.cend(), [](const auto& extension) {
+			return std::strcmp(extension.extensionName, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) == 0;
+		});
+	}
+
+	void DeviceMemoryBudget::Update()
+	{
+		VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProps {};
+		budgetProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+		budgetProps.pNext = nullptr;
+
+		VkPhysicalDeviceMemoryProperties2 memProps {};
+		memProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+		memProps.pNext = _extensionEnabled ? &budgetProps : nullptr;
+
+		vkGetPhysicalDeviceMemoryProperties2(_device->GetNativePhysical(), &memProps);
+
+		const auto heapsCount = memProps.memoryProperties.memoryHeapCount;
+		_heaps.resize(heapsCount);
+		_nearBudget.resize(heapsCount, false);
+
+		for (std::uint32_t i = 0; i < heapsCount; ++i)
+		{
+			auto& heap = _heaps[i];
+			heap.flags = memProps.memoryProperties.memoryHeaps[i].flags;
+			heap.budget = _extensionEnabled ? budgetProps.heapBudget[i] : memProps.memoryProperties.memoryHeaps[i].size;
+			heap.usage = _extensionEnabled ? budgetProps.heapUsage[i] : 0;
+
+			const auto nearBudget = heap.budget > 0 && static_cast<float>(heap.usage) >= static_cast<float>(heap.budget) * _settings.warningThreshold;
+
+			if (nearBudget && !_nearBudget[i])
+			{
+				for (const auto& callback : _callbacks)
+				{
+					callback(i, heap);
+				}
+			}
+
+			_nearBudget[i] = nearBudget;
+		}
+	}
+
+	void DeviceMemoryBudget::AddCallback(Callback&& callback)
+	{
+		_callbacks.push_back(std::move(callback));
+	}
+
+	bool DeviceMemoryBudget::IsExtensionEnabled() const
+	{
+		return _extensionEnabled;
+	}
+
+	const std::vector<DeviceMemoryBudget::HeapBudget>& DeviceMemoryBudget::GetHeaps() const
+	{
+		return _heaps;
+	}
 }
@@ -1,5 +1,8 @@
 #pragma once
+#include <atomic>
+#include <functional>
 #include <optional>
+#include <vector>
 #include <Core/Entity.hpp>
 #include <Backend/Vulkan/Task.hpp>
 #include <Backend/Vulkan/Wrapper.hpp>
@@ -14,6 +17,7 @@ namespace MMPEngine::Backend::Vulkan
 			std::size_t byteSize;
 			VkMemoryPropertyFlagBits includeFlags = VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_FLAG_BITS_MAX_ENUM;
 			VkMemoryPropertyFlagBits excludeFlags = VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_FLAG_BITS_MAX_ENUM;
+			VkBuffer dedicatedBuffer = VK_NULL_HANDLE;
 		};
 
 		DeviceMemoryBlock(const Settings&);
@@ -24,13 +28,18 @@ namespace MMPEngine::Backend::Vulkan
 		~DeviceMemoryBlock() override;
 		std::shared_ptr<Core::BaseTask> CreateInitializationTask() override;
 		static std::optional<std::uint32_t> FindMemoryType(VkPhysicalDevice physicalDevice, VkMemoryPropertyFlagBits includeFlags, VkMemoryPropertyFlagBits excludeFlags);
+		static std::size_t GetPreferredBlockSize(VkPhysicalDevice physicalDevice, VkMemoryPropertyFlagBits includeFlags, VkMemoryPropertyFlagBits excludeFlags);
+		static std::uint32_t GetAllocationsCount();
 		VkDeviceMemory GetNative() const;
 		void* GetHost() const;
+		VkBuffer GetTransferBuffer();
 	private:
 		Settings _settings;
 		std::shared_ptr<Wrapper::Device> _device;
 		VkDeviceMemory _deviceMem;
+		VkBuffer _transferBuffer = VK_NULL_HANDLE;
 		void* _hostMem = nullptr;
+		static std::atomic<std::uint32_t> _allocationsCount;
 
 		class InitTaskContext final : public Core::EntityTaskContext<DeviceMemoryBlock>
 		{
@@ -44,4 +53,42 @@ namespace MMPEngine::Backend::Vulkan
 			void Run(const std::shared_ptr<Core::BaseStream>& stream) override;
 		};
 	};
-}
+
+	class DeviceMemoryBudget final
+	{
+	public:
+		struct Settings final
+		{
+			float warningThreshold = 0.9f;
+		};
+
+		struct HeapBudget final
+		{
+			VkDeviceSize budget = 0;
+			VkDeviceSize usage = 0;
+			VkMemoryHeapFlags flags = 0;
+		};
+
+		using Callback = std::function<void(std::uint32_t heapIndex, const HeapBudget& heapBudget)>;
+
+		DeviceMemoryBudget(const Settings& settings, const std::shared_ptr<Wrapper::Device>& device, bool extensionEnabled);
+		DeviceMemoryBudget(const DeviceMemoryBudget&) = delete;
+		DeviceMemoryBudget(DeviceMemoryBudget&&) noexcept = delete;
+		DeviceMemoryBudget& operator=(const DeviceMemoryBudget&) = delete;
+		DeviceMemoryBudget& operator=(DeviceMemoryBudget&&) noexcept = delete;
+		~DeviceMemoryBudget();
+
+		void Update();
+		void AddCallback(Callback&& callback);
+		bool IsExtensionEnabled() const;
+		const std::vector<HeapBudget>& GetHeaps() const;
+		static bool IsExtensionSupported(VkPhysicalDevice physicalDevice);
+	private:
+		Settings _settings;
+		std::shared_ptr<Wrapper::Device> _device;
+		bool _extensionEnabled;
+		std::vector<HeapBudget> _heaps;
+		std::vector<bool> _nearBudget;
+		std::vector<Callback> _callbacks;
+	};
+}
\ No newline at end of file
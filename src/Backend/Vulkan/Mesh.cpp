@@ -1,14 +1,15 @@
+#include <algorithm>
 #include <cassert>
 #include <Backend/Vulkan/Mesh.hpp>
 #include <Backend/Vulkan/Buffer.hpp>
 
 namespace MMPEngine::Backend::Vulkan
 {
-	Mesh::Mesh(Core::GeometryPrototype&& proto) : Core::Mesh(std::move(proto))
+	Mesh::Mesh(Core::GeometryPrototype&& proto, const Settings& settings) : Core::Mesh(std::move(proto), settings)
 	{
 	}
 
-	std::shared_ptr<Core::VertexBuffer> Mesh::CreateVertexBuffer(const Core::VertexBufferPrototype* vbPrototype)
+	std::shared_ptr<Core::VertexBuffer> Mesh::CreateVertexBuffer(const Core::BaseGeometryBufferPrototype* vbPrototype)
 	{
 		return std::make_shared<VertexBuffer>(Core::InputAssemblerBuffer::Settings{
 		{vbPrototype->GetDataPtr()}, {vbPrototype->GetByteLength()}
@@ -51,6 +52,11 @@ namespace MMPEngine::Backend::Vulkan
 
 	const std::vector<VkBuffer>& Mesh::Renderer::GetVertexBuffers() const
 	{
+		for (std::size_t i = 0; i < _vertexBuffers.size(); ++i)
+		{
+			_vertexBuffers[i] = _vertexBufferPointers[i]->GetDescriptorBufferInfo().buffer;
+		}
+
 		return _vertexBuffers;
 	}
 
@@ -78,6 +84,11 @@ namespace MMPEngine::Backend::Vulkan
 		return std::make_shared<UniformBuffer<Core::Mesh::Renderer::Data>>();
 	}
 
+	std::shared_ptr<Core::UniformBuffer<Core::Mesh::Renderer::AffineData>> Mesh::Renderer::CreateAffineUniformBuffer()
+	{
+		return std::make_shared<UniformBuffer<Core::Mesh::Renderer::AffineData>>();
+	}
+
 
 
 	Mesh::Renderer::InitTask::InitTask(const std::shared_ptr<InitTaskContext>& ctx) : Task(ctx)
@@ -92,28 +103,36 @@ namespace MMPEngine::Backend::Vulkan
 		assert(renderer);
 
 
-		std::uint32_t bindingIndex = 0;
+		std::uint32_t location = 0;
 
-		renderer->ForEachAvailableVertexAttributes([&bindingIndex, &renderer](const auto& vbInfo, const auto&)
+		renderer->ForEachAvailableVertexAttributes([&location, &renderer](const auto& vbInfo, const auto&)
 		{
 				const auto vb = std::dynamic_pointer_cast<Buffer>(vbInfo.ptr->GetUnderlyingBuffer());
 				assert(vb);
-				renderer->_vertexBuffers.push_back(vb->GetDescriptorBufferInfo().buffer);
-				renderer->_vertexBufferPointers.push_back(vb);
 
-				VkVertexInputBindingDescription binding{};
-				binding.binding = bindingIndex++;
-				binding.stride = static_cast<std::uint32_t>(vbInfo.stride);
-				binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+				const auto existing = std::find(renderer->_vertexBufferPointers.cbegin(), renderer->_vertexBufferPointers.cend(), vb);
+				auto bindingIndex = static_cast<std::uint32_t>(std::distance(renderer->_vertexBufferPointers.cbegin(), existing));
+
+				if (existing == renderer->_vertexBufferPointers.cend())
+				{
+					renderer->_vertexBuffers.push_back(vb->GetDescriptorBufferInfo().buffer);
+					renderer->_vertexBufferPointers.push_back(vb);
+
+					VkVertexInputBindingDescription binding{};
+					binding.binding = bindingIndex;
+					binding.stride = static_cast<std::uint32_t>(vbInfo.stride);
+					binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+					renderer->_bindingDescriptions.push_back(binding);
+				}
 
 				VkVertexInputAttributeDescription attrDesc{};
 
-				attrDesc.location = binding.binding;
-				attrDesc.binding = binding.binding;
-				attrDesc.offset = 0;
+				attrDesc.location = location++;
+				attrDesc.binding = bindingIndex;
+				attrDesc.offset = static_cast<std::uint32_t>(vbInfo.offset);
 				attrDesc.format = GetVertexBufferFormat(vbInfo.format);
 
-				renderer->_bindingDescriptions.push_back(binding);
 				renderer->_attributeDescriptions.push_back(attrDesc);
 		});
 
@@ -125,6 +144,20 @@ namespace MMPEngine::Backend::Vulkan
 
 		renderer->_indexType = (ibInfo.format == Core::IndexBufferPrototype::Format::Uint16) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
 		renderer->_indexBuffer = ib;
+
+		if (const auto& indirect = renderer->GetSettings().staticData.indirect; indirect.has_value())
+		{
+			renderer->_indexType = VK_INDEX_TYPE_UINT32;
+			renderer->_indexBuffer = std::dynamic_pointer_cast<Buffer>(indirect->indices->GetUnderlyingBuffer());
+			renderer->_indirectArgumentsBuffer = std::dynamic_pointer_cast<Buffer>(indirect->arguments->GetUnderlyingBuffer());
+			assert(renderer->_indexBuffer);
+			assert(renderer->_indirectArgumentsBuffer);
+		}
+	}
+
+	std::shared_ptr<Vulkan::Buffer> Mesh::Renderer::GetIndirectArgumentsBufferPointer() const
+	{
+		return _indirectArgumentsBuffer;
 	}
 
 
@@ -142,6 +175,24 @@ namespace MMPEngine::Backend::Vulkan
 			return VK_FORMAT_R32G32B32A32_SFLOAT;
 		case Core::VertexBufferPrototype::Format::Uint4:
 			return VK_FORMAT_R32G32B32A32_UINT;
+		case Core::VertexBufferPrototype::Format::Half2:
+			return VK_FORMAT_R16G16_SFLOAT;
+		case Core::VertexBufferPrototype::Format::Half4:
+			return VK_FORMAT_R16G16B16A16_SFLOAT;
+		case Core::VertexBufferPrototype::Format::Snorm8x4:
+			return VK_FORMAT_R8G8B8A8_SNORM;
+		case Core::VertexBufferPrototype::Format::Unorm8x4:
+			return VK_FORMAT_R8G8B8A8_UNORM;
+		case Core::VertexBufferPrototype::Format::Snorm16x2:
+			return VK_FORMAT_R16G16_SNORM;
+		case Core::VertexBufferPrototype::Format::Snorm16x4:
+			return VK_FORMAT_R16G16B16A16_SNORM;
+		case Core::VertexBufferPrototype::Format::Unorm16x2:
+			return VK_FORMAT_R16G16_UNORM;
+		case Core::VertexBufferPrototype::Format::Unorm16x4:
+			return VK_FORMAT_R16G16B16A16_UNORM;
+		case Core::VertexBufferPrototype::Format::Unorm10_10_10_2:
+			return VK_FORMAT_A2B10G10R10_UNORM_PACK32;
 		default:
 			throw Core::UnsupportedException("unsupported Vulkan vertex buffer format");
 		}
@@ -9,7 +9,7 @@ namespace MMPEngine::Backend::Vulkan
 	class Mesh final : public Core::Mesh
 	{
 	public:
-		Mesh(Core::GeometryPrototype&& proto);
+		Mesh(Core::GeometryPrototype&& proto, const Settings& settings);
 
 
 		class Renderer final : public Core::Mesh::Renderer
@@ -21,12 +21,14 @@ namespace MMPEngine::Backend::Vulkan
 			const std::vector<VkVertexInputAttributeDescription>& GetVertexAttributeDescriptions() const;
 			VkIndexType GetIndexType() const;
 			std::shared_ptr<Vulkan::Buffer> GetIndexBufferPointer() const;
+			std::shared_ptr<Vulkan::Buffer> GetIndirectArgumentsBufferPointer() const;
 			const std::vector<VkBuffer>& GetVertexBuffers() const;
 			const std::vector<std::shared_ptr<Vulkan::Buffer>>& GetVertexBufferPointers() const;
 			const std::vector<VkDeviceSize>& GetVertexBuffersOffsets() const;
 
 		protected:
 			std::shared_ptr<Core::UniformBuffer<Data>> CreateUniformBuffer() override;
+			std::shared_ptr<Core::UniformBuffer<AffineData>> CreateAffineUniformBuffer() override;
 			std::shared_ptr<Core::BaseTask> CreateInternalInitializationTask() override;
 		private:
 
@@ -50,7 +52,8 @@ namespace MMPEngine::Backend::Vulkan
 
 			VkIndexType _indexType = VK_INDEX_TYPE_UINT16;
 			std::shared_ptr<Vulkan::Buffer> _indexBuffer;
-			std::vector<VkBuffer> _vertexBuffers;
+			std::shared_ptr<Vulkan::Buffer> _indirectArgumentsBuffer;
+			mutable std::vector<VkBuffer> _vertexBuffers;
 			std::vector<std::shared_ptr<Vulkan::Buffer>> _vertexBufferPointers;
 			std::vector<VkDeviceSize> _vertexBufferOffsets;
 		};
@@ -58,7 +61,7 @@ namespace MMPEngine::Backend::Vulkan
 
 	protected:
 		std::shared_ptr<Core::BaseTask> CreateInternalInitializationTask() override;
-		std::shared_ptr<Core::VertexBuffer> CreateVertexBuffer(const Core::VertexBufferPrototype* vbPrototype) override;
+		std::shared_ptr<Core::VertexBuffer> CreateVertexBuffer(const Core::BaseGeometryBufferPrototype* vbPrototype) override;
 		std::shared_ptr<Core::IndexBuffer> CreateIndexBuffer(const Core::IndexBufferPrototype* ibPrototype) override;
 
 	};
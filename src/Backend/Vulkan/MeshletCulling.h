@@ -0,0 +1,116 @@
+#ifndef MMPENGINE_VULKAN_MESHLET_CULLING
+#define MMPENGINE_VULKAN_MESHLET_CULLING 1
+
+#if MMPENGINE_GLSL
+
+#define MMPENGINE_MESHLET_CULLING_GROUP_SIZE 64
+#define MMPENGINE_MESHLET_CULLING_FRUSTUM 1u
+#define MMPENGINE_MESHLET_CULLING_CONE 2u
+#define MMPENGINE_MESHLET_CULLING_INDEX_COUNTER 5
+#define MMPENGINE_MESHLET_CULLING_FINISHED_GROUPS 6
+
+layout(local_size_x = MMPENGINE_MESHLET_CULLING_GROUP_SIZE, local_size_y = 1, local_size_z = 1) in;
+
+layout(set = 0, binding = 0) uniform MeshletCullingDataBuffer
+{
+	MeshletCullingData cullingData;
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer MeshletBuffer
+{
+	MeshletData meshlets[];
+};
+
+layout(std430, set = 0, binding = 2) readonly buffer SourceIndexBuffer
+{
+	uint sourceIndices[];
+};
+
+layout(std430, set = 0, binding = 3) writeonly buffer CompactedIndexBuffer
+{
+	uint compactedIndices[];
+};
+
+layout(std430, set = 0, binding = 4) coherent buffer DrawArgumentsBuffer
+{
+	uint drawArguments[8];
+};
+
+uint MMPEngineReadMeshletSourceIndex(uint index)
+{
+	if (cullingData.indexFormat == 0u)
+	{
+		const uint word = sourceIndices[index >> 1];
+		return (index & 1u) == 0u ? (word & 0xFFFFu) : (word >> 16);
+	}
+
+	return sourceIndices[index];
+}
+
+bool MMPEngineIsMeshletVisible(MeshletData meshlet)
+{
+	if ((cullingData.flags & MMPENGINE_MESHLET_CULLING_FRUSTUM) != 0u)
+	{
+		for (int i = 0; i < 6; ++i)
+		{
+			const vec4 plane = cullingData.frustumPlanes[i];
+
+			if (dot(plane.xyz, meshlet.center) + plane.w < -meshlet.radius)
+			{
+				return false;
+			}
+		}
+	}
+
+	if ((cullingData.flags & MMPENGINE_MESHLET_CULLING_CONE) != 0u)
+	{
+		const vec3 d = meshlet.center - cullingData.cameraPosition.xyz;
+
+		if (dot(d, meshlet.coneAxis) >= meshlet.coneCutoff * length(d) + meshlet.radius)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void main()
+{
+	const uint meshletIndex = gl_GlobalInvocationID.x;
+
+	if (meshletIndex < cullingData.meshletCount)
+	{
+		const MeshletData meshlet = meshlets[meshletIndex];
+
+		if (MMPEngineIsMeshletVisible(meshlet))
+		{
+			const uint dst = atomicAdd(drawArguments[MMPENGINE_MESHLET_CULLING_INDEX_COUNTER], meshlet.indexCount);
+
+			for (uint i = 0u; i < meshlet.indexCount; ++i)
+			{
+				compactedIndices[dst + i] = MMPEngineReadMeshletSourceIndex(meshlet.indexStart + i) + meshlet.baseVertex;
+			}
+		}
+	}
+
+	memoryBarrierBuffer();
+	barrier();
+
+	if (gl_LocalInvocationIndex == 0u)
+	{
+		if (atomicAdd(drawArguments[MMPENGINE_MESHLET_CULLING_FINISHED_GROUPS], 1u) + 1u == gl_NumWorkGroups.x)
+		{
+			drawArguments[0] = atomicExchange(drawArguments[MMPENGINE_MESHLET_CULLING_INDEX_COUNTER], 0u);
+			drawArguments[1] = cullingData.instanceCount;
+			drawArguments[2] = 0u;
+			drawArguments[3] = 0u;
+			drawArguments[4] = 0u;
+			drawArguments[MMPENGINE_MESHLET_CULLING_FINISHED_GROUPS] = 0u;
+		}
+	}
+}
+
+#endif
+
+#endif
@@ -399,6 +399,8 @@ namespace MMPEngine::Backend::Vulkan
 		presentInfo.pWaitSemaphores = &currentBinSem;
 		presentInfo.waitSemaphoreCount = 1;
 		presentInfo.pImageIndices = &currentImageIndex;
+
+		const auto lock = _specificStreamContext->LockQueue();
 		vkQueuePresentKHR(_specificStreamContext->GetQueue()->GetNative(), &presentInfo);
 
 		screen->_timelineValue2BinarySemaphoreMap.erase(screen->_currentBinSemaphoreMapIt);
@@ -23,19 +23,35 @@ namespace MMPEngine::Backend::Vulkan
 	{
 		const auto cb = _specificStreamContext->GetCommandBuffer(_passControl)->GetNative();
 
+		const auto lock = _specificStreamContext->LockQueue();
+		const auto signalValue = _specificStreamContext->IncrementTimelineValue(_passControl);
+		const auto& waitSemaphores = _specificStreamContext->GetWaitSemaphores(_passControl);
+		const auto& waitValues = _specificStreamContext->GetWaitValues(_passControl);
+		const auto& waitStages = _specificStreamContext->GetWaitStages(_passControl);
+
+		const auto signalSemaphore = _specificStreamContext->GetTimelineSemaphore()->GetNative();
+
+		VkTimelineSemaphoreSubmitInfo timelineInfo;
+		timelineInfo.pNext = nullptr;
+		timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+		timelineInfo.waitSemaphoreValueCount = static_cast<std::uint32_t>(waitValues.size());
+		timelineInfo.pWaitSemaphoreValues = waitValues.data();
+		timelineInfo.signalSemaphoreValueCount = 1;
+		timelineInfo.pSignalSemaphoreValues = &signalValue;
+
 		VkSubmitInfo submitInfo;
-		submitInfo.pNext = nullptr;
+		submitInfo.pNext = &timelineInfo;
 		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
 		submitInfo.commandBufferCount = 1;
 		submitInfo.pCommandBuffers = &cb;
 
-		submitInfo.waitSemaphoreCount = 0;
-		submitInfo.pWaitSemaphores = nullptr;
-		submitInfo.pWaitDstStageMask = nullptr;
+		submitInfo.waitSemaphoreCount = static_cast<std::uint32_t>(waitSemaphores.size());
+		submitInfo.pWaitSemaphores = waitSemaphores.data();
+		submitInfo.pWaitDstStageMask = waitStages.data();
 
-		submitInfo.signalSemaphoreCount = 0;
-		submitInfo.pSignalSemaphores = nullptr;
+		submitInfo.signalSemaphoreCount = 1;
+		submitInfo.pSignalSemaphores = &signalSemaphore;
 
 		vkEndCommandBuffer(cb);
 		vkQueueSubmit(
@@ -44,6 +60,13 @@ namespace MMPEngine::Backend::Vulkan
 			&submitInfo,
 			nullptr
 		);
+
+		_specificStreamContext->ClearWaits(_passControl);
+	}
+
+	void Stream::WaitFor(const std::shared_ptr<Stream>& producer, VkPipelineStageFlags dstStage)
+	{
+		_specificStreamContext->WaitFor(producer->_specificStreamContext, dstStage);
 	}
 
 	void Stream::UpdateExecutionMonitor()
@@ -63,7 +86,8 @@ namespace MMPEngine::Backend::Vulkan
 		submitInfo.pSignalSemaphores = nullptr;
 
 		const auto vkFence = _specificStreamContext->GetFence()->GetNative();
-		
+		const auto lock = _specificStreamContext->LockQueue();
+
 		vkResetFences(_specificGlobalContext->device->GetNativeLogical(), 1, &vkFence);
 		vkQueueSubmit(
 			_specificStreamContext->GetQueue()->GetNative(),
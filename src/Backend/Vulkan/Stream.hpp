@@ -20,6 +20,7 @@ namespace MMPEngine::Backend::Vulkan
 		Stream& operator=(const Stream&) = delete;
 		Stream& operator=(Stream&&) noexcept = delete;
 		~Stream() override;
+		void WaitFor(const std::shared_ptr<Stream>& producer, VkPipelineStageFlags dstStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
 	protected:
 		bool ExecutionMonitorCompleted() override;
 		void ResetAll() override;
@@ -70,6 +70,18 @@ namespace MMPEngine::Backend::Vulkan
 		barrier.srcQueueFamilyIndex = ctx->entity->_queueFamilyIndexOwnerShip.value_or(_specificStreamContext->GetQueue()->GetFamilyIndex());
 		barrier.dstQueueFamilyIndex = _specificStreamContext->GetQueue()->GetFamilyIndex();
 
+		if (barrier.srcQueueFamilyIndex != barrier.dstQueueFamilyIndex)
+		{
+			if (const auto owner = entity->_queueOwnerStreamContext.lock(); owner && owner != _specificStreamContext)
+			{
+				auto release = barrier;
+				release.dstAccessMask = 0;
+				_specificStreamContext->AcquireOwnership(owner, release);
+			}
+
+			barrier.srcAccessMask = 0;
+		}
+
 		vkCmdPipelineBarrier(
 			_specificStreamContext->PopulateCommandsInBuffer()->GetNative(),
 			ctx->data.srcStage,
@@ -81,6 +93,7 @@ namespace MMPEngine::Backend::Vulkan
 		);
 
 		ctx->entity->_queueFamilyIndexOwnerShip = _specificStreamContext->GetQueue()->GetFamilyIndex();
+		ctx->entity->_queueOwnerStreamContext = _specificStreamContext;
 		ctx->entity->_layout = ctx->data.imageLayout;
 	}
 
@@ -53,6 +53,11 @@ namespace MMPEngine::Backend::Vulkan
 			return _pool;
 		}
 
+		const std::shared_ptr<Device>& CommandAllocator::GetDevice() const
+		{
+			return _device;
+		}
+
 		CommandBuffer::CommandBuffer(
 			const std::shared_ptr<Device>& device,
 			const std::shared_ptr<CommandAllocator>& allocator, 
@@ -100,5 +105,39 @@ namespace MMPEngine::Backend::Vulkan
 		{
 			return _fence;
 		}
+
+		Semaphore::Semaphore(const std::shared_ptr<Device>& device, VkSemaphore semaphore) : _device(device), _semaphore(semaphore)
+		{
+		}
+
+		Semaphore::~Semaphore()
+		{
+			vkDestroySemaphore(_device->GetNativeLogical(), _semaphore, nullptr);
+		}
+
+		VkSemaphore Semaphore::GetNative() const
+		{
+			return _semaphore;
+		}
+
+		std::uint64_t Semaphore::GetCompletedValue() const
+		{
+			std::uint64_t value = 0;
+			vkGetSemaphoreCounterValue(_device->GetNativeLogical(), _semaphore, &value);
+			return value;
+		}
+
+		void Semaphore::Wait(std::uint64_t value) const
+		{
+			VkSemaphoreWaitInfo waitInfo {};
+			waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+			waitInfo.pNext = nullptr;
+			waitInfo.flags = 0;
+			waitInfo.semaphoreCount = 1;
+			waitInfo.pSemaphores = &_semaphore;
+			waitInfo.pValues = &value;
+
+			vkWaitSemaphores(_device->GetNativeLogical(), &waitInfo, (std::numeric_limits<std::uint64_t>::max)());
+		}
 	}
 }
\ No newline at end of file
@@ -48,6 +48,7 @@ namespace MMPEngine::Backend::Vulkan
 			~CommandAllocator();
 
 			VkCommandPool GetNative() const;
+			const std::shared_ptr<Device>& GetDevice() const;
 		private:
 			std::shared_ptr<Device> _device;
 			VkCommandPool _pool;
@@ -101,5 +102,24 @@ namespace MMPEngine::Backend::Vulkan
 			std::shared_ptr<Device> _device;
 			VkFence _fence;
 		};
+
+		class Semaphore final
+		{
+		public:
+			Semaphore(const std::shared_ptr<Device>& device, VkSemaphore semaphore);
+			Semaphore(const Semaphore&) = delete;
+			Semaphore(Semaphore&&) noexcept = delete;
+			Semaphore& operator=(const Semaphore&) = delete;
+			Semaphore& operator=(Semaphore&&) noexcept = delete;
+			~Semaphore();
+
+			VkSemaphore GetNative() const;
+			std::uint64_t GetCompletedValue() const;
+			void Wait(std::uint64_t value) const;
+
+		private:
+			std::shared_ptr<Device> _device;
+			VkSemaphore _semaphore;
+		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <Core/AccessTracker.hpp>
+#include <algorithm>
+
+namespace MMPEngine::Core
+{
+	AccessTracker::AccessTracker(AccessFlags writeMask) : _writeMask(writeMask)
+	{
+	}
+
+	std::optional<AccessTracker::Barrier> AccessTracker::Track(StageFlags stage, AccessFlags access)
+	{
+		const auto writeAccess = access & _writeMask;
+		const auto readAccess = access & ~_writeMask;
+
+		if (writeAccess)
+		{
+			const auto srcStage = _writeStage | _readStage;
+			const auto srcAccess = _writeAccess;
+
+			_writeStage = stage;
+			_writeAccess = writeAccess;
+			_readStage = 0;
+			_visibleReads.clear();
+
+			if (readAccess)
+			{
+				_readStage = stage;
+				_visibleReads.emplace_back(stage, readAccess);
+			}
+
+			if (srcStage == 0)
+			{
+				return std::nullopt;
+			}
+
+			return Barrier { srcStage, srcAccess };
+		}
+
+		_readStage |= stage;
+
+		if (_writeStage == 0 || IsReadVisible(stage, readAccess))
+		{
+			return std::nullopt;
+		}
+
+		_visibleReads.emplace_back(stage, readAccess);
+		return Barrier { _writeStage, _writeAccess };
+	}
+
+	void AccessTracker::Reset(StageFlags writeStage, AccessFlags writeAccess, StageFlags readStage)
+	{
+		_writeStage = writeStage;
+		_writeAccess = writeAccess;
+		_readStage = readStage;
+		_visibleReads.clear();
+	}
+
+	void AccessTracker::Alias(const AccessTracker& predecessor)
+	{
+		_writeStage |= predecessor._writeStage | predecessor._readStage;
+		_writeAccess |= predecessor._writeAccess;
+	}
+
+	AccessTracker::StageFlags AccessTracker::GetWriteStage() const
+	{
+		return _writeStage;
+	}
+
+	AccessTracker::AccessFlags AccessTracker::GetWriteAccess() const
+	{
+		return _writeAccess;
+	}
+
+	AccessTracker::StageFlags AccessTracker::GetReadStage() const
+	{
+		return _readStage;
+	}
+
+	bool AccessTracker::IsReadVisible(StageFlags stage, AccessFlags access) const
+	{
+		return std::any_of(_visibleReads.cbegin(), _visibleReads.cend(), [stage, access](const auto& visible)
+		{
+			return (visible.first & stage) == stage && (visible.second & access) == access;
+		});
+	}
+}
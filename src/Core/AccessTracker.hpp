@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace MMPEngine::Core
+{
+	class AccessTracker final
+	{
+	public:
+		using StageFlags = std::uint32_t;
+		using AccessFlags = std::uint32_t;
+
+		struct Barrier final
+		{
+			StageFlags srcStage;
+			AccessFlags srcAccess;
+		};
+
+		AccessTracker(AccessFlags writeMask);
+
+		std::optional<Barrier> Track(StageFlags stage, AccessFlags access);
+		void Reset(StageFlags writeStage, AccessFlags writeAccess, StageFlags readStage = 0);
+		void Alias(const AccessTracker& predecessor);
+
+		StageFlags GetWriteStage() const;
+		AccessFlags GetWriteAccess() const;
+		StageFlags GetReadStage() const;
+	private:
+		bool IsReadVisible(StageFlags stage, AccessFlags access) const;
+
+		AccessFlags _writeMask;
+		StageFlags _writeStage = 0;
+		AccessFlags _writeAccess = 0;
+		StageFlags _readStage = 0;
+		std::vector<std::pair<StageFlags, AccessFlags>> _visibleReads;
+	};
+}
@@ -135,13 +135,13 @@ namespace MMPEngine::Core
 		return AreIdentical(q1, q2) || AreIdentical(q1, {-q2.x, -q2.y, -q2.z, -q2.w});
 	}
 
-	inline bool MatrixEqualityCheck(std::size_t size, const std::float_t* lhs, const std::float_t* rhs)
+	inline bool MatrixEqualityCheck(std::size_t rows, std::size_t columns, const std::float_t* lhs, const std::float_t* rhs)
 	{
-		for (std::size_t i = 0; i < size; ++i)
+		for (std::size_t i = 0; i < rows; ++i)
 		{
-			for (std::size_t j = 0; j < size; ++j)
+			for (std::size_t j = 0; j < columns; ++j)
 			{
-				const auto linear = i * size + j;
+				const auto linear = i * columns + j;
 
 				if (std::abs(lhs[linear] - rhs[linear]) > Constants::kFloatSensitivity)
 				{
@@ -154,7 +154,7 @@ namespace MMPEngine::Core
 
 	bool Matrix4x4::operator==(const Matrix4x4& rhs) const
 	{
-		return MatrixEqualityCheck(4, &(m[0][0]), &(rhs.m[0][0]));
+		return MatrixEqualityCheck(4, 4, &(m[0][0]), &(rhs.m[0][0]));
 	}
 
 	bool Matrix4x4::operator!=(const Matrix4x4& rhs) const
@@ -162,9 +162,19 @@ namespace MMPEngine::Core
 		return !operator==(rhs);
 	}
 
+	bool Affine3x4::operator==(const Affine3x4& rhs) const
+	{
+		return MatrixEqualityCheck(3, 4, &(m[0][0]), &(rhs.m[0][0]));
+	}
+
+	bool Affine3x4::operator!=(const Affine3x4& rhs) const
+	{
+		return !operator==(rhs);
+	}
+
 	bool Matrix3x3::operator==(const Matrix3x3& rhs) const
 	{
-		return MatrixEqualityCheck(3, &(m[0][0]), &(rhs.m[0][0]));
+		return MatrixEqualityCheck(3, 3, &(m[0][0]), &(rhs.m[0][0]));
 	}
 
 	bool Matrix3x3::operator!=(const Matrix3x3& rhs) const
@@ -174,7 +184,7 @@ namespace MMPEngine::Core
 
 	bool Matrix2x2::operator==(const Matrix2x2& rhs) const
 	{
-		return MatrixEqualityCheck(2, &(m[0][0]), &(rhs.m[0][0]));
+		return MatrixEqualityCheck(2, 2, &(m[0][0]), &(rhs.m[0][0]));
 	}
 
 	bool Matrix2x2::operator!=(const Matrix2x2& rhs) const
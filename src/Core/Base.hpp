@@ -183,6 +183,14 @@ namespace MMPEngine::Core
 		bool operator!=(const Matrix4x4& rhs) const;
 	};
 
+	struct Affine3x4 final
+	{
+		std::float_t m[3][4];
+
+		bool operator==(const Affine3x4& rhs) const;
+		bool operator!=(const Affine3x4& rhs) const;
+	};
+
 	struct Transform final
 	{
 		Vector3Float position = {0.0f, 0.0f, 0.0f};
@@ -1,8 +1,43 @@
 #include <Core/Buffer.hpp>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MMPENGINE_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace MMPEngine::Core
 {
+	namespace
+	{
+		void CopyNonTemporal(char* dst, const char* src, std::size_t byteLength)
+		{
+#ifdef MMPENGINE_SSE2
+			constexpr std::size_t alignment = sizeof(__m128i);
+			const auto head = std::min((alignment - reinterpret_cast<std::uintptr_t>(dst) % alignment) % alignment, byteLength);
+
+			std::memcpy(dst, src, head);
+			dst += head;
+			src += head;
+			byteLength -= head;
+
+			const auto body = byteLength - byteLength % alignment;
+
+			for (std::size_t i = 0; i < body; i += alignment)
+			{
+				_mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+			}
+
+			_mm_sfence();
+			std::memcpy(dst + body, src + body, byteLength - body);
+#else
+			std::memcpy(dst, src, byteLength);
+#endif
+		}
+	}
+
 	const Buffer::Settings& Buffer::GetSettingsInternal()
 	{
 		return _settings;
@@ -40,10 +75,149 @@ namespace MMPEngine::Core
 		return GetUnderlyingBuffer()->CreateCopyToBufferTask(dstUnderlyingBuffer, minMax.first, 0, 0);
 	}
 
+	std::shared_ptr<BaseTask> Buffer::CopyRegionsToBuffer(const std::shared_ptr<Buffer>& dst, std::vector<CopyRegion>&& regions) const
+	{
+		const auto dstUnderlyingBuffer = dst->GetUnderlyingBuffer();
+		const auto coalescedRegions = CoalesceCopyRegions(std::move(regions));
+
+		for (const auto& region : coalescedRegions)
+		{
+			assert(region.srcByteOffset + region.byteLength <= GetSettings().byteLength);
+			assert(region.dstByteOffset + region.byteLength <= dstUnderlyingBuffer->GetSettings().byteLength);
+		}
+
+		if (coalescedRegions.empty())
+		{
+			return BaseTask::kEmpty;
+		}
+
+		if (coalescedRegions.size() == 1)
+		{
+			const auto& region = coalescedRegions.front();
+			return GetUnderlyingBuffer()->CreateCopyToBufferTask(dstUnderlyingBuffer, region.byteLength, region.srcByteOffset, region.dstByteOffset);
+		}
+
+		return GetUnderlyingBuffer()->CreateCopyRegionsToBufferTask(dstUnderlyingBuffer, coalescedRegions);
+	}
+
+	std::vector<Buffer::CopyRegion> Buffer::CoalesceCopyRegions(std::vector<CopyRegion>&& regions)
+	{
+		regions.erase(std::remove_if(regions.begin(), regions.end(), [](const auto& region) { return region.byteLength == 0; }), regions.end());
+		std::stable_sort(regions.begin(), regions.end(), [](const auto& l, const auto& r) { return l.dstByteOffset < r.dstByteOffset; });
+
+		std::vector<CopyRegion> result;
+		result.reserve(regions.size());
+
+		for (const auto& region : regions)
+		{
+			if (!result.empty())
+			{
+				auto& last = result.back();
+				assert(last.dstByteOffset + last.byteLength <= region.dstByteOffset);
+
+				if (last.dstByteOffset + last.byteLength == region.dstByteOffset && last.srcByteOffset + last.byteLength == region.srcByteOffset)
+				{
+					last.byteLength += region.byteLength;
+					continue;
+				}
+			}
+
+			result.push_back(region);
+		}
+
+		return result;
+	}
+
+	std::shared_ptr<BaseTask> Buffer::CreateCopyRegionsToBufferTask(const std::shared_ptr<Buffer>& dst, const std::vector<CopyRegion>& regions) const
+	{
+		std::vector<std::shared_ptr<BaseTask>> tasks;
+		tasks.reserve(regions.size());
+
+		for (const auto& region : regions)
+		{
+			tasks.push_back(CreateCopyToBufferTask(dst, region.byteLength, region.srcByteOffset, region.dstByteOffset));
+		}
+
+		return std::make_shared<StaticBatchTask>(std::move(tasks));
+	}
+
 	UploadBuffer::UploadBuffer(const Settings& settings) : Buffer(settings)
 	{
 	}
 
+	std::shared_ptr<ContextualTask<UploadBuffer::WriteTaskContext>> UploadBuffer::CreateBatchWriteTask(std::vector<WriteRegion>&& regions, bool nonTemporal)
+	{
+		const auto task = CreateWriteTask(nullptr, 0, 0);
+		const auto tc = task->GetTaskContext();
+		tc->regions = CoalesceWriteRegions(std::move(regions));
+		tc->nonTemporal = nonTemporal;
+
+		for (const auto& region : tc->regions)
+		{
+			assert(region.byteOffset + region.byteLength <= GetSettings().byteLength);
+		}
+
+		return task;
+	}
+
+	std::vector<UploadBuffer::WriteRegion> UploadBuffer::CoalesceWriteRegions(std::vector<WriteRegion>&& regions)
+	{
+		regions.erase(std::remove_if(regions.begin(), regions.end(), [](const auto& region) { return region.byteLength == 0; }), regions.end());
+		std::stable_sort(regions.begin(), regions.end(), [](const auto& l, const auto& r) { return l.byteOffset < r.byteOffset; });
+
+		std::vector<WriteRegion> result;
+		result.reserve(regions.size());
+
+		for (const auto& region : regions)
+		{
+			assert(region.src);
+
+			if (!result.empty())
+			{
+				auto& last = result.back();
+				assert(last.byteOffset + last.byteLength <= region.byteOffset);
+
+				if (last.byteOffset + last.byteLength == region.byteOffset && static_cast<const char*>(last.src) + last.byteLength == region.src)
+				{
+					last.byteLength += region.byteLength;
+					continue;
+				}
+			}
+
+			result.push_back(region);
+		}
+
+		return result;
+	}
+
+	void UploadBuffer::Write(void* mappedData, const WriteTaskContext& context)
+	{
+		const auto write = [mappedData, &context](const void* src, std::size_t byteLength, std::size_t byteOffset)
+		{
+			const auto dst = static_cast<char*>(mappedData) + byteOffset;
+
+			if (context.nonTemporal)
+			{
+				CopyNonTemporal(dst, static_cast<const char*>(src), byteLength);
+			}
+			else
+			{
+				std::memcpy(dst, src, byteLength);
+			}
+		};
+
+		if (context.regions.empty())
+		{
+			write(context.src, context.byteLength, context.byteOffset);
+			return;
+		}
+
+		for (const auto& region : context.regions)
+		{
+			write(region.src, region.byteLength, region.byteOffset);
+		}
+	}
+
 	ReadBackBuffer::ReadBackBuffer(const Settings& settings) : Buffer(settings)
 	{
 	}
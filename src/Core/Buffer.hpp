@@ -1,6 +1,7 @@
 #pragma once
 #include <Core/Entity.hpp>
 #include <optional>
+#include <vector>
 
 namespace MMPEngine::Core
 {
@@ -12,6 +13,12 @@ namespace MMPEngine::Core
 			std::size_t byteLength;
 			std::string name = {};
 		};
+		struct CopyRegion final
+		{
+			std::size_t byteLength = 0;
+			std::size_t srcByteOffset = 0;
+			std::size_t dstByteOffset = 0;
+		};
 		virtual std::shared_ptr<BaseTask> CreateCopyToBufferTask(
 			const std::shared_ptr<Buffer>& dst, 
 			std::size_t byteLength, 
@@ -19,11 +26,14 @@ namespace MMPEngine::Core
 			std::size_t dstByteOffset
 		) const = 0;
 		std::shared_ptr<BaseTask> CopyToBuffer(const std::shared_ptr<Buffer>& dst) const;
+		std::shared_ptr<BaseTask> CopyRegionsToBuffer(const std::shared_ptr<Buffer>& dst, std::vector<CopyRegion>&& regions) const;
+		static std::vector<CopyRegion> CoalesceCopyRegions(std::vector<CopyRegion>&& regions);
 		std::shared_ptr<Buffer> GetUnderlyingBuffer() const;
 		virtual std::shared_ptr<Buffer> GetUnderlyingBuffer();
 		const Settings& GetSettings() const;
         virtual std::optional<std::size_t> GetStride() const;
 	protected:
+		virtual std::shared_ptr<BaseTask> CreateCopyRegionsToBufferTask(const std::shared_ptr<Buffer>& dst, const std::vector<CopyRegion>& regions) const;
 		const Settings& GetSettingsInternal();
 		Buffer(const Settings& settings);
 		Settings _settings;
@@ -34,14 +44,25 @@ namespace MMPEngine::Core
 	protected:
 		UploadBuffer(const Settings& settings);
 	public:
+		struct WriteRegion final
+		{
+			const void* src = nullptr;
+			std::size_t byteLength = 0;
+			std::size_t byteOffset = 0;
+		};
 		class WriteTaskContext : public TaskContext
 		{
 		public:
 			const void* src = nullptr;
 			std::size_t byteLength = 0;
 			std::size_t byteOffset = 0;
+			std::vector<WriteRegion> regions {};
+			bool nonTemporal = false;
 		};
 		virtual std::shared_ptr<ContextualTask<WriteTaskContext>> CreateWriteTask(const void* src, std::size_t byteLength, std::size_t byteOffset = 0) = 0;
+		std::shared_ptr<ContextualTask<WriteTaskContext>> CreateBatchWriteTask(std::vector<WriteRegion>&& regions, bool nonTemporal = false);
+		static std::vector<WriteRegion> CoalesceWriteRegions(std::vector<WriteRegion>&& regions);
+		static void Write(void* mappedData, const WriteTaskContext& context);
 	};
 
 	class ReadBackBuffer : public Buffer
@@ -55,6 +76,7 @@ namespace MMPEngine::Core
 			void* dst = nullptr;
 			std::size_t byteLength = 0;
 			std::size_t byteOffset = 0;
+			bool synchronize = true;
 		};
 		virtual std::shared_ptr<ContextualTask<ReadTaskContext>> CreateReadTask(void* dst, std::size_t byteLength, std::size_t byteOffset = 0) = 0;
 	};
@@ -0,0 +1,191 @@
+#include <Core/ComputePrimitives.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace MMPEngine::Core
+{
+	std::string_view ComputePrimitives::GetShaderId(Kernel kernel)
+	{
+		switch (kernel)
+		{
+		case Kernel::Clear:
+			return "compute_primitives_clear";
+		case Kernel::ScanBlocks:
+			return "compute_primitives_scan_blocks";
+		case Kernel::AddBlockOffsets:
+			return "compute_primitives_add_block_offsets";
+		case Kernel::CompactScatter:
+			return "compute_primitives_compact_scatter";
+		case Kernel::RadixCount:
+			return "compute_primitives_radix_count";
+		case Kernel::RadixScatter:
+			return "compute_primitives_radix_scatter";
+		case Kernel::SegmentedReduce:
+			return "compute_primitives_segmented_reduce";
+		case Kernel::Histogram:
+			return "compute_primitives_histogram";
+		}
+
+		throw UnsupportedException("unknown compute primitive kernel");
+	}
+
+	std::uint32_t ComputePrimitives::GetGroupsCount(std::uint32_t count)
+	{
+		return std::max((count + kGroupSize - 1) / kGroupSize, 1u);
+	}
+
+	std::vector<std::uint32_t> ComputePrimitives::GetScanLevels(std::uint32_t count)
+	{
+		assert(count > 0);
+
+		std::vector<std::uint32_t> levels { count };
+
+		while (levels.back() > kGroupSize)
+		{
+			levels.push_back(GetGroupsCount(levels.back()));
+		}
+
+		return levels;
+	}
+
+	std::uint32_t ComputePrimitives::GetSegmentedReduceGroupsCount(std::uint32_t segmentsCount)
+	{
+		return std::min(segmentsCount, kMaxGroupsCount);
+	}
+
+	void ComputePrimitives::Scan(const std::uint32_t* input, std::uint32_t* output, std::size_t count, bool inclusive)
+	{
+		std::uint32_t sum = 0;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const auto value = input[i];
+			output[i] = inclusive ? sum + value : sum;
+			sum += value;
+		}
+	}
+
+	std::size_t ComputePrimitives::Compact(const std::uint32_t* values, const std::uint32_t* flags, std::uint32_t* output, std::size_t count)
+	{
+		std::size_t compactedCount = 0;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (flags[i] != 0)
+			{
+				output[compactedCount++] = values[i];
+			}
+		}
+
+		return compactedCount;
+	}
+
+	void ComputePrimitives::RadixSort(std::uint32_t* keys, std::uint32_t* payload, std::size_t count)
+	{
+		const auto groupsCount = GetGroupsCount(static_cast<std::uint32_t>(count));
+		std::vector<std::uint32_t> tempKeys(count);
+		std::vector<std::uint32_t> tempPayload(payload ? count : 0);
+		std::vector<std::uint32_t> offsets(groupsCount * kRadixSize);
+		std::vector<std::uint32_t> digits(kGroupSize);
+		std::vector<std::uint32_t> ranks(kGroupSize);
+
+		for (std::uint32_t shift = 0; shift < 32; shift += kRadixBits)
+		{
+			std::fill(offsets.begin(), offsets.end(), 0u);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				++offsets[((keys[i] >> shift) & (kRadixSize - 1)) * groupsCount + i / kGroupSize];
+			}
+
+			Scan(offsets.data(), offsets.data(), offsets.size(), false);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const auto group = i / kGroupSize;
+				const auto t = i % kGroupSize;
+
+				if (t == 0)
+				{
+					const auto groupCount = std::min<std::size_t>(kGroupSize, count - i);
+
+					for (std::size_t j = 0; j < groupCount; ++j)
+					{
+						digits[j] = (keys[i + j] >> shift) & (kRadixSize - 1);
+					}
+
+					RankRadixDigits(digits.data(), groupCount, ranks.data());
+				}
+
+				const auto dst = offsets[digits[t] * groupsCount + group] + ranks[t];
+				tempKeys[dst] = keys[i];
+
+				if (payload)
+				{
+					tempPayload[dst] = payload[i];
+				}
+			}
+
+			std::copy(tempKeys.cbegin(), tempKeys.cend(), keys);
+
+			if (payload)
+			{
+				std::copy(tempPayload.cbegin(), tempPayload.cend(), payload);
+			}
+		}
+	}
+
+	void ComputePrimitives::RankRadixDigits(const std::uint32_t* digits, std::size_t count, std::uint32_t* ranks)
+	{
+		constexpr auto digitsPerWord = 32 / kRadixRankBits;
+		constexpr auto rankMask = (1u << kRadixRankBits) - 1;
+
+		assert(count <= kGroupSize);
+
+		std::uint32_t packedCounts[kRadixSize / digitsPerWord] = {};
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			assert(digits[i] < kRadixSize);
+
+			const auto shift = (digits[i] % digitsPerWord) * kRadixRankBits;
+			auto& packed = packedCounts[digits[i] / digitsPerWord];
+
+			ranks[i] = (packed >> shift) & rankMask;
+			packed += 1u << shift;
+		}
+	}
+
+	void ComputePrimitives::SegmentedReduce(const std::uint32_t* values, const std::uint32_t* segmentOffsets, std::size_t segmentsCount, std::uint32_t* output)
+	{
+		for (std::size_t s = 0; s < segmentsCount; ++s)
+		{
+			assert(segmentOffsets[s] <= segmentOffsets[s + 1]);
+
+			std::uint32_t sum = 0;
+
+			for (auto i = segmentOffsets[s]; i < segmentOffsets[s + 1]; ++i)
+			{
+				sum += values[i];
+			}
+
+			output[s] = sum;
+		}
+	}
+
+	void ComputePrimitives::Histogram(const std::uint32_t* values, std::size_t count, std::uint32_t shift, std::uint32_t binsCount, std::uint32_t* bins)
+	{
+		std::fill(bins, bins + binsCount, 0u);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			++bins[GetHistogramBin(values[i], shift, binsCount)];
+		}
+	}
+
+	std::uint32_t ComputePrimitives::GetHistogramBin(std::uint32_t value, std::uint32_t shift, std::uint32_t binsCount)
+	{
+		assert(binsCount > 0);
+		return std::min(value >> shift, binsCount - 1);
+	}
+}
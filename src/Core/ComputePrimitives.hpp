@@ -0,0 +1,61 @@
+#pragma once
+#include <string_view>
+#include <vector>
+#include <Core/Base.hpp>
+
+namespace MMPEngine::Core
+{
+	class ComputePrimitives final
+	{
+	public:
+		static constexpr std::uint32_t kGroupSize = 256;
+		static constexpr std::uint32_t kRadixBits = 4;
+		static constexpr std::uint32_t kRadixSize = 1u << kRadixBits;
+		static constexpr std::uint32_t kRadixRankBits = 8;
+		static constexpr std::uint32_t kMaxGroupsCount = 65535;
+
+		static_assert(kGroupSize <= (1u << kRadixRankBits), "radix ranks are packed into 8-bit lanes");
+
+		enum class Kernel : std::uint8_t
+		{
+			Clear,
+			ScanBlocks,
+			AddBlockOffsets,
+			CompactScatter,
+			RadixCount,
+			RadixScatter,
+			SegmentedReduce,
+			Histogram
+		};
+
+		struct Data final
+		{
+			enum Flags : std::uint32_t
+			{
+				kInclusive = 1 << 0,
+				kWriteBlockSums = 1 << 1,
+				kPayload = 1 << 2
+			};
+
+			std::uint32_t count;
+			std::uint32_t shift;
+			std::uint32_t flags;
+			std::uint32_t binsCount;
+		};
+
+		ComputePrimitives() = delete;
+
+		static std::string_view GetShaderId(Kernel kernel);
+		static std::uint32_t GetGroupsCount(std::uint32_t count);
+		static std::vector<std::uint32_t> GetScanLevels(std::uint32_t count);
+		static std::uint32_t GetSegmentedReduceGroupsCount(std::uint32_t segmentsCount);
+
+		static void Scan(const std::uint32_t* input, std::uint32_t* output, std::size_t count, bool inclusive);
+		static std::size_t Compact(const std::uint32_t* values, const std::uint32_t* flags, std::uint32_t* output, std::size_t count);
+		static void RadixSort(std::uint32_t* keys, std::uint32_t* payload, std::size_t count);
+		static void RankRadixDigits(const std::uint32_t* digits, std::size_t count, std::uint32_t* ranks);
+		static void SegmentedReduce(const std::uint32_t* values, const std::uint32_t* segmentOffsets, std::size_t segmentsCount, std::uint32_t* output);
+		static void Histogram(const std::uint32_t* values, std::size_t count, std::uint32_t shift, std::uint32_t binsCount, std::uint32_t* bins);
+		static std::uint32_t GetHistogramBin(std::uint32_t value, std::uint32_t shift, std::uint32_t binsCount);
+	};
+}
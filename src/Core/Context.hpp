@@ -50,8 +50,17 @@ typedef void* NativeWindow;
 	public:
 		struct Settings final
 		{
+			struct HeapReservations final
+			{
+				std::size_t upload = 0;
+				std::size_t readBack = 0;
+				std::size_t resident = 0;
+				std::size_t uniform = 0;
+			};
+
 			bool isDebug;
 			BackendType backend;
+			HeapReservations heapReservations {};
 		};
         struct Environment final
         {
@@ -0,0 +1,443 @@
+#include <Core/FrameGraph.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace MMPEngine::Core
+{
+	FrameGraph::FrameGraph() = default;
+	FrameGraph::~FrameGraph() = default;
+
+	FrameGraph::ResourceId FrameGraph::Import(const std::shared_ptr<Buffer>& buffer, StageFlags initialStage, AccessFlags initialAccess)
+	{
+		assert(buffer);
+		assert(!_compiled);
+
+		Resource resource {};
+		resource.imported = buffer;
+		resource.byteLength = buffer->GetSettings().byteLength;
+		resource.alignment = 1;
+		resource.initialStage = initialStage;
+		resource.initialAccess = initialAccess;
+
+		_resources.push_back(std::move(resource));
+		return _resources.size() - 1;
+	}
+
+	FrameGraph::ResourceId FrameGraph::CreateTransient(std::size_t byteLength, std::size_t alignment)
+	{
+		assert(byteLength > 0);
+		assert(alignment > 0);
+		assert(!_compiled);
+
+		Resource resource {};
+		resource.byteLength = byteLength;
+		resource.alignment = alignment;
+		resource.initialStage = Stage::kNone;
+		resource.initialAccess = Access::kNone;
+
+		_resources.push_back(std::move(resource));
+		return _resources.size() - 1;
+	}
+
+	FrameGraph::PassId FrameGraph::AddPass(std::string_view name, std::vector<Usage>&& usages, TaskFactory&& taskFactory, bool hasSideEffects)
+	{
+		assert(!_compiled);
+
+		for (const auto& usage : usages)
+		{
+			assert(usage.resource < _resources.size());
+			assert(usage.stage != Stage::kNone);
+		}
+
+		_passes.push_back(Pass { std::string { name }, std::move(usages), std::move(taskFactory), hasSideEffects, false });
+		return _passes.size() - 1;
+	}
+
+	FrameGraph::PassId FrameGraph::AddPass(std::string_view name, std::vector<Usage>&& usages, const std::shared_ptr<BaseTask>& task, bool hasSideEffects)
+	{
+		return AddPass(name, std::move(usages), [task](const FrameGraph&)
+		{
+			return task;
+		}, hasSideEffects);
+	}
+
+	void FrameGraph::Compile()
+	{
+		assert(!_compiled);
+
+		CullPasses();
+		PlaceTransients();
+		BuildBarriers();
+
+		_compiled = true;
+	}
+
+	void FrameGraph::Reset()
+	{
+		_resources.clear();
+		_passes.clear();
+		_compiledPasses.clear();
+		_transientArenaByteLength = 0;
+		_transientArena.reset();
+		_compiled = false;
+	}
+
+	bool FrameGraph::IsCompiled() const
+	{
+		return _compiled;
+	}
+
+	const std::vector<FrameGraph::CompiledPass>& FrameGraph::GetCompiledPasses() const
+	{
+		assert(_compiled);
+		return _compiledPasses;
+	}
+
+	bool FrameGraph::IsPassCulled(PassId pass) const
+	{
+		assert(_compiled);
+		return _passes.at(pass).culled;
+	}
+
+	std::string_view FrameGraph::GetPassName(PassId pass) const
+	{
+		return _passes.at(pass).name;
+	}
+
+	std::shared_ptr<BaseTask> FrameGraph::CreatePassTask(PassId pass) const
+	{
+		const auto& factory = _passes.at(pass).taskFactory;
+		return factory ? factory(*this) : BaseTask::kEmpty;
+	}
+
+	std::size_t FrameGraph::GetResourcesCount() const
+	{
+		return _resources.size();
+	}
+
+	bool FrameGraph::IsTransient(ResourceId resource) const
+	{
+		return _resources.at(resource).imported == nullptr;
+	}
+
+	std::shared_ptr<Buffer> FrameGraph::GetImportedBuffer(ResourceId resource) const
+	{
+		return _resources.at(resource).imported;
+	}
+
+	const FrameGraph::TransientPlacement& FrameGraph::GetTransientPlacement(ResourceId resource) const
+	{
+		assert(_compiled);
+		assert(IsTransient(resource));
+		assert(_resources.at(resource).placement.has_value());
+		return _resources.at(resource).placement.value();
+	}
+
+	std::size_t FrameGraph::GetTransientArenaByteLength() const
+	{
+		assert(_compiled);
+		return _transientArenaByteLength;
+	}
+
+	void FrameGraph::BindTransientArena(const std::shared_ptr<Buffer>& arena)
+	{
+		assert(_compiled);
+		assert(!arena || arena->GetSettings().byteLength >= _transientArenaByteLength);
+		_transientArena = arena;
+	}
+
+	std::shared_ptr<Buffer> FrameGraph::GetTransientArena() const
+	{
+		return _transientArena;
+	}
+
+	void FrameGraph::CullPasses()
+	{
+		std::vector<bool> needed(_resources.size(), false);
+
+		for (auto it = _passes.rbegin(); it != _passes.rend(); ++it)
+		{
+			auto& pass = *it;
+			auto alive = pass.hasSideEffects;
+
+			for (const auto& usage : pass.usages)
+			{
+				if ((usage.access & Access::kWriteMask) && (!IsTransient(usage.resource) || needed[usage.resource]))
+				{
+					alive = true;
+				}
+			}
+
+			pass.culled = !alive;
+
+			if (alive)
+			{
+				for (const auto& usage : pass.usages)
+				{
+					if (usage.access & ~Access::kWriteMask)
+					{
+						needed[usage.resource] = true;
+					}
+				}
+			}
+		}
+	}
+
+	void FrameGraph::PlaceTransients()
+	{
+		for (std::size_t passIndex = 0; passIndex < _passes.size(); ++passIndex)
+		{
+			if (_passes[passIndex].culled)
+			{
+				continue;
+			}
+
+			for (const auto& usage : _passes[passIndex].usages)
+			{
+				auto& lifetime = _resources[usage.resource].lifetime;
+				if (lifetime.has_value())
+				{
+					lifetime.value().second = passIndex;
+				}
+				else
+				{
+					lifetime = std::make_pair(passIndex, passIndex);
+				}
+			}
+		}
+
+		std::vector<ResourceId> transients {};
+		for (ResourceId id = 0; id < _resources.size(); ++id)
+		{
+			if (IsTransient(id) && _resources[id].lifetime.has_value())
+			{
+				transients.push_back(id);
+			}
+		}
+
+		std::stable_sort(transients.begin(), transients.end(), [this](ResourceId lhs, ResourceId rhs)
+		{
+			return _resources[lhs].byteLength > _resources[rhs].byteLength;
+		});
+
+		const auto lifetimesOverlap = [this](ResourceId lhs, ResourceId rhs)
+		{
+			const auto& l = _resources[lhs].lifetime.value();
+			const auto& r = _resources[rhs].lifetime.value();
+			return !(l.second < r.first || r.second < l.first);
+		};
+
+		const auto memoryOverlaps = [](const TransientPlacement& lhs, const TransientPlacement& rhs)
+		{
+			return lhs.byteOffset < rhs.byteOffset + rhs.byteLength && rhs.byteOffset < lhs.byteOffset + lhs.byteLength;
+		};
+
+		const auto alignUp = [](std::size_t value, std::size_t alignment)
+		{
+			return (value + alignment - 1) / alignment * alignment;
+		};
+
+		_transientArenaByteLength = 0;
+		std::vector<ResourceId> placed {};
+
+		for (const auto id : transients)
+		{
+			auto& resource = _resources[id];
+
+			std::vector<ResourceId> conflicts {};
+			std::vector<std::size_t> candidates { 0 };
+
+			for (const auto other : placed)
+			{
+				if (lifetimesOverlap(id, other))
+				{
+					const auto& otherPlacement = _resources[other].placement.value();
+					conflicts.push_back(other);
+					candidates.push_back(alignUp(otherPlacement.byteOffset + otherPlacement.byteLength, resource.alignment));
+				}
+			}
+
+			std::sort(candidates.begin(), candidates.end());
+
+			for (const auto candidate : candidates)
+			{
+				const TransientPlacement placement { candidate, resource.byteLength };
+				const auto fits = std::none_of(conflicts.cbegin(), conflicts.cend(), [this, &placement, &memoryOverlaps](ResourceId other)
+				{
+					return memoryOverlaps(placement, _resources[other].placement.value());
+				});
+
+				if (fits)
+				{
+					resource.placement = placement;
+					break;
+				}
+			}
+
+			assert(resource.placement.has_value());
+			_transientArenaByteLength = (std::max)(_transientArenaByteLength, resource.placement.value().byteOffset + resource.placement.value().byteLength);
+			placed.push_back(id);
+		}
+
+		for (const auto id : placed)
+		{
+			for (const auto other : placed)
+			{
+				if (id != other
+					&& _resources[other].lifetime.value().second < _resources[id].lifetime.value().first
+					&& memoryOverlaps(_resources[id].placement.value(), _resources[other].placement.value()))
+				{
+					_resources[id].aliasedPredecessors.push_back(other);
+				}
+			}
+		}
+	}
+
+	void FrameGraph::BuildBarriers()
+	{
+		std::vector<AccessTracker> trackers(_resources.size(), AccessTracker { Access::kWriteMask });
+		std::vector<bool> touched(_resources.size(), false);
+
+		for (ResourceId id = 0; id < _resources.size(); ++id)
+		{
+			const auto& resource = _resources[id];
+
+			if (resource.initialAccess & Access::kWriteMask)
+			{
+				trackers[id].Reset(resource.initialStage, resource.initialAccess);
+			}
+			else
+			{
+				trackers[id].Reset(Stage::kNone, Access::kNone, resource.initialStage);
+			}
+		}
+
+		_compiledPasses.clear();
+
+		for (PassId passIndex = 0; passIndex < _passes.size(); ++passIndex)
+		{
+			const auto& pass = _passes[passIndex];
+
+			if (pass.culled)
+			{
+				continue;
+			}
+
+			std::vector<Usage> merged {};
+			for (const auto& usage : pass.usages)
+			{
+				const auto it = std::find_if(merged.begin(), merged.end(), [&usage](const Usage& u)
+				{
+					return u.resource == usage.resource;
+				});
+
+				if (it == merged.end())
+				{
+					merged.push_back(usage);
+				}
+				else
+				{
+					it->stage |= usage.stage;
+					it->access |= usage.access;
+				}
+			}
+
+			CompiledPass compiledPass { passIndex, {}, merged };
+
+			for (const auto& usage : merged)
+			{
+				auto& tracker = trackers[usage.resource];
+
+				if (!touched[usage.resource])
+				{
+					touched[usage.resource] = true;
+
+					for (const auto predecessor : _resources[usage.resource].aliasedPredecessors)
+					{
+						tracker.Alias(trackers[predecessor]);
+					}
+				}
+
+				if (const auto barrier = tracker.Track(usage.stage, usage.access))
+				{
+					compiledPass.barriers.push_back(Barrier { usage.resource, barrier->srcStage, barrier->srcAccess, usage.stage, usage.access });
+				}
+			}
+
+			_compiledPasses.push_back(std::move(compiledPass));
+		}
+	}
+
+	FrameGraphJob::FrameGraphJob(const std::shared_ptr<FrameGraph>& graph) : _graph(graph), _executionContext(std::make_shared<DynamicBatchTaskContext>())
+	{
+		assert(_graph);
+	}
+
+	std::shared_ptr<BaseTask> FrameGraphJob::CreateBarrierTask(const FrameGraph::CompiledPass&)
+	{
+		return BaseTask::kEmpty;
+	}
+
+	std::shared_ptr<BaseTask> FrameGraphJob::CreateCompletionTask()
+	{
+		return BaseTask::kEmpty;
+	}
+
+	std::shared_ptr<BaseTask> FrameGraphJob::CreateInitializationTask()
+	{
+		const auto job = std::dynamic_pointer_cast<FrameGraphJob>(shared_from_this());
+
+		return std::make_shared<FunctionalTask>(
+			[job](const auto& stream)
+			{
+				const auto& graph = job->_graph;
+
+				if (!graph->IsCompiled())
+				{
+					graph->Compile();
+				}
+
+				if (const auto byteLength = graph->GetTransientArenaByteLength(); byteLength > 0)
+				{
+					if (!job->_transientArena || job->_transientArena->GetSettings().byteLength < byteLength)
+					{
+						job->_transientArena = job->CreateTransientArena(byteLength);
+						stream->Schedule(job->_transientArena->CreateInitializationTask());
+					}
+
+					graph->BindTransientArena(job->_transientArena);
+				}
+
+				auto& tasks = job->_executionContext->tasks;
+				tasks.clear();
+
+				for (const auto& compiledPass : graph->GetCompiledPasses())
+				{
+					if (const auto barrierTask = job->CreateBarrierTask(compiledPass); barrierTask != BaseTask::kEmpty)
+					{
+						tasks.push_back(barrierTask);
+					}
+
+					tasks.push_back(graph->CreatePassTask(compiledPass.pass));
+				}
+
+				if (const auto completionTask = job->CreateCompletionTask(); completionTask != BaseTask::kEmpty)
+				{
+					tasks.push_back(completionTask);
+				}
+			},
+			FunctionalTask::Handler {},
+			FunctionalTask::Handler {}
+		);
+	}
+
+	std::shared_ptr<BaseTask> FrameGraphJob::CreateExecutionTask()
+	{
+		return std::make_shared<DynamicBatchTask>(_executionContext);
+	}
+
+	std::shared_ptr<FrameGraph> FrameGraphJob::GetGraph() const
+	{
+		return _graph;
+	}
+}
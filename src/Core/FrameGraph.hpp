@@ -0,0 +1,160 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include <Core/AccessTracker.hpp>
+#include <Core/Buffer.hpp>
+#include <Core/Job.hpp>
+
+namespace MMPEngine::Core
+{
+	class FrameGraph final : public std::enable_shared_from_this<FrameGraph>
+	{
+	public:
+		using ResourceId = std::size_t;
+		using PassId = std::size_t;
+		using StageFlags = std::uint32_t;
+		using AccessFlags = std::uint32_t;
+		using TaskFactory = std::function<std::shared_ptr<BaseTask>(const FrameGraph& graph)>;
+
+		struct Stage final
+		{
+			static constexpr StageFlags kNone = 0;
+			static constexpr StageFlags kHost = 1 << 0;
+			static constexpr StageFlags kTransfer = 1 << 1;
+			static constexpr StageFlags kDrawIndirect = 1 << 2;
+			static constexpr StageFlags kVertexInput = 1 << 3;
+			static constexpr StageFlags kVertexShader = 1 << 4;
+			static constexpr StageFlags kFragmentShader = 1 << 5;
+			static constexpr StageFlags kComputeShader = 1 << 6;
+		};
+
+		struct Access final
+		{
+			static constexpr AccessFlags kNone = 0;
+			static constexpr AccessFlags kIndirectRead = 1 << 0;
+			static constexpr AccessFlags kIndexRead = 1 << 1;
+			static constexpr AccessFlags kVertexRead = 1 << 2;
+			static constexpr AccessFlags kUniformRead = 1 << 3;
+			static constexpr AccessFlags kShaderRead = 1 << 4;
+			static constexpr AccessFlags kShaderWrite = 1 << 5;
+			static constexpr AccessFlags kTransferRead = 1 << 6;
+			static constexpr AccessFlags kTransferWrite = 1 << 7;
+			static constexpr AccessFlags kHostRead = 1 << 8;
+			static constexpr AccessFlags kHostWrite = 1 << 9;
+
+			static constexpr AccessFlags kWriteMask = kShaderWrite | kTransferWrite | kHostWrite;
+		};
+
+		struct Usage final
+		{
+			ResourceId resource;
+			StageFlags stage;
+			AccessFlags access;
+		};
+
+		struct Barrier final
+		{
+			ResourceId resource;
+			StageFlags srcStage;
+			AccessFlags srcAccess;
+			StageFlags dstStage;
+			AccessFlags dstAccess;
+		};
+
+		struct CompiledPass final
+		{
+			PassId pass;
+			std::vector<Barrier> barriers;
+			std::vector<Usage> usages;
+		};
+
+		struct TransientPlacement final
+		{
+			std::size_t byteOffset;
+			std::size_t byteLength;
+		};
+
+		FrameGraph();
+		FrameGraph(const FrameGraph&) = delete;
+		FrameGraph(FrameGraph&&) noexcept = delete;
+		FrameGraph& operator=(const FrameGraph&) = delete;
+		FrameGraph& operator=(FrameGraph&&) noexcept = delete;
+		~FrameGraph();
+
+		ResourceId Import(const std::shared_ptr<Buffer>& buffer, StageFlags initialStage = Stage::kTransfer, AccessFlags initialAccess = Access::kTransferWrite);
+		ResourceId CreateTransient(std::size_t byteLength, std::size_t alignment = 256);
+		PassId AddPass(std::string_view name, std::vector<Usage>&& usages, TaskFactory&& taskFactory, bool hasSideEffects = true);
+		PassId AddPass(std::string_view name, std::vector<Usage>&& usages, const std::shared_ptr<BaseTask>& task, bool hasSideEffects = true);
+
+		void Compile();
+		void Reset();
+		bool IsCompiled() const;
+		const std::vector<CompiledPass>& GetCompiledPasses() const;
+		bool IsPassCulled(PassId pass) const;
+		std::string_view GetPassName(PassId pass) const;
+		std::shared_ptr<BaseTask> CreatePassTask(PassId pass) const;
+
+		std::size_t GetResourcesCount() const;
+		bool IsTransient(ResourceId resource) const;
+		std::shared_ptr<Buffer> GetImportedBuffer(ResourceId resource) const;
+		const TransientPlacement& GetTransientPlacement(ResourceId resource) const;
+		std::size_t GetTransientArenaByteLength() const;
+
+		void BindTransientArena(const std::shared_ptr<Buffer>& arena);
+		std::shared_ptr<Buffer> GetTransientArena() const;
+
+	private:
+
+		struct Resource final
+		{
+			std::shared_ptr<Buffer> imported;
+			std::size_t byteLength;
+			std::size_t alignment;
+			StageFlags initialStage;
+			AccessFlags initialAccess;
+			std::optional<TransientPlacement> placement;
+			std::vector<ResourceId> aliasedPredecessors;
+			std::optional<std::pair<std::size_t, std::size_t>> lifetime;
+		};
+
+		struct Pass final
+		{
+			std::string name;
+			std::vector<Usage> usages;
+			TaskFactory taskFactory;
+			bool hasSideEffects;
+			bool culled;
+		};
+
+		void CullPasses();
+		void PlaceTransients();
+		void BuildBarriers();
+
+		std::vector<Resource> _resources;
+		std::vector<Pass> _passes;
+		std::vector<CompiledPass> _compiledPasses;
+		std::size_t _transientArenaByteLength = 0;
+		std::shared_ptr<Buffer> _transientArena;
+		bool _compiled = false;
+	};
+
+	class FrameGraphJob : public Job<void>
+	{
+	protected:
+		FrameGraphJob(const std::shared_ptr<FrameGraph>& graph);
+		virtual std::shared_ptr<Buffer> CreateTransientArena(std::size_t byteLength) = 0;
+		virtual std::shared_ptr<BaseTask> CreateBarrierTask(const FrameGraph::CompiledPass& pass);
+		virtual std::shared_ptr<BaseTask> CreateCompletionTask();
+	public:
+		std::shared_ptr<BaseTask> CreateInitializationTask() override;
+		std::shared_ptr<BaseTask> CreateExecutionTask() override;
+		std::shared_ptr<FrameGraph> GetGraph() const;
+	protected:
+		std::shared_ptr<FrameGraph> _graph;
+		std::shared_ptr<DynamicBatchTaskContext> _executionContext;
+		std::shared_ptr<Buffer> _transientArena;
+	};
+}
\ No newline at end of file
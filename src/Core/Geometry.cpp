@@ -1,4 +1,6 @@
 #include <Core/Geometry.hpp>
+#include <cassert>
+#include <cstring>
 
 namespace MMPEngine::Core
 {
@@ -165,6 +167,249 @@ namespace MMPEngine::Core
 		return GeometryBufferPrototype::GetStride();
 	}
 
+	VertexBufferPrototypeHalf2::VertexBufferPrototypeHalf2(const Settings& settings) :
+		BaseGeometryBufferPrototype(settings.base),
+		VertexBufferPrototype(settings.vb),
+		GeometryBufferPrototype(settings.base)
+	{
+	}
+
+	VertexBufferPrototype::Format VertexBufferPrototypeHalf2::GetFormat() const
+	{
+		return Format::Half2;
+	}
+
+	const void* VertexBufferPrototypeHalf2::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t VertexBufferPrototypeHalf2::GetElementsCount() const
+	{
+		return GeometryBufferPrototype::GetElementsCount();
+	}
+
+	std::size_t VertexBufferPrototypeHalf2::GetStride() const
+	{
+		return GeometryBufferPrototype::GetStride();
+	}
+
+	VertexBufferPrototypeHalf4::VertexBufferPrototypeHalf4(const Settings& settings) :
+		BaseGeometryBufferPrototype(settings.base),
+		VertexBufferPrototype(settings.vb),
+		GeometryBufferPrototype(settings.base)
+	{
+	}
+
+	VertexBufferPrototype::Format VertexBufferPrototypeHalf4::GetFormat() const
+	{
+		return Format::Half4;
+	}
+
+	const void* VertexBufferPrototypeHalf4::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t VertexBufferPrototypeHalf4::GetElementsCount() const
+	{
+		return GeometryBufferPrototype::GetElementsCount();
+	}
+
+	std::size_t VertexBufferPrototypeHalf4::GetStride() const
+	{
+		return GeometryBufferPrototype::GetStride();
+	}
+
+	VertexBufferPrototypeSnorm8x4::VertexBufferPrototypeSnorm8x4(const Settings& settings) :
+		BaseGeometryBufferPrototype(settings.base),
+		VertexBufferPrototype(settings.vb),
+		GeometryBufferPrototype(settings.base)
+	{
+	}
+
+	VertexBufferPrototype::Format VertexBufferPrototypeSnorm8x4::GetFormat() const
+	{
+		return Format::Snorm8x4;
+	}
+
+	const void* VertexBufferPrototypeSnorm8x4::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t VertexBufferPrototypeSnorm8x4::GetElementsCount() const
+	{
+		return GeometryBufferPrototype::GetElementsCount();
+	}
+
+	std::size_t VertexBufferPrototypeSnorm8x4::GetStride() const
+	{
+		return GeometryBufferPrototype::GetStride();
+	}
+
+	VertexBufferPrototypeUnorm8x4::VertexBufferPrototypeUnorm8x4(const Settings& settings) :
+		BaseGeometryBufferPrototype(settings.base),
+		VertexBufferPrototype(settings.vb),
+		GeometryBufferPrototype(settings.base)
+	{
+	}
+
+	VertexBufferPrototype::Format VertexBufferPrototypeUnorm8x4::GetFormat() const
+	{
+		return Format::Unorm8x4;
+	}
+
+	const void* VertexBufferPrototypeUnorm8x4::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t VertexBufferPrototypeUnorm8x4::GetElementsCount() const
+	{
+		return GeometryBufferPrototype::GetElementsCount();
+	}
+
+	std::size_t VertexBufferPrototypeUnorm8x4::GetStride() const
+	{
+		return GeometryBufferPrototype::GetStride();
+	}
+
+	VertexBufferPrototypeSnorm16x2::VertexBufferPrototypeSnorm16x2(const Settings& settings) :
+		BaseGeometryBufferPrototype(settings.base),
+		VertexBufferPrototype(settings.vb),
+		GeometryBufferPrototype(settings.base)
+	{
+	}
+
+	VertexBufferPrototype::Format VertexBufferPrototypeSnorm16x2::GetFormat() const
+	{
+		return Format::Snorm16x2;
+	}
+
+	const void* VertexBufferPrototypeSnorm16x2::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t VertexBufferPrototypeSnorm16x2::GetElementsCount() const
+	{
+		return GeometryBufferPrototype::GetElementsCount();
+	}
+
+	std::size_t VertexBufferPrototypeSnorm16x2::GetStride() const
+	{
+		return GeometryBufferPrototype::GetStride();
+	}
+
+	VertexBufferPrototypeSnorm16x4::VertexBufferPrototypeSnorm16x4(const Settings& settings) :
+		BaseGeometryBufferPrototype(settings.base),
+		VertexBufferPrototype(settings.vb),
+		GeometryBufferPrototype(settings.base)
+	{
+	}
+
+	VertexBufferPrototype::Format VertexBufferPrototypeSnorm16x4::GetFormat() const
+	{
+		return Format::Snorm16x4;
+	}
+
+	const void* VertexBufferPrototypeSnorm16x4::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t VertexBufferPrototypeSnorm16x4::GetElementsCount() const
+	{
+		return GeometryBufferPrototype::GetElementsCount();
+	}
+
+	std::size_t VertexBufferPrototypeSnorm16x4::GetStride() const
+	{
+		return GeometryBufferPrototype::GetStride();
+	}
+
+	VertexBufferPrototypeUnorm16x2::VertexBufferPrototypeUnorm16x2(const Settings& settings) :
+		BaseGeometryBufferPrototype(settings.base),
+		VertexBufferPrototype(settings.vb),
+		GeometryBufferPrototype(settings.base)
+	{
+	}
+
+	VertexBufferPrototype::Format VertexBufferPrototypeUnorm16x2::GetFormat() const
+	{
+		return Format::Unorm16x2;
+	}
+
+	const void* VertexBufferPrototypeUnorm16x2::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t VertexBufferPrototypeUnorm16x2::GetElementsCount() const
+	{
+		return GeometryBufferPrototype::GetElementsCount();
+	}
+
+	std::size_t VertexBufferPrototypeUnorm16x2::GetStride() const
+	{
+		return GeometryBufferPrototype::GetStride();
+	}
+
+	VertexBufferPrototypeUnorm16x4::VertexBufferPrototypeUnorm16x4(const Settings& settings) :
+		BaseGeometryBufferPrototype(settings.base),
+		VertexBufferPrototype(settings.vb),
+		GeometryBufferPrototype(settings.base)
+	{
+	}
+
+	VertexBufferPrototype::Format VertexBufferPrototypeUnorm16x4::GetFormat() const
+	{
+		return Format::Unorm16x4;
+	}
+
+	const void* VertexBufferPrototypeUnorm16x4::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t VertexBufferPrototypeUnorm16x4::GetElementsCount() const
+	{
+		return GeometryBufferPrototype::GetElementsCount();
+	}
+
+	std::size_t VertexBufferPrototypeUnorm16x4::GetStride() const
+	{
+		return GeometryBufferPrototype::GetStride();
+	}
+
+	VertexBufferPrototypeUnorm10_10_10_2::VertexBufferPrototypeUnorm10_10_10_2(const Settings& settings) :
+		BaseGeometryBufferPrototype(settings.base),
+		VertexBufferPrototype(settings.vb),
+		GeometryBufferPrototype(settings.base)
+	{
+	}
+
+	VertexBufferPrototype::Format VertexBufferPrototypeUnorm10_10_10_2::GetFormat() const
+	{
+		return Format::Unorm10_10_10_2;
+	}
+
+	const void* VertexBufferPrototypeUnorm10_10_10_2::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t VertexBufferPrototypeUnorm10_10_10_2::GetElementsCount() const
+	{
+		return GeometryBufferPrototype::GetElementsCount();
+	}
+
+	std::size_t VertexBufferPrototypeUnorm10_10_10_2::GetStride() const
+	{
+		return GeometryBufferPrototype::GetStride();
+	}
+
 	IndexBufferPrototype16::IndexBufferPrototype16(const Settings& settings) :
 		BaseGeometryBufferPrototype(settings),
 		IndexBufferPrototype(),
@@ -219,6 +464,57 @@ namespace MMPEngine::Core
 		return GeometryBufferPrototype::GetStride();
 	}
 
+	InterleavedVertexBufferPrototype::InterleavedVertexBufferPrototype(const std::vector<const VertexBufferPrototype*>& streams, const Settings& settings) :
+		BaseGeometryBufferPrototype(settings),
+		GeometryBufferPrototype(settings),
+		_stride(0)
+	{
+		assert(!streams.empty());
+		const auto elementsCount = streams.front()->GetElementsCount();
+
+		for (const auto stream : streams)
+		{
+			assert(stream->GetElementsCount() == elementsCount);
+			assert(stream->GetStride() % sizeof(std::uint32_t) == 0);
+			_elements.push_back({ { stream->GetVBSettings(), stream->GetSettings() }, stream->GetFormat(), _stride });
+			_stride += stream->GetStride();
+		}
+
+		data.resize(elementsCount * _stride);
+
+		for (std::size_t s = 0; s < streams.size(); ++s)
+		{
+			const auto src = static_cast<const std::uint8_t*>(streams[s]->GetDataPtr());
+			const auto srcStride = streams[s]->GetStride();
+			auto dst = data.data() + _elements[s].offset;
+
+			for (std::size_t v = 0; v < elementsCount; ++v)
+			{
+				std::memcpy(dst + v * _stride, src + v * srcStride, srcStride);
+			}
+		}
+	}
+
+	const void* InterleavedVertexBufferPrototype::GetDataPtr() const
+	{
+		return GeometryBufferPrototype::GetDataPtr();
+	}
+
+	std::size_t InterleavedVertexBufferPrototype::GetElementsCount() const
+	{
+		return _stride == 0 ? 0 : data.size() / _stride;
+	}
+
+	std::size_t InterleavedVertexBufferPrototype::GetStride() const
+	{
+		return _stride;
+	}
+
+	const std::vector<InterleavedVertexBufferPrototype::Element>& InterleavedVertexBufferPrototype::GetElements() const
+	{
+		return _elements;
+	}
+
 	bool GeometryPrototype::VertexAttribute::operator==(const VertexAttribute& rhs) const
 	{
 		return (type == rhs.type && index == rhs.index);
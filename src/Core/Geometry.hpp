@@ -4,6 +4,69 @@
 
 namespace MMPEngine::Core
 {
+	struct Vector2Half final
+	{
+		std::uint16_t x;
+		std::uint16_t y;
+	};
+
+	struct Vector4Half final
+	{
+		std::uint16_t x;
+		std::uint16_t y;
+		std::uint16_t z;
+		std::uint16_t w;
+	};
+
+	struct Vector4Snorm8 final
+	{
+		std::int8_t x;
+		std::int8_t y;
+		std::int8_t z;
+		std::int8_t w;
+	};
+
+	struct Vector4Unorm8 final
+	{
+		std::uint8_t x;
+		std::uint8_t y;
+		std::uint8_t z;
+		std::uint8_t w;
+	};
+
+	struct Vector2Snorm16 final
+	{
+		std::int16_t x;
+		std::int16_t y;
+	};
+
+	struct Vector4Snorm16 final
+	{
+		std::int16_t x;
+		std::int16_t y;
+		std::int16_t z;
+		std::int16_t w;
+	};
+
+	struct Vector2Unorm16 final
+	{
+		std::uint16_t x;
+		std::uint16_t y;
+	};
+
+	struct Vector4Unorm16 final
+	{
+		std::uint16_t x;
+		std::uint16_t y;
+		std::uint16_t z;
+		std::uint16_t w;
+	};
+
+	struct PackedUnorm10_10_10_2 final
+	{
+		std::uint32_t value;
+	};
+
 	class BaseGeometryBufferPrototype
 	{
 	public:
@@ -57,6 +120,15 @@ namespace MMPEngine::Core
 			Float3,
 			Float4,
 			Uint4,
+			Half2,
+			Half4,
+			Snorm8x4,
+			Unorm8x4,
+			Snorm16x2,
+			Snorm16x4,
+			Unorm16x2,
+			Unorm16x4,
+			Unorm10_10_10_2,
 		};
 		enum class Semantics : std::uint8_t
 		{
@@ -176,6 +248,126 @@ namespace MMPEngine::Core
 		std::size_t GetStride() const override;
 	};
 
+	class VertexBufferPrototypeHalf2 final : public VertexBufferPrototype, public GeometryBufferPrototype<Vector2Half>
+	{
+	public:
+		explicit VertexBufferPrototypeHalf2(const Settings& settings);
+		Format GetFormat() const override;
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+	};
+
+	class VertexBufferPrototypeHalf4 final : public VertexBufferPrototype, public GeometryBufferPrototype<Vector4Half>
+	{
+	public:
+		explicit VertexBufferPrototypeHalf4(const Settings& settings);
+		Format GetFormat() const override;
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+	};
+
+	class VertexBufferPrototypeSnorm8x4 final : public VertexBufferPrototype, public GeometryBufferPrototype<Vector4Snorm8>
+	{
+	public:
+		explicit VertexBufferPrototypeSnorm8x4(const Settings& settings);
+		Format GetFormat() const override;
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+	};
+
+	class VertexBufferPrototypeUnorm8x4 final : public VertexBufferPrototype, public GeometryBufferPrototype<Vector4Unorm8>
+	{
+	public:
+		explicit VertexBufferPrototypeUnorm8x4(const Settings& settings);
+		Format GetFormat() const override;
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+	};
+
+	class VertexBufferPrototypeSnorm16x2 final : public VertexBufferPrototype, public GeometryBufferPrototype<Vector2Snorm16>
+	{
+	public:
+		explicit VertexBufferPrototypeSnorm16x2(const Settings& settings);
+		Format GetFormat() const override;
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+	};
+
+	class VertexBufferPrototypeSnorm16x4 final : public VertexBufferPrototype, public GeometryBufferPrototype<Vector4Snorm16>
+	{
+	public:
+		explicit VertexBufferPrototypeSnorm16x4(const Settings& settings);
+		Format GetFormat() const override;
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+	};
+
+	class VertexBufferPrototypeUnorm16x2 final : public VertexBufferPrototype, public GeometryBufferPrototype<Vector2Unorm16>
+	{
+	public:
+		explicit VertexBufferPrototypeUnorm16x2(const Settings& settings);
+		Format GetFormat() const override;
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+	};
+
+	class VertexBufferPrototypeUnorm16x4 final : public VertexBufferPrototype, public GeometryBufferPrototype<Vector4Unorm16>
+	{
+	public:
+		explicit VertexBufferPrototypeUnorm16x4(const Settings& settings);
+		Format GetFormat() const override;
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+	};
+
+	class VertexBufferPrototypeUnorm10_10_10_2 final : public VertexBufferPrototype, public GeometryBufferPrototype<PackedUnorm10_10_10_2>
+	{
+	public:
+		explicit VertexBufferPrototypeUnorm10_10_10_2(const Settings& settings);
+		Format GetFormat() const override;
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+	};
+
+	class InterleavedVertexBufferPrototype final : public GeometryBufferPrototype<std::uint8_t>
+	{
+	public:
+		struct Element final
+		{
+			VertexBufferPrototype::Settings settings;
+			VertexBufferPrototype::Format format;
+			std::size_t offset;
+		};
+
+		InterleavedVertexBufferPrototype(const std::vector<const VertexBufferPrototype*>& streams, const Settings& settings);
+
+		const void* GetDataPtr() const override;
+		std::size_t GetElementsCount() const override;
+		std::size_t GetStride() const override;
+		const std::vector<Element>& GetElements() const;
+	private:
+		std::vector<Element> _elements;
+		std::size_t _stride;
+	};
+
 	class GeometryPrototype final
 	{
 	public:
@@ -0,0 +1,129 @@
+#include <Core/GeometryArena.hpp>
+#include <cassert>
+
+namespace MMPEngine::Core
+{
+	GeometryArena::GeometryArena(const Settings& settings) : _settings(settings)
+	{
+	}
+
+	GeometryArena::~GeometryArena() = default;
+
+	const GeometryArena::Settings& GeometryArena::GetSettings() const
+	{
+		return _settings;
+	}
+
+	GeometryArena::Allocation GeometryArena::AllocateVertices(std::size_t stride, std::size_t verticesCount)
+	{
+		assert(stride > 0);
+
+		auto& heap = _vertexHeaps[stride];
+
+		if (!heap)
+		{
+			heap = std::make_shared<BufferHeap>(Heap::Settings { _settings.vertexBlockByteSize, 1, false }, stride, [this](std::size_t byteLength)
+			{
+				return CreateVertexBlockBuffer(byteLength);
+			});
+		}
+
+		return { heap, heap->Allocate(verticesCount) };
+	}
+
+	GeometryArena::Allocation GeometryArena::AllocateIndices(IndexBufferPrototype::Format format, std::size_t indicesCount)
+	{
+		auto& heap = _indexHeaps[format];
+
+		if (!heap)
+		{
+			const auto stride = format == IndexBufferPrototype::Format::Uint16 ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+			heap = std::make_shared<BufferHeap>(Heap::Settings { _settings.indexBlockByteSize, 1, false }, stride, [this](std::size_t byteLength)
+			{
+				return CreateIndexBlockBuffer(byteLength);
+			});
+		}
+
+		return { heap, heap->Allocate(indicesCount) };
+	}
+
+	std::shared_ptr<BaseTask> GeometryArena::CreateWriteTask(const Allocation& allocation, const void* data)
+	{
+		assert(allocation.heap);
+		assert(data);
+
+		const auto byteLength = allocation.handle.GetSize();
+		const auto upload = CreateUploadBuffer(byteLength);
+
+		return std::make_shared<StaticBatchTask>(std::initializer_list<std::shared_ptr<BaseTask>>{
+			allocation.heap->CreateTaskToInitializeBlocks(),
+			upload->CreateInitializationTask(),
+			StreamBarrierTask::kInstance,
+			upload->CreateWriteTask(data, byteLength, 0),
+			upload->CreateCopyToBufferTask(allocation.handle.GetBuffer(), byteLength, 0, allocation.handle.GetOffset())
+		});
+	}
+
+	std::size_t GeometryArena::Allocation::GetFirstElement() const
+	{
+		assert(heap);
+		return handle.GetOffset() / heap->GetStride();
+	}
+
+	GeometryArena::BufferHeap::BufferHeap(const Settings& settings, std::size_t stride, Factory&& factory) : Heap(settings), _stride(stride), _factory(std::move(factory))
+	{
+	}
+
+	GeometryArena::BufferHeap::Handle GeometryArena::BufferHeap::Allocate(std::size_t elementsCount)
+	{
+		assert(elementsCount > 0);
+
+		const auto entry = AllocateEntry(Request { elementsCount * _stride, _stride });
+		return { shared_from_this(), entry, std::dynamic_pointer_cast<InputAssemblerBuffer>(GetBlockEntity(entry.blockIndex)) };
+	}
+
+	std::size_t GeometryArena::BufferHeap::GetStride() const
+	{
+		return _stride;
+	}
+
+	std::unique_ptr<Heap::Block> GeometryArena::BufferHeap::InstantiateBlock(std::size_t size)
+	{
+		return std::make_unique<Block>(size, _factory(size));
+	}
+
+	GeometryArena::BufferHeap::Block::Block(std::size_t size, const std::shared_ptr<InputAssemblerBuffer>& buffer) : Heap::Block(size), _buffer(buffer)
+	{
+	}
+
+	std::shared_ptr<BaseEntity> GeometryArena::BufferHeap::Block::GetEntity() const
+	{
+		return _buffer;
+	}
+
+	std::shared_ptr<InputAssemblerBuffer> GeometryArena::BufferHeap::Block::GetBuffer() const
+	{
+		return _buffer;
+	}
+
+	GeometryArena::BufferHeap::Handle::Handle() = default;
+
+	GeometryArena::BufferHeap::Handle::Handle(const std::shared_ptr<Heap>& heap, const Entry& entry, const std::shared_ptr<InputAssemblerBuffer>& buffer) : Heap::Handle(heap, entry), _buffer(buffer)
+	{
+	}
+
+	std::size_t GeometryArena::BufferHeap::Handle::GetOffset() const
+	{
+		return _entry->range.from;
+	}
+
+	std::size_t GeometryArena::BufferHeap::Handle::GetSize() const
+	{
+		return _entry->range.GetLength();
+	}
+
+	std::shared_ptr<InputAssemblerBuffer> GeometryArena::BufferHeap::Handle::GetBuffer() const
+	{
+		return _buffer;
+	}
+}
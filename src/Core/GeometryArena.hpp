@@ -0,0 +1,86 @@
+#pragma once
+#include <map>
+#include <functional>
+#include <Core/Heap.hpp>
+#include <Core/Buffer.hpp>
+#include <Core/Geometry.hpp>
+
+namespace MMPEngine::Core
+{
+	class GeometryArena : public std::enable_shared_from_this<GeometryArena>
+	{
+	public:
+		struct Settings final
+		{
+			std::size_t vertexBlockByteSize = 32 * 1024 * 1024;
+			std::size_t indexBlockByteSize = 8 * 1024 * 1024;
+		};
+
+		class BufferHeap final : public Heap
+		{
+		public:
+			using Factory = std::function<std::shared_ptr<InputAssemblerBuffer>(std::size_t byteLength)>;
+		private:
+			class Block final : public Heap::Block
+			{
+			public:
+				Block(std::size_t size, const std::shared_ptr<InputAssemblerBuffer>& buffer);
+				std::shared_ptr<BaseEntity> GetEntity() const override;
+				std::shared_ptr<InputAssemblerBuffer> GetBuffer() const;
+			private:
+				std::shared_ptr<InputAssemblerBuffer> _buffer;
+			};
+		public:
+			class Handle final : public Heap::Handle
+			{
+				friend BufferHeap;
+			public:
+				Handle();
+				std::size_t GetOffset() const;
+				std::size_t GetSize() const;
+				std::shared_ptr<InputAssemblerBuffer> GetBuffer() const;
+			protected:
+				Handle(const std::shared_ptr<Heap>& heap, const Entry& entry, const std::shared_ptr<InputAssemblerBuffer>& buffer);
+			private:
+				std::shared_ptr<InputAssemblerBuffer> _buffer;
+			};
+
+			BufferHeap(const Settings& settings, std::size_t stride, Factory&& factory);
+			Handle Allocate(std::size_t elementsCount);
+			std::size_t GetStride() const;
+		protected:
+			std::unique_ptr<Heap::Block> InstantiateBlock(std::size_t size) override;
+		private:
+			std::size_t _stride;
+			Factory _factory;
+		};
+
+		struct Allocation final
+		{
+			std::shared_ptr<BufferHeap> heap;
+			BufferHeap::Handle handle;
+
+			std::size_t GetFirstElement() const;
+		};
+
+		GeometryArena(const Settings& settings);
+		GeometryArena(const GeometryArena&) = delete;
+		GeometryArena(GeometryArena&&) noexcept = delete;
+		GeometryArena& operator=(const GeometryArena&) = delete;
+		GeometryArena& operator=(GeometryArena&&) noexcept = delete;
+		virtual ~GeometryArena();
+
+		Allocation AllocateVertices(std::size_t stride, std::size_t verticesCount);
+		Allocation AllocateIndices(IndexBufferPrototype::Format format, std::size_t indicesCount);
+		std::shared_ptr<BaseTask> CreateWriteTask(const Allocation& allocation, const void* data);
+		const Settings& GetSettings() const;
+	protected:
+		virtual std::shared_ptr<VertexBuffer> CreateVertexBlockBuffer(std::size_t byteLength) = 0;
+		virtual std::shared_ptr<IndexBuffer> CreateIndexBlockBuffer(std::size_t byteLength) = 0;
+		virtual std::shared_ptr<UploadBuffer> CreateUploadBuffer(std::size_t byteLength) = 0;
+	private:
+		Settings _settings;
+		std::map<std::size_t, std::shared_ptr<BufferHeap>> _vertexHeaps;
+		std::map<IndexBufferPrototype::Format, std::shared_ptr<BufferHeap>> _indexHeaps;
+	};
+}
@@ -0,0 +1,448 @@
+#include <Core/GeometryFile.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#ifdef MMPENGINE_WIN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace MMPEngine::Core
+{
+	static_assert(std::is_trivially_copyable_v<GeometryFile::Header>);
+	static_assert(std::is_trivially_copyable_v<GeometryFile::VertexStreamDesc>);
+	static_assert(std::is_trivially_copyable_v<GeometryPrototype::Subset>);
+
+	namespace
+	{
+		std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment)
+		{
+			return (value + alignment - 1) / alignment * alignment;
+		}
+
+		template<typename T>
+		struct TypeTag final
+		{
+			using Type = T;
+		};
+
+		template<typename TFunc>
+		auto VisitVertexFormat(VertexBufferPrototype::Format format, TFunc&& func)
+		{
+			switch (format)
+			{
+			case VertexBufferPrototype::Format::Float1:
+				return func(TypeTag<VertexBufferPrototypeFloat1> {});
+			case VertexBufferPrototype::Format::Float2:
+				return func(TypeTag<VertexBufferPrototypeFloat2> {});
+			case VertexBufferPrototype::Format::Float3:
+				return func(TypeTag<VertexBufferPrototypeFloat3> {});
+			case VertexBufferPrototype::Format::Float4:
+				return func(TypeTag<VertexBufferPrototypeFloat4> {});
+			case VertexBufferPrototype::Format::Uint4:
+				return func(TypeTag<VertexBufferPrototypeUint4> {});
+			case VertexBufferPrototype::Format::Half2:
+				return func(TypeTag<VertexBufferPrototypeHalf2> {});
+			case VertexBufferPrototype::Format::Half4:
+				return func(TypeTag<VertexBufferPrototypeHalf4> {});
+			case VertexBufferPrototype::Format::Snorm8x4:
+				return func(TypeTag<VertexBufferPrototypeSnorm8x4> {});
+			case VertexBufferPrototype::Format::Unorm8x4:
+				return func(TypeTag<VertexBufferPrototypeUnorm8x4> {});
+			case VertexBufferPrototype::Format::Snorm16x2:
+				return func(TypeTag<VertexBufferPrototypeSnorm16x2> {});
+			case VertexBufferPrototype::Format::Snorm16x4:
+				return func(TypeTag<VertexBufferPrototypeSnorm16x4> {});
+			case VertexBufferPrototype::Format::Unorm16x2:
+				return func(TypeTag<VertexBufferPrototypeUnorm16x2> {});
+			case VertexBufferPrototype::Format::Unorm16x4:
+				return func(TypeTag<VertexBufferPrototypeUnorm16x4> {});
+			case VertexBufferPrototype::Format::Unorm10_10_10_2:
+				return func(TypeTag<VertexBufferPrototypeUnorm10_10_10_2> {});
+			default:
+				throw std::runtime_error("geometry file vertex stream has invalid format");
+			}
+		}
+
+		std::size_t GetVertexFormatStride(VertexBufferPrototype::Format format)
+		{
+			return VisitVertexFormat(format, [](auto tag)
+			{
+				return sizeof(typename decltype(decltype(tag)::Type::data)::value_type);
+			});
+		}
+
+		std::size_t GetIndexFormatStride(IndexBufferPrototype::Format format)
+		{
+			switch (format)
+			{
+			case IndexBufferPrototype::Format::Uint16:
+				return sizeof(std::uint16_t);
+			case IndexBufferPrototype::Format::Uint32:
+				return sizeof(std::uint32_t);
+			default:
+				throw std::runtime_error("geometry file has invalid index format");
+			}
+		}
+
+		template<typename TStream>
+		std::unique_ptr<VertexBufferPrototype> CreateVertexStream(const GeometryFile::VertexStreamDesc& desc, const void* data)
+		{
+			auto stream = std::make_unique<TStream>(VertexBufferPrototype::Settings { { desc.semantics }, {} });
+			assert(stream->GetStride() == desc.stride);
+			stream->data.resize(static_cast<std::size_t>(desc.elementCount));
+			std::memcpy(stream->data.data(), data, static_cast<std::size_t>(desc.elementCount * desc.stride));
+			return stream;
+		}
+
+		template<typename TIndexBuffer>
+		std::unique_ptr<IndexBufferPrototype> CreateIndexBuffer(std::uint64_t count, const void* data)
+		{
+			auto indexBuffer = std::make_unique<TIndexBuffer>(IndexBufferPrototype::Settings {});
+			indexBuffer->data.resize(static_cast<std::size_t>(count));
+			std::memcpy(indexBuffer->data.data(), data, indexBuffer->GetByteLength());
+			return indexBuffer;
+		}
+	}
+
+	void GeometryFile::Write(const GeometryPrototype& proto, std::ostream& stream)
+	{
+		Header header {};
+		header.magic = kMagic;
+		header.version = kVersion;
+		header.vertexStreamCount = static_cast<std::uint32_t>(proto.vertexBuffers.size());
+		header.subsetCount = static_cast<std::uint32_t>(proto.subsets.size());
+		header.indexFormat = proto.indexBuffer ? proto.indexBuffer->GetFormat() : IndexBufferPrototype::Format::Uint16;
+		header.topology = proto.topology;
+		header.flags = proto.indexBuffer ? kFlagIndexBuffer : 0;
+		header.vertexCount = proto.vertexBuffers.empty() ? 0 : static_cast<std::uint32_t>(proto.vertexBuffers.front()->GetElementsCount());
+		header.indexCount = proto.indexBuffer ? proto.indexBuffer->GetElementsCount() : 0;
+		header.bounds = {
+			{ std::numeric_limits<std::float_t>::max(), std::numeric_limits<std::float_t>::max(), std::numeric_limits<std::float_t>::max() },
+			{ std::numeric_limits<std::float_t>::lowest(), std::numeric_limits<std::float_t>::lowest(), std::numeric_limits<std::float_t>::lowest() }
+		};
+
+		const auto positions = std::find_if(proto.vertexBuffers.cbegin(), proto.vertexBuffers.cend(), [](const auto& vb)
+		{
+			return vb->GetVBSettings().semantics == VertexBufferPrototype::Semantics::Position && vb->GetFormat() == VertexBufferPrototype::Format::Float3;
+		});
+
+		if (positions != proto.vertexBuffers.cend() && (*positions)->GetElementsCount() > 0)
+		{
+			const auto begin = static_cast<const Vector3Float*>((*positions)->GetDataPtr());
+			std::for_each(begin, begin + (*positions)->GetElementsCount(), [&header](const auto& p)
+			{
+				header.bounds.min = { std::min(header.bounds.min.x, p.x), std::min(header.bounds.min.y, p.y), std::min(header.bounds.min.z, p.z) };
+				header.bounds.max = { std::max(header.bounds.max.x, p.x), std::max(header.bounds.max.y, p.y), std::max(header.bounds.max.z, p.z) };
+			});
+		}
+		else
+		{
+			header.bounds = {};
+		}
+
+		std::vector<VertexStreamDesc> streamDescs(proto.vertexBuffers.size());
+		auto offset = AlignUp(sizeof(Header) + sizeof(VertexStreamDesc) * streamDescs.size() + sizeof(GeometryPrototype::Subset) * proto.subsets.size(), kDataAlignment);
+
+		for (std::size_t i = 0; i < proto.vertexBuffers.size(); ++i)
+		{
+			const auto& vb = proto.vertexBuffers[i];
+			auto& desc = streamDescs[i];
+			desc.format = vb->GetFormat();
+			desc.semantics = vb->GetVBSettings().semantics;
+			desc.reserved = 0;
+			desc.stride = static_cast<std::uint32_t>(vb->GetStride());
+			desc.elementCount = vb->GetElementsCount();
+			desc.byteOffset = offset;
+			offset = AlignUp(offset + vb->GetByteLength(), kDataAlignment);
+		}
+
+		header.indexByteOffset = offset;
+		header.fileByteLength = offset + (proto.indexBuffer ? proto.indexBuffer->GetByteLength() : 0);
+
+		std::uint64_t written = 0;
+		const auto write = [&stream, &written](const void* data, std::size_t byteLength)
+		{
+			stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(byteLength));
+			written += byteLength;
+		};
+		const auto pad = [&stream, &written](std::uint64_t to)
+		{
+			static constexpr char zeros[kDataAlignment] = {};
+			assert(to >= written && to - written <= kDataAlignment);
+			stream.write(zeros, static_cast<std::streamsize>(to - written));
+			written = to;
+		};
+
+		write(&header, sizeof(header));
+		write(streamDescs.data(), sizeof(VertexStreamDesc) * streamDescs.size());
+		write(proto.subsets.data(), sizeof(GeometryPrototype::Subset) * proto.subsets.size());
+
+		for (std::size_t i = 0; i < proto.vertexBuffers.size(); ++i)
+		{
+			pad(streamDescs[i].byteOffset);
+			write(proto.vertexBuffers[i]->GetDataPtr(), proto.vertexBuffers[i]->GetByteLength());
+		}
+
+		pad(header.indexByteOffset);
+
+		if (proto.indexBuffer)
+		{
+			write(proto.indexBuffer->GetDataPtr(), proto.indexBuffer->GetByteLength());
+		}
+	}
+
+	void GeometryFile::Write(const GeometryPrototype& proto, const std::filesystem::path& path)
+	{
+		std::ofstream file { path, std::ios::out | std::ios::binary | std::ios::trunc };
+
+		if (!file.is_open())
+		{
+			throw std::runtime_error("unable to open geometry file for writing: " + path.string());
+		}
+
+		Write(proto, file);
+	}
+
+	GeometryFile::GeometryFile(const std::filesystem::path& path) : _data(nullptr), _byteLength(0)
+	{
+#ifdef MMPENGINE_WIN
+		_mappingHandle = nullptr;
+		_fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (_fileHandle == INVALID_HANDLE_VALUE)
+		{
+			_fileHandle = nullptr;
+			throw std::runtime_error("unable to open geometry file: " + path.string());
+		}
+
+		LARGE_INTEGER size {};
+		GetFileSizeEx(_fileHandle, &size);
+		_byteLength = static_cast<std::size_t>(size.QuadPart);
+
+		if (_byteLength > 0)
+		{
+			_mappingHandle = CreateFileMappingW(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			_data = _mappingHandle ? static_cast<const std::uint8_t*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+		}
+#else
+		_fileDescriptor = open(path.c_str(), O_RDONLY);
+
+		if (_fileDescriptor < 0)
+		{
+			throw std::runtime_error("unable to open geometry file: " + path.string());
+		}
+
+		struct stat fileStat {};
+		fstat(_fileDescriptor, &fileStat);
+		_byteLength = static_cast<std::size_t>(fileStat.st_size);
+
+		if (_byteLength > 0)
+		{
+			const auto mapped = mmap(nullptr, _byteLength, PROT_READ, MAP_PRIVATE, _fileDescriptor, 0);
+			_data = mapped == MAP_FAILED ? nullptr : static_cast<const std::uint8_t*>(mapped);
+		}
+#endif
+
+		if (!_data)
+		{
+			Release();
+			throw std::runtime_error("unable to map geometry file: " + path.string());
+		}
+
+		try
+		{
+			Validate();
+		}
+		catch (...)
+		{
+			Release();
+			throw;
+		}
+	}
+
+	GeometryFile::~GeometryFile()
+	{
+		Release();
+	}
+
+	void GeometryFile::Release()
+	{
+#ifdef MMPENGINE_WIN
+		if (_data)
+		{
+			UnmapViewOfFile(_data);
+		}
+
+		if (_mappingHandle)
+		{
+			CloseHandle(_mappingHandle);
+		}
+
+		if (_fileHandle)
+		{
+			CloseHandle(_fileHandle);
+		}
+
+		_mappingHandle = nullptr;
+		_fileHandle = nullptr;
+#else
+		if (_data)
+		{
+			munmap(const_cast<std::uint8_t*>(_data), _byteLength);
+		}
+
+		if (_fileDescriptor >= 0)
+		{
+			close(_fileDescriptor);
+		}
+
+		_fileDescriptor = -1;
+#endif
+		_data = nullptr;
+	}
+
+	void GeometryFile::Validate() const
+	{
+		if (_byteLength < sizeof(Header))
+		{
+			throw std::runtime_error("geometry file is truncated");
+		}
+
+		const auto& header = GetHeader();
+
+		if (header.magic != kMagic)
+		{
+			throw std::runtime_error("geometry file has invalid magic");
+		}
+
+		if (header.version != kVersion)
+		{
+			throw UnsupportedException("unsupported geometry file version");
+		}
+
+		const auto tableEnd = sizeof(Header) + sizeof(VertexStreamDesc) * static_cast<std::uint64_t>(header.vertexStreamCount) + sizeof(GeometryPrototype::Subset) * static_cast<std::uint64_t>(header.subsetCount);
+
+		if (header.fileByteLength != _byteLength || tableEnd > _byteLength)
+		{
+			throw std::runtime_error("geometry file is truncated");
+		}
+
+		if (header.topology != GeometryPrototype::Topology::Triangles)
+		{
+			throw std::runtime_error("geometry file has invalid topology");
+		}
+
+		if ((header.flags & ~kFlagIndexBuffer) != 0 || (!(header.flags & kFlagIndexBuffer) && header.indexCount != 0))
+		{
+			throw std::runtime_error("geometry file has invalid flags");
+		}
+
+		for (std::size_t i = 0; i < header.vertexStreamCount; ++i)
+		{
+			const auto& desc = GetVertexStreamDesc(i);
+
+			if (desc.semantics > VertexBufferPrototype::Semantics::BlendWeight)
+			{
+				throw std::runtime_error("geometry file vertex stream has invalid semantics");
+			}
+
+			if (desc.stride != GetVertexFormatStride(desc.format))
+			{
+				throw std::runtime_error("geometry file vertex stream stride does not match its format");
+			}
+
+			if (desc.byteOffset > _byteLength || desc.elementCount > (_byteLength - desc.byteOffset) / desc.stride)
+			{
+				throw std::runtime_error("geometry file vertex stream is out of bounds");
+			}
+		}
+
+		if (header.indexByteOffset > _byteLength || header.indexCount > (_byteLength - header.indexByteOffset) / GetIndexFormatStride(header.indexFormat))
+		{
+			throw std::runtime_error("geometry file index data is out of bounds");
+		}
+	}
+
+	const GeometryFile::Header& GeometryFile::GetHeader() const
+	{
+		return *reinterpret_cast<const Header*>(_data);
+	}
+
+	const GeometryFile::VertexStreamDesc& GeometryFile::GetVertexStreamDesc(std::size_t index) const
+	{
+		assert(index < GetHeader().vertexStreamCount);
+		return reinterpret_cast<const VertexStreamDesc*>(_data + sizeof(Header))[index];
+	}
+
+	const void* GeometryFile::GetVertexStreamData(std::size_t index) const
+	{
+		return _data + GetVertexStreamDesc(index).byteOffset;
+	}
+
+	std::size_t GeometryFile::GetVertexStreamByteLength(std::size_t index) const
+	{
+		const auto& desc = GetVertexStreamDesc(index);
+		return static_cast<std::size_t>(desc.elementCount * desc.stride);
+	}
+
+	const void* GeometryFile::GetIndexData() const
+	{
+		return _data + GetHeader().indexByteOffset;
+	}
+
+	std::size_t GeometryFile::GetIndexByteLength() const
+	{
+		const auto& header = GetHeader();
+		return static_cast<std::size_t>(header.indexCount) * GetIndexFormatStride(header.indexFormat);
+	}
+
+	const GeometryPrototype::Subset* GeometryFile::GetSubsets() const
+	{
+		return reinterpret_cast<const GeometryPrototype::Subset*>(_data + sizeof(Header) + sizeof(VertexStreamDesc) * GetHeader().vertexStreamCount);
+	}
+
+	GeometryPrototype GeometryFile::CreatePrototype() const
+	{
+		const auto& header = GetHeader();
+		GeometryPrototype proto;
+		proto.topology = header.topology;
+		proto.vertexBuffers.reserve(header.vertexStreamCount);
+
+		for (std::size_t i = 0; i < header.vertexStreamCount; ++i)
+		{
+			const auto& desc = GetVertexStreamDesc(i);
+			const auto data = GetVertexStreamData(i);
+
+			proto.vertexBuffers.push_back(VisitVertexFormat(desc.format, [&desc, data](auto tag)
+			{
+				return CreateVertexStream<typename decltype(tag)::Type>(desc, data);
+			}));
+		}
+
+		if (header.flags & kFlagIndexBuffer)
+		{
+			if (header.indexFormat == IndexBufferPrototype::Format::Uint16)
+			{
+				proto.indexBuffer = CreateIndexBuffer<IndexBufferPrototype16>(header.indexCount, GetIndexData());
+			}
+			else
+			{
+				proto.indexBuffer = CreateIndexBuffer<IndexBufferPrototype32>(header.indexCount, GetIndexData());
+			}
+		}
+
+		proto.subsets.assign(GetSubsets(), GetSubsets() + header.subsetCount);
+		return proto;
+	}
+}
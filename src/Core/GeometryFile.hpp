@@ -0,0 +1,80 @@
+#pragma once
+#include <filesystem>
+#include <ostream>
+#include <Core/Geometry.hpp>
+
+namespace MMPEngine::Core
+{
+	class GeometryFile final
+	{
+	public:
+		static constexpr std::uint32_t kMagic = 0x47504D4D;
+		static constexpr std::uint32_t kVersion = 2;
+		static constexpr std::size_t kDataAlignment = 16;
+		static constexpr std::uint16_t kFlagIndexBuffer = 1 << 0;
+
+		struct Bounds final
+		{
+			Vector3Float min;
+			Vector3Float max;
+		};
+
+		struct Header final
+		{
+			std::uint32_t magic;
+			std::uint32_t version;
+			std::uint32_t vertexStreamCount;
+			std::uint32_t subsetCount;
+			IndexBufferPrototype::Format indexFormat;
+			GeometryPrototype::Topology topology;
+			std::uint16_t flags;
+			std::uint32_t vertexCount;
+			std::uint64_t indexCount;
+			std::uint64_t indexByteOffset;
+			std::uint64_t fileByteLength;
+			Bounds bounds;
+		};
+
+		struct VertexStreamDesc final
+		{
+			VertexBufferPrototype::Format format;
+			VertexBufferPrototype::Semantics semantics;
+			std::uint16_t reserved;
+			std::uint32_t stride;
+			std::uint64_t elementCount;
+			std::uint64_t byteOffset;
+		};
+
+		static void Write(const GeometryPrototype& proto, std::ostream& stream);
+		static void Write(const GeometryPrototype& proto, const std::filesystem::path& path);
+
+		GeometryFile(const std::filesystem::path& path);
+		GeometryFile(const GeometryFile&) = delete;
+		GeometryFile(GeometryFile&&) noexcept = delete;
+		GeometryFile& operator=(const GeometryFile&) = delete;
+		GeometryFile& operator=(GeometryFile&&) noexcept = delete;
+		~GeometryFile();
+
+		const Header& GetHeader() const;
+		const VertexStreamDesc& GetVertexStreamDesc(std::size_t index) const;
+		const void* GetVertexStreamData(std::size_t index) const;
+		std::size_t GetVertexStreamByteLength(std::size_t index) const;
+		const void* GetIndexData() const;
+		std::size_t GetIndexByteLength() const;
+		const GeometryPrototype::Subset* GetSubsets() const;
+
+		GeometryPrototype CreatePrototype() const;
+	private:
+		void Validate() const;
+		void Release();
+
+		const std::uint8_t* _data;
+		std::size_t _byteLength;
+#ifdef MMPENGINE_WIN
+		void* _fileHandle;
+		void* _mappingHandle;
+#else
+		int _fileDescriptor;
+#endif
+	};
+}
@@ -0,0 +1,615 @@
+#include <Core/GeometryOptimizer.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+
+namespace MMPEngine::Core
+{
+	namespace
+	{
+		template<typename TStream>
+		void RemapStreamData(VertexBufferPrototype& stream, const std::vector<std::uint32_t>& newToOld)
+		{
+			auto& data = dynamic_cast<TStream&>(stream).data;
+			std::decay_t<decltype(data)> remapped {};
+			remapped.reserve(newToOld.size());
+
+			for (const auto oldIndex : newToOld)
+			{
+				remapped.push_back(data[oldIndex]);
+			}
+
+			data = std::move(remapped);
+		}
+
+		Vector3Float Sub(const Vector3Float& a, const Vector3Float& b)
+		{
+			return { a.x - b.x, a.y - b.y, a.z - b.z };
+		}
+
+		Vector3Float Cross(const Vector3Float& a, const Vector3Float& b)
+		{
+			return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+		}
+
+		std::float_t Dot(const Vector3Float& a, const Vector3Float& b)
+		{
+			return a.x * b.x + a.y * b.y + a.z * b.z;
+		}
+	}
+
+	std::vector<std::uint32_t> GeometryOptimizer::ReadIndices(const IndexBufferPrototype& indexBuffer)
+	{
+		if (indexBuffer.GetFormat() == IndexBufferPrototype::Format::Uint16)
+		{
+			const auto& data = dynamic_cast<const IndexBufferPrototype16&>(indexBuffer).data;
+			return { data.cbegin(), data.cend() };
+		}
+
+		return dynamic_cast<const IndexBufferPrototype32&>(indexBuffer).data;
+	}
+
+	void GeometryOptimizer::WriteIndices(IndexBufferPrototype& indexBuffer, const std::vector<std::uint32_t>& indices)
+	{
+		if (indexBuffer.GetFormat() == IndexBufferPrototype::Format::Uint16)
+		{
+			auto& data = dynamic_cast<IndexBufferPrototype16&>(indexBuffer).data;
+			data.assign(indices.cbegin(), indices.cend());
+		}
+		else
+		{
+			dynamic_cast<IndexBufferPrototype32&>(indexBuffer).data = indices;
+		}
+	}
+
+	void GeometryOptimizer::RemapVertexStream(VertexBufferPrototype& stream, const std::vector<std::uint32_t>& newToOld)
+	{
+		switch (stream.GetFormat())
+		{
+		case VertexBufferPrototype::Format::Float1:
+			RemapStreamData<VertexBufferPrototypeFloat1>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Float2:
+			RemapStreamData<VertexBufferPrototypeFloat2>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Float3:
+			RemapStreamData<VertexBufferPrototypeFloat3>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Float4:
+			RemapStreamData<VertexBufferPrototypeFloat4>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Uint4:
+			RemapStreamData<VertexBufferPrototypeUint4>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Half2:
+			RemapStreamData<VertexBufferPrototypeHalf2>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Half4:
+			RemapStreamData<VertexBufferPrototypeHalf4>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Snorm8x4:
+			RemapStreamData<VertexBufferPrototypeSnorm8x4>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Unorm8x4:
+			RemapStreamData<VertexBufferPrototypeUnorm8x4>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Snorm16x2:
+			RemapStreamData<VertexBufferPrototypeSnorm16x2>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Snorm16x4:
+			RemapStreamData<VertexBufferPrototypeSnorm16x4>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Unorm16x2:
+			RemapStreamData<VertexBufferPrototypeUnorm16x2>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Unorm16x4:
+			RemapStreamData<VertexBufferPrototypeUnorm16x4>(stream, newToOld);
+			break;
+		case VertexBufferPrototype::Format::Unorm10_10_10_2:
+			RemapStreamData<VertexBufferPrototypeUnorm10_10_10_2>(stream, newToOld);
+			break;
+		default:
+			throw UnsupportedException("unsupported vertex stream format for geometry optimization");
+		}
+	}
+
+	std::size_t GeometryOptimizer::CountCacheMisses(const std::uint32_t* indices, std::size_t indexCount, std::uint32_t cacheSize)
+	{
+		if (indexCount == 0)
+		{
+			return 0;
+		}
+
+		const auto maxIndex = *std::max_element(indices, indices + indexCount);
+		std::vector<std::size_t> stamps(static_cast<std::size_t>(maxIndex) + 1, 0);
+		std::size_t clock = 0;
+		std::size_t misses = 0;
+
+		for (std::size_t i = 0; i < indexCount; ++i)
+		{
+			auto& stamp = stamps[indices[i]];
+
+			if (stamp == 0 || clock - stamp >= cacheSize)
+			{
+				stamp = ++clock;
+				++misses;
+			}
+		}
+
+		return misses;
+	}
+
+	void GeometryOptimizer::Measure(const GeometryPrototype& proto, std::uint32_t cacheSize, std::float_t& acmr, std::float_t& atvr)
+	{
+		acmr = 0.0f;
+		atvr = 0.0f;
+
+		if (!proto.indexBuffer)
+		{
+			return;
+		}
+
+		const auto indices = ReadIndices(*proto.indexBuffer);
+		std::size_t misses = 0;
+		std::size_t triangles = 0;
+		std::size_t uniqueVertices = 0;
+
+		for (const auto& subset : proto.subsets)
+		{
+			const auto begin = indices.data() + subset.indexStart;
+			std::vector<std::uint32_t> unique(begin, begin + subset.indexCount);
+			std::sort(unique.begin(), unique.end());
+
+			misses += CountCacheMisses(begin, subset.indexCount, cacheSize);
+			triangles += subset.indexCount / 3;
+			uniqueVertices += static_cast<std::size_t>(std::distance(unique.begin(), std::unique(unique.begin(), unique.end())));
+		}
+
+		acmr = triangles > 0 ? static_cast<std::float_t>(misses) / static_cast<std::float_t>(triangles) : 0.0f;
+		atvr = uniqueVertices > 0 ? static_cast<std::float_t>(misses) / static_cast<std::float_t>(uniqueVertices) : 0.0f;
+	}
+
+	void GeometryOptimizer::ReorderTriangles(std::uint32_t* indices, std::size_t indexCount, std::size_t vertexCount, std::uint32_t cacheSize)
+	{
+		assert(indexCount % 3 == 0);
+		assert(cacheSize > 3);
+
+		const auto triangleCount = indexCount / 3;
+
+		if (triangleCount < 2)
+		{
+			return;
+		}
+
+		std::vector<std::uint32_t> remaining(vertexCount, 0);
+		std::vector<std::uint32_t> offsets(vertexCount + 1, 0);
+		std::vector<std::uint32_t> adjacency(indexCount);
+
+		for (std::size_t i = 0; i < indexCount; ++i)
+		{
+			++remaining[indices[i]];
+		}
+
+		for (std::size_t v = 0; v < vertexCount; ++v)
+		{
+			offsets[v + 1] = offsets[v] + remaining[v];
+		}
+
+		{
+			auto cursor = offsets;
+
+			for (std::size_t i = 0; i < indexCount; ++i)
+			{
+				adjacency[cursor[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+			}
+		}
+
+		std::vector<std::int32_t> cachePosition(vertexCount, -1);
+		std::vector<std::float_t> vertexScores(vertexCount, 0.0f);
+		std::vector<std::float_t> triangleScores(triangleCount, 0.0f);
+		std::vector<bool> emitted(triangleCount, false);
+
+		const auto scoreVertex = [&](std::uint32_t v)
+		{
+			if (remaining[v] == 0)
+			{
+				return -1.0f;
+			}
+
+			std::float_t score = 0.0f;
+
+			if (const auto position = cachePosition[v]; position >= 0)
+			{
+				score = position < 3 ? 0.75f : std::pow(1.0f - static_cast<std::float_t>(position - 3) / static_cast<std::float_t>(cacheSize - 3), 1.5f);
+			}
+
+			return score + 2.0f / std::sqrt(static_cast<std::float_t>(remaining[v]));
+		};
+
+		for (std::size_t v = 0; v < vertexCount; ++v)
+		{
+			vertexScores[v] = scoreVertex(static_cast<std::uint32_t>(v));
+		}
+
+		std::int64_t best = -1;
+		std::float_t bestScore = -1.0f;
+
+		for (std::size_t t = 0; t < triangleCount; ++t)
+		{
+			triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+
+			if (triangleScores[t] > bestScore)
+			{
+				bestScore = triangleScores[t];
+				best = static_cast<std::int64_t>(t);
+			}
+		}
+
+		std::vector<std::uint32_t> result {};
+		result.reserve(indexCount);
+		std::vector<std::uint32_t> cache {};
+		std::vector<std::uint32_t> nextCache {};
+		cache.reserve(cacheSize + 3);
+		nextCache.reserve(cacheSize + 3);
+		std::size_t scanCursor = 0;
+
+		for (std::size_t n = 0; n < triangleCount; ++n)
+		{
+			if (best < 0)
+			{
+				while (emitted[scanCursor])
+				{
+					++scanCursor;
+				}
+
+				best = static_cast<std::int64_t>(scanCursor);
+			}
+
+			const auto triangle = static_cast<std::size_t>(best);
+			const std::uint32_t* tv = indices + triangle * 3;
+			emitted[triangle] = true;
+			result.insert(result.end(), tv, tv + 3);
+
+			for (std::size_t k = 0; k < 3; ++k)
+			{
+				const auto v = tv[k];
+				const auto begin = adjacency.begin() + offsets[v];
+				const auto end = begin + remaining[v];
+				const auto it = std::find(begin, end, static_cast<std::uint32_t>(triangle));
+
+				if (it != end)
+				{
+					std::iter_swap(it, end - 1);
+					--remaining[v];
+				}
+			}
+
+			nextCache.clear();
+
+			for (std::size_t k = 0; k < 3; ++k)
+			{
+				if (std::find(nextCache.cbegin(), nextCache.cend(), tv[k]) == nextCache.cend())
+				{
+					nextCache.push_back(tv[k]);
+				}
+			}
+
+			for (const auto v : cache)
+			{
+				if (std::find(nextCache.cbegin(), nextCache.cend(), v) == nextCache.cend())
+				{
+					nextCache.push_back(v);
+				}
+			}
+
+			for (std::size_t i = 0; i < nextCache.size(); ++i)
+			{
+				cachePosition[nextCache[i]] = i < cacheSize ? static_cast<std::int32_t>(i) : -1;
+				vertexScores[nextCache[i]] = scoreVertex(nextCache[i]);
+			}
+
+			best = -1;
+			bestScore = -1.0f;
+
+			for (const auto v : nextCache)
+			{
+				for (auto a = offsets[v]; a < offsets[v] + remaining[v]; ++a)
+				{
+					const auto t = adjacency[a];
+					triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+
+					if (triangleScores[t] > bestScore)
+					{
+						bestScore = triangleScores[t];
+						best = static_cast<std::int64_t>(t);
+					}
+				}
+			}
+
+			if (nextCache.size() > cacheSize)
+			{
+				nextCache.resize(cacheSize);
+			}
+
+			std::swap(cache, nextCache);
+		}
+
+		std::copy(result.cbegin(), result.cend(), indices);
+	}
+
+	void GeometryOptimizer::ReorderForOverdraw(std::uint32_t* indices, std::size_t indexCount, const Vector3Float* positions, const Settings& settings)
+	{
+		const auto triangleCount = indexCount / 3;
+
+		if (triangleCount <= settings.overdrawMinClusterTriangles)
+		{
+			return;
+		}
+
+		std::vector<std::size_t> clusterStarts { 0 };
+		{
+			const auto maxIndex = *std::max_element(indices, indices + indexCount);
+			std::vector<std::size_t> stamps(static_cast<std::size_t>(maxIndex) + 1, 0);
+			std::size_t clock = 0;
+
+			for (std::size_t t = 0; t < triangleCount; ++t)
+			{
+				std::uint32_t misses = 0;
+
+				for (std::size_t k = 0; k < 3; ++k)
+				{
+					auto& stamp = stamps[indices[t * 3 + k]];
+
+					if (stamp == 0 || clock - stamp >= settings.cacheSize)
+					{
+						stamp = ++clock;
+						++misses;
+					}
+				}
+
+				if (misses == 3 && t - clusterStarts.back() >= settings.overdrawMinClusterTriangles)
+				{
+					clusterStarts.push_back(t);
+				}
+			}
+		}
+
+		if (clusterStarts.size() < 2)
+		{
+			return;
+		}
+
+		clusterStarts.push_back(triangleCount);
+
+		Vector3Float meshCenter { 0.0f, 0.0f, 0.0f };
+		std::float_t meshArea = 0.0f;
+		std::vector<Vector3Float> clusterCenters(clusterStarts.size() - 1, Vector3Float { 0.0f, 0.0f, 0.0f });
+		std::vector<Vector3Float> clusterNormals(clusterStarts.size() - 1, Vector3Float { 0.0f, 0.0f, 0.0f });
+
+		for (std::size_t c = 0; c + 1 < clusterStarts.size(); ++c)
+		{
+			std::float_t clusterArea = 0.0f;
+
+			for (auto t = clusterStarts[c]; t < clusterStarts[c + 1]; ++t)
+			{
+				const auto& p0 = positions[indices[t * 3]];
+				const auto& p1 = positions[indices[t * 3 + 1]];
+				const auto& p2 = positions[indices[t * 3 + 2]];
+				const auto normal = Cross(Sub(p1, p0), Sub(p2, p0));
+				const auto area = std::sqrt(Dot(normal, normal)) * 0.5f;
+				const Vector3Float center { (p0.x + p1.x + p2.x) / 3.0f, (p0.y + p1.y + p2.y) / 3.0f, (p0.z + p1.z + p2.z) / 3.0f };
+
+				clusterCenters[c] = { clusterCenters[c].x + center.x * area, clusterCenters[c].y + center.y * area, clusterCenters[c].z + center.z * area };
+				clusterNormals[c] = { clusterNormals[c].x + normal.x, clusterNormals[c].y + normal.y, clusterNormals[c].z + normal.z };
+				clusterArea += area;
+			}
+
+			meshCenter = { meshCenter.x + clusterCenters[c].x, meshCenter.y + clusterCenters[c].y, meshCenter.z + clusterCenters[c].z };
+			meshArea += clusterArea;
+
+			if (clusterArea > 0.0f)
+			{
+				clusterCenters[c] = { clusterCenters[c].x / clusterArea, clusterCenters[c].y / clusterArea, clusterCenters[c].z / clusterArea };
+			}
+		}
+
+		if (meshArea > 0.0f)
+		{
+			meshCenter = { meshCenter.x / meshArea, meshCenter.y / meshArea, meshCenter.z / meshArea };
+		}
+
+		std::vector<std::size_t> order(clusterStarts.size() - 1);
+		std::vector<std::float_t> sortKeys(order.size());
+		std::iota(order.begin(), order.end(), 0);
+
+		for (std::size_t c = 0; c < order.size(); ++c)
+		{
+			sortKeys[c] = Dot(Sub(clusterCenters[c], meshCenter), clusterNormals[c]);
+		}
+
+		std::stable_sort(order.begin(), order.end(), [&sortKeys](auto lhs, auto rhs)
+		{
+			return sortKeys[lhs] > sortKeys[rhs];
+		});
+
+		std::vector<std::uint32_t> reordered {};
+		reordered.reserve(indexCount);
+
+		for (const auto c : order)
+		{
+			reordered.insert(reordered.end(), indices + clusterStarts[c] * 3, indices + clusterStarts[c + 1] * 3);
+		}
+
+		const auto before = CountCacheMisses(indices, indexCount, settings.cacheSize);
+		const auto after = CountCacheMisses(reordered.data(), reordered.size(), settings.cacheSize);
+
+		if (static_cast<std::float_t>(after) <= static_cast<std::float_t>(before) * settings.overdrawAcmrThreshold)
+		{
+			std::copy(reordered.cbegin(), reordered.cend(), indices);
+		}
+	}
+
+	GeometryOptimizer::Statistics GeometryOptimizer::Optimize(GeometryPrototype& proto, const Settings& settings)
+	{
+		Statistics statistics {};
+
+		if (!proto.indexBuffer || proto.vertexBuffers.empty() || proto.topology != GeometryPrototype::Topology::Triangles)
+		{
+			return statistics;
+		}
+
+		const auto vertexCount = proto.vertexBuffers.front()->GetElementsCount();
+		statistics.vertexCountBefore = vertexCount;
+		Measure(proto, settings.cacheSize, statistics.acmrBefore, statistics.atvrBefore);
+
+		for (const auto& vb : proto.vertexBuffers)
+		{
+			assert(vb->GetElementsCount() == vertexCount);
+		}
+
+		const auto positionStream = std::find_if(proto.vertexBuffers.cbegin(), proto.vertexBuffers.cend(), [](const auto& vb)
+		{
+			return vb->GetVBSettings().semantics == VertexBufferPrototype::Semantics::Position && vb->GetFormat() == VertexBufferPrototype::Format::Float3;
+		});
+		const auto positions = positionStream != proto.vertexBuffers.cend() ? static_cast<const Vector3Float*>((*positionStream)->GetDataPtr()) : nullptr;
+
+		auto indices = ReadIndices(*proto.indexBuffer);
+
+		std::map<std::uint32_t, std::vector<std::size_t>> groups {};
+
+		for (std::size_t s = 0; s < proto.subsets.size(); ++s)
+		{
+			groups[proto.subsets[s].baseVertex].push_back(s);
+		}
+
+		std::vector<std::uint32_t> newToOld {};
+		newToOld.reserve(vertexCount);
+
+		for (auto it = groups.cbegin(); it != groups.cend(); ++it)
+		{
+			const auto base = it->first;
+			const auto next = std::next(it);
+			const auto end = next != groups.cend() ? next->first : static_cast<std::uint32_t>(vertexCount);
+			const auto localCount = static_cast<std::size_t>(end - base);
+			const auto& subsetIds = it->second;
+
+			if (settings.weldVertices)
+			{
+				std::unordered_map<std::string, std::uint32_t> unique {};
+				std::vector<std::uint32_t> weldRemap(localCount);
+				std::string key {};
+
+				for (std::size_t v = 0; v < localCount; ++v)
+				{
+					key.clear();
+
+					for (const auto& vb : proto.vertexBuffers)
+					{
+						const auto stride = vb->GetStride();
+						key.append(static_cast<const char*>(vb->GetDataPtr()) + (base + v) * stride, stride);
+					}
+
+					weldRemap[v] = unique.emplace(key, static_cast<std::uint32_t>(v)).first->second;
+				}
+
+				for (const auto s : subsetIds)
+				{
+					const auto& subset = proto.subsets[s];
+					std::for_each(indices.begin() + subset.indexStart, indices.begin() + subset.indexStart + subset.indexCount, [&weldRemap](auto& index)
+					{
+						index = weldRemap[index];
+					});
+				}
+			}
+
+			for (const auto s : subsetIds)
+			{
+				const auto& subset = proto.subsets[s];
+				const auto subsetIndices = indices.data() + subset.indexStart;
+
+				if (settings.reorderTriangles)
+				{
+					ReorderTriangles(subsetIndices, subset.indexCount, localCount, settings.cacheSize);
+				}
+
+				if (settings.reduceOverdraw && positions)
+				{
+					ReorderForOverdraw(subsetIndices, subset.indexCount, positions + base, settings);
+				}
+			}
+
+			constexpr auto unassigned = std::numeric_limits<std::uint32_t>::max();
+			std::vector<std::uint32_t> oldToNew(localCount, unassigned);
+			std::uint32_t newLocalCount = 0;
+			const auto newBase = static_cast<std::uint32_t>(newToOld.size());
+
+			if (settings.reorderVertices)
+			{
+				for (const auto s : subsetIds)
+				{
+					const auto& subset = proto.subsets[s];
+
+					for (auto i = subset.indexStart; i < subset.indexStart + subset.indexCount; ++i)
+					{
+						if (oldToNew[indices[i]] == unassigned)
+						{
+							oldToNew[indices[i]] = newLocalCount++;
+							newToOld.push_back(base + indices[i]);
+						}
+					}
+				}
+			}
+			else
+			{
+				std::vector<bool> used(localCount, !settings.weldVertices);
+
+				for (const auto s : subsetIds)
+				{
+					const auto& subset = proto.subsets[s];
+
+					for (auto i = subset.indexStart; i < subset.indexStart + subset.indexCount; ++i)
+					{
+						used[indices[i]] = true;
+					}
+				}
+
+				for (std::size_t v = 0; v < localCount; ++v)
+				{
+					if (used[v])
+					{
+						oldToNew[v] = newLocalCount++;
+						newToOld.push_back(base + static_cast<std::uint32_t>(v));
+					}
+				}
+			}
+
+			for (const auto s : subsetIds)
+			{
+				auto& subset = proto.subsets[s];
+				subset.baseVertex = newBase;
+
+				std::for_each(indices.begin() + subset.indexStart, indices.begin() + subset.indexStart + subset.indexCount, [&oldToNew](auto& index)
+				{
+					index = oldToNew[index];
+				});
+			}
+		}
+
+		for (const auto& vb : proto.vertexBuffers)
+		{
+			RemapVertexStream(*vb, newToOld);
+		}
+
+		WriteIndices(*proto.indexBuffer, indices);
+
+		statistics.vertexCountAfter = newToOld.size();
+		Measure(proto, settings.cacheSize, statistics.acmrAfter, statistics.atvrAfter);
+
+		return statistics;
+	}
+}
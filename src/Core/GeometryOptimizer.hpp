@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include <Core/Geometry.hpp>
+
+namespace MMPEngine::Core
+{
+	class GeometryOptimizer final
+	{
+	public:
+		struct Settings final
+		{
+			std::uint32_t cacheSize = 32;
+			bool weldVertices = true;
+			bool reorderTriangles = true;
+			bool reorderVertices = true;
+			bool reduceOverdraw = true;
+			std::uint32_t overdrawMinClusterTriangles = 32;
+			std::float_t overdrawAcmrThreshold = 1.05f;
+		};
+
+		struct Statistics final
+		{
+			std::size_t vertexCountBefore = 0;
+			std::size_t vertexCountAfter = 0;
+			std::float_t acmrBefore = 0.0f;
+			std::float_t acmrAfter = 0.0f;
+			std::float_t atvrBefore = 0.0f;
+			std::float_t atvrAfter = 0.0f;
+		};
+
+		GeometryOptimizer() = delete;
+
+		static Statistics Optimize(GeometryPrototype& proto, const Settings& settings);
+		static void Measure(const GeometryPrototype& proto, std::uint32_t cacheSize, std::float_t& acmr, std::float_t& atvr);
+
+		static std::size_t CountCacheMisses(const std::uint32_t* indices, std::size_t indexCount, std::uint32_t cacheSize);
+		static void ReorderTriangles(std::uint32_t* indices, std::size_t indexCount, std::size_t vertexCount, std::uint32_t cacheSize);
+		static void ReorderForOverdraw(std::uint32_t* indices, std::size_t indexCount, const Vector3Float* positions, const Settings& settings);
+	private:
+		static std::vector<std::uint32_t> ReadIndices(const IndexBufferPrototype& indexBuffer);
+		static void WriteIndices(IndexBufferPrototype& indexBuffer, const std::vector<std::uint32_t>& indices);
+		static void RemapVertexStream(VertexBufferPrototype& stream, const std::vector<std::uint32_t>& newToOld);
+	};
+}
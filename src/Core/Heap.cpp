@@ -1,13 +1,34 @@
 #include <Core/Heap.hpp>
+#include <algorithm>
 #include <cassert>
 
 namespace MMPEngine::Core
 {
-	Heap::Heap(const Settings& settings) : _settings(settings)
+	std::atomic<std::uint64_t> Heap::_idCounter { 0 };
+	thread_local std::unordered_map<std::uint64_t, Heap::ThreadCache> Heap::_threadCaches {};
+
+	Heap::Heap(const Settings& settings) : _settings(settings), _id(_idCounter.fetch_add(1, std::memory_order_relaxed))
 	{
 	}
 	Heap::~Heap() = default;
 
+	Heap::ThreadCache::ThreadCache() = default;
+
+	Heap::ThreadCache::~ThreadCache()
+	{
+		if (const auto heapStrongRef = heap.lock())
+		{
+			for (const auto& [size, sizeEntries] : entries)
+			{
+				for (const auto& entry : sizeEntries)
+				{
+					heapStrongRef->TrackCachedEntry(entry, false);
+					heapStrongRef->ReleaseEntryLocked(entry);
+				}
+			}
+		}
+	}
+
 	Heap::Block::Block(std::size_t size) : _size(size)
 	{
 		AddRange({0, size - 1});
@@ -136,6 +157,8 @@ namespace MMPEngine::Core
 			const auto allocatedRange = res.value();
 
 			RemoveRange(placeholderRange);
+			_usedSize += allocatedRange.GetLength();
+			++_allocationsCount;
 
 			if(allocatedRange.from > 0)
 			{
@@ -161,6 +184,31 @@ namespace MMPEngine::Core
 		return _size;
 	}
 
+	std::size_t Heap::Block::GetUsedSize() const
+	{
+		return _usedSize;
+	}
+
+	std::size_t Heap::Block::GetAllocationsCount() const
+	{
+		return _allocationsCount;
+	}
+
+	std::size_t Heap::Block::GetLargestFreeRangeLength() const
+	{
+		return _freeRanges.empty() ? 0 : _freeRanges.crbegin()->GetLength();
+	}
+
+	std::size_t Heap::Block::GetFreeRangesCount() const
+	{
+		return _freeRanges.size();
+	}
+
+	bool Heap::Block::IsDedicated() const
+	{
+		return _dedicated;
+	}
+
 	bool Heap::Block::Empty() const
 	{
 		if(_freeRanges.size() > 1)
@@ -174,6 +222,11 @@ namespace MMPEngine::Core
 
 	void Heap::Block::Release(const Range& range)
 	{
+		assert(_usedSize >= range.GetLength());
+		assert(_allocationsCount > 0);
+		_usedSize -= range.GetLength();
+		--_allocationsCount;
+
 		Range newRange = range;
 
 		if(newRange.from > 0)
@@ -202,11 +255,54 @@ namespace MMPEngine::Core
 	{
 		assert(request.size > 0);
 
+		if (IsDedicatedSize(request.size))
+		{
+			return AllocateDedicatedEntry(InstantiateBlock(request.size), request);
+		}
+
+		if (!_settings.concurrent)
+		{
+			return AllocateEntryExclusive(request);
+		}
+
+		if (const auto cachedEntry = TryAllocateCachedEntry(request))
+		{
+			return cachedEntry.value();
+		}
+
+		{
+			const auto blocksLock = LockShared();
+
+			for (std::size_t blockIndex = 0; blockIndex < _blocks.size(); ++blockIndex)
+			{
+				const auto& blockPtr = _blocks.at(blockIndex);
+
+				if (!blockPtr || blockPtr->_dedicated)
+				{
+					continue;
+				}
+
+				const auto blockLock = LockBlock(*blockPtr);
+				const auto range = blockPtr->TryAllocate(request);
+
+				if (range.has_value())
+				{
+					return { blockIndex, range.value(), request.alignment.value_or(1) };
+				}
+			}
+		}
+
+		const auto blocksLock = LockExclusive();
+		return AllocateEntryExclusive(request);
+	}
+
+	Heap::Entry Heap::AllocateEntryExclusive(const Request& request)
+	{
 		for(std::size_t blockIndex = 0; blockIndex < _blocks.size(); ++blockIndex)
 		{
 			auto& blockPtr = _blocks.at(blockIndex);
 
-			if (!blockPtr)
+			if (!blockPtr || blockPtr->_dedicated)
 			{
 				continue;
 			}
@@ -217,7 +313,7 @@ namespace MMPEngine::Core
 				assert(!request.alignment.has_value() || ((range.value().from % request.alignment.value()) == 0));
 				assert(range.value().GetLength() == request.size);
 
-				return { static_cast<std::size_t>(blockIndex), range.value() };
+				return { static_cast<std::size_t>(blockIndex), range.value(), request.alignment.value_or(1) };
 			}
 
 			if(_settings.removeEmptyBlocks && blockPtr->Empty())
@@ -234,20 +330,23 @@ namespace MMPEngine::Core
 
 				if(blockIndex == _blocks.size() || !_blocks.at(blockIndex))
 				{
-					auto newBlockSize = (std::max)(_settings.initialSize, request.size);
+					const auto requiredSize = request.minAddress > 0 ? request.minAddress + request.size + request.alignment.value_or(1) : request.size;
+					auto newBlockSize = (std::min)(_settings.initialSize, _settings.maxBlockSize);
 
 					const auto blockWithMaxSize = std::max_element(_blocks.cbegin(), _blocks.cend(),
 						[](const auto& b1, const auto& b2) {
-							const auto b1Size = b1 ? b1->GetSize() : 0;
-							const auto b2Size = b2 ? b2->GetSize() : 0;
+							const auto b1Size = (b1 && !b1->_dedicated) ? b1->GetSize() : 0;
+							const auto b2Size = (b2 && !b2->_dedicated) ? b2->GetSize() : 0;
 							return b1Size < b2Size;
 						});
 
-					if (blockWithMaxSize != _blocks.cend() && (*blockWithMaxSize))
+					if (blockWithMaxSize != _blocks.cend() && (*blockWithMaxSize) && !(*blockWithMaxSize)->_dedicated)
 					{
-						newBlockSize = (std::max)(newBlockSize, blockWithMaxSize->get()->GetSize() * _settings.growthFactor);
+						newBlockSize = (std::max)(newBlockSize, (std::min)(blockWithMaxSize->get()->GetSize() * _settings.growthFactor, _settings.maxBlockSize));
 					}
 
+					newBlockSize = (std::max)(newBlockSize, requiredSize);
+
 					if(blockIndex == _blocks.size())
 					{
 						_blocks.emplace_back(InstantiateBlock(newBlockSize));
@@ -259,6 +358,13 @@ namespace MMPEngine::Core
 				}
 
 				blockPtr = _blocks.at(blockIndex).get();
+
+				if (blockPtr->_dedicated)
+				{
+					++blockIndex;
+					continue;
+				}
+
 				const auto range = blockPtr->TryAllocate(request);
 
 				if(range.has_value())
@@ -266,7 +372,7 @@ namespace MMPEngine::Core
 					assert(!request.alignment.has_value() || ((range.value().from % request.alignment.value()) == 0));
 					assert(range.value().GetLength() == request.size);
 
-					return { static_cast<std::size_t>(blockIndex), range.value() };
+					return { static_cast<std::size_t>(blockIndex), range.value(), request.alignment.value_or(1) };
 				}
 
 				if (_settings.removeEmptyBlocks && blockPtr->Empty())
@@ -279,14 +385,197 @@ namespace MMPEngine::Core
 		}
 	}
 
+	Heap::Entry Heap::AllocateDedicatedEntry(std::unique_ptr<Block>&& block, const Request& request)
+	{
+		assert(block);
+		assert(block->GetSize() >= request.size);
+
+		const auto blocksLock = LockExclusive();
+		block->_dedicated = true;
+
+		const auto range = block->TryAllocate(request);
+		assert(range.has_value());
+
+		auto blockIndex = static_cast<std::size_t>(std::distance(_blocks.cbegin(), std::find(_blocks.cbegin(), _blocks.cend(), nullptr)));
+
+		if (blockIndex == _blocks.size())
+		{
+			_blocks.emplace_back(std::move(block));
+		}
+		else
+		{
+			_blocks.at(blockIndex) = std::move(block);
+		}
+
+		return { blockIndex, range.value(), request.alignment.value_or(1), true };
+	}
+
+	bool Heap::IsDedicatedSize(std::size_t size) const
+	{
+		return _settings.dedicatedThreshold > 0 && size >= _settings.dedicatedThreshold;
+	}
+
 	void Heap::ReleaseEntry(const Entry& entry)
 	{
-		auto& b = _blocks.at(entry.blockIndex);
-		b->Release(entry.range);
-		if (_settings.removeEmptyBlocks && b->Empty())
+		if (_settings.concurrent && TryCacheEntry(entry))
+		{
+			return;
+		}
+
+		ReleaseEntryLocked(entry);
+	}
+
+	void Heap::ReleaseEntryLocked(const Entry& entry)
+	{
+		if (!_settings.concurrent)
+		{
+			auto& b = _blocks.at(entry.blockIndex);
+			b->Release(entry.range);
+			if ((_settings.removeEmptyBlocks || entry.dedicated || b->_drained) && b->Empty())
+			{
+				b = nullptr;
+			}
+			return;
+		}
+
+		bool empty;
+		bool drained;
+
+		{
+			const auto blocksLock = LockShared();
+			const auto& b = _blocks.at(entry.blockIndex);
+			const auto blockLock = LockBlock(*b);
+			b->Release(entry.range);
+			empty = b->Empty();
+			drained = b->_drained;
+		}
+
+		if ((_settings.removeEmptyBlocks || entry.dedicated || drained) && empty)
+		{
+			const auto blocksLock = LockExclusive();
+			auto& b = _blocks.at(entry.blockIndex);
+
+			if (b && b->Empty())
+			{
+				b = nullptr;
+			}
+		}
+	}
+
+	std::shared_ptr<Core::BaseEntity> Heap::GetBlockEntity(std::size_t blockIndex) const
+	{
+		const auto blocksLock = LockShared();
+		const auto& block = _blocks.at(blockIndex);
+		return block ? block->GetEntity() : nullptr;
+	}
+
+	Heap::Block* Heap::GetBlock(std::size_t blockIndex) const
+	{
+		const auto blocksLock = LockShared();
+		return _blocks.at(blockIndex).get();
+	}
+
+	std::shared_lock<std::shared_mutex> Heap::LockShared() const
+	{
+		return _settings.concurrent ? std::shared_lock<std::shared_mutex>(_blocksMutex) : std::shared_lock<std::shared_mutex>();
+	}
+
+	std::unique_lock<std::shared_mutex> Heap::LockExclusive() const
+	{
+		return _settings.concurrent ? std::unique_lock<std::shared_mutex>(_blocksMutex) : std::unique_lock<std::shared_mutex>();
+	}
+
+	std::unique_lock<std::mutex> Heap::LockBlock(Block& block) const
+	{
+		return _settings.concurrent ? std::unique_lock<std::mutex>(block._mutex) : std::unique_lock<std::mutex>();
+	}
+
+	Heap::ThreadCache& Heap::GetThreadCache()
+	{
+		auto& cache = _threadCaches[_id];
+
+		if (cache.heap.expired())
+		{
+			cache.heap = weak_from_this();
+		}
+
+		return cache;
+	}
+
+	std::optional<Heap::Entry> Heap::TryAllocateCachedEntry(const Request& request)
+	{
+		if (request.size > _settings.threadCacheMaxEntrySize || request.minAddress != Request {}.minAddress || request.maxAddress != Request {}.maxAddress)
+		{
+			return std::nullopt;
+		}
+
+		auto& cache = GetThreadCache();
+		const auto it = cache.entries.find(request.size);
+
+		if (it == cache.entries.cend())
 		{
-			b = nullptr;
+			return std::nullopt;
+		}
+
+		auto& sizeEntries = it->second;
+		const auto alignment = request.alignment.value_or(1);
+
+		for (auto entryIt = sizeEntries.rbegin(); entryIt != sizeEntries.rend(); ++entryIt)
+		{
+			if (entryIt->range.from % alignment == 0)
+			{
+				auto entry = *entryIt;
+				entry.alignment = alignment;
+				sizeEntries.erase(std::next(entryIt).base());
+				--cache.entriesCount;
+				TrackCachedEntry(entry, false);
+				return entry;
+			}
 		}
+
+		return std::nullopt;
+	}
+
+	bool Heap::TryCacheEntry(const Entry& entry)
+	{
+		const auto length = entry.range.GetLength();
+
+		if (entry.dedicated || length > _settings.threadCacheMaxEntrySize)
+		{
+			return false;
+		}
+
+		auto& cache = GetThreadCache();
+
+		if (cache.entriesCount >= _settings.threadCacheCapacity)
+		{
+			return false;
+		}
+
+		cache.entries[length].push_back(entry);
+		++cache.entriesCount;
+		TrackCachedEntry(entry, true);
+		return true;
+	}
+
+	void Heap::TrackCachedEntry(const Entry& entry, bool cached)
+	{
+		const auto blocksLock = LockShared();
+		auto& cachedSize = _blocks.at(entry.blockIndex)->_cachedSize;
+
+		if (cached)
+		{
+			cachedSize += entry.range.GetLength();
+		}
+		else
+		{
+			cachedSize -= entry.range.GetLength();
+		}
+	}
+
+	void Heap::FlushThreadCache()
+	{
+		_threadCaches.erase(_id);
 	}
 
 
@@ -297,27 +586,68 @@ namespace MMPEngine::Core
 	}
 
 	Heap::Handle::Handle(Handle&& movableHandle) noexcept
-		: _entry{ movableHandle._entry }, _heap{ std::move(movableHandle._heap) }
+		: _entry{ movableHandle._entry }, _heap{ std::move(movableHandle._heap) }, _relocationCallback { std::move(movableHandle._relocationCallback) }
 	{
+		if (_relocationCallback)
+		{
+			if (const auto heapStrongRef = _heap.lock())
+			{
+				heapStrongRef->ReplaceRelocatableHandle(&movableHandle, this);
+			}
+		}
+
 		movableHandle._heap.reset();
 		movableHandle._entry = std::nullopt;
+		movableHandle._relocationCallback = nullptr;
 	}
 
 	Heap::Handle& Heap::Handle::operator=(Handle&& movableHandle) noexcept
 	{
 		if (this != &movableHandle)
 		{
+			if (const auto heapStrongRef = _heap.lock(); heapStrongRef && _relocationCallback)
+			{
+				heapStrongRef->RemoveRelocatableHandle(this);
+			}
+
 			_heap = std::move(movableHandle._heap);
 			_entry = movableHandle._entry;
+			_relocationCallback = std::move(movableHandle._relocationCallback);
+
+			if (const auto heapStrongRef = _heap.lock(); heapStrongRef && _relocationCallback)
+			{
+				heapStrongRef->ReplaceRelocatableHandle(&movableHandle, this);
+			}
 
 			movableHandle._heap.reset();
 			movableHandle._entry = std::nullopt;
+			movableHandle._relocationCallback = nullptr;
 		}
 		return *this;
 	}
 
+	void Heap::Handle::EnableRelocation(RelocationCallback&& callback)
+	{
+		assert(_entry.has_value());
+		_relocationCallback = std::move(callback);
+
+		if (const auto heapStrongRef = _heap.lock())
+		{
+			std::lock_guard lock(heapStrongRef->_relocationMutex);
+			heapStrongRef->_relocatableHandles.emplace(this);
+		}
+	}
+
 	Heap::Handle::~Handle()
 	{
+		if (_relocationCallback)
+		{
+			if (const auto heapStrongRef = _heap.lock())
+			{
+				heapStrongRef->RemoveRelocatableHandle(this);
+			}
+		}
+
 		if (_entry.has_value())
 		{
 			if (const auto heapStrongRef = _heap.lock())
@@ -345,6 +675,7 @@ namespace MMPEngine::Core
 		Core::BaseTask::OnScheduled(stream);
 
 		const auto heap = _ctx->heap;
+		const auto blocksLock = heap->LockExclusive();
 
 		for (const auto& b : heap->_blocks)
 		{
@@ -362,4 +693,262 @@ namespace MMPEngine::Core
 			}
 		}
 	}
+
+	void Heap::ReplaceRelocatableHandle(Handle* oldHandle, Handle* newHandle)
+	{
+		std::lock_guard lock(_relocationMutex);
+
+		if (_relocatableHandles.erase(oldHandle) > 0)
+		{
+			_relocatableHandles.emplace(newHandle);
+		}
+
+		const auto it = _pendingRelocations.find(oldHandle);
+
+		if (it != _pendingRelocations.cend())
+		{
+			const auto entry = it->second;
+			_pendingRelocations.erase(it);
+			_pendingRelocations.emplace(newHandle, entry);
+		}
+	}
+
+	void Heap::RemoveRelocatableHandle(Handle* handle)
+	{
+		std::lock_guard lock(_relocationMutex);
+		_relocatableHandles.erase(handle);
+
+		const auto it = _pendingRelocations.find(handle);
+
+		if (it != _pendingRelocations.cend())
+		{
+			const auto entry = it->second;
+			_pendingRelocations.erase(it);
+			ReleaseEntry(entry);
+		}
+	}
+
+	std::shared_ptr<Core::BaseTask> Heap::CreateRelocationTask(const std::vector<Relocation>& /*relocations*/)
+	{
+		throw Core::UnsupportedException("heap does not support relocation of its entries");
+	}
+
+	void Heap::OnHandleRelocated(Handle& /*handle*/)
+	{
+	}
+
+	std::vector<Heap::Relocation> Heap::PlanRelocations(const DefragmentationSettings& settings)
+	{
+		std::vector<Relocation> relocations;
+
+		if (_settings.concurrent)
+		{
+			FlushThreadCache();
+		}
+
+		std::lock_guard lock(_relocationMutex);
+		const auto blocksLock = LockExclusive();
+
+		if (!_pendingRelocations.empty())
+		{
+			return relocations;
+		}
+
+		std::unordered_map<std::size_t, std::vector<Handle*>> blockHandles;
+		std::unordered_map<std::size_t, std::size_t> blockRelocatableSizes;
+
+		for (const auto handle : _relocatableHandles)
+		{
+			const auto& entry = handle->_entry.value();
+			blockHandles[entry.blockIndex].push_back(handle);
+			blockRelocatableSizes[entry.blockIndex] += entry.range.GetLength();
+		}
+
+		std::vector<std::size_t> sources;
+		std::vector<std::size_t> destinations;
+
+		for (std::size_t blockIndex = 0; blockIndex < _blocks.size(); ++blockIndex)
+		{
+			const auto& block = _blocks.at(blockIndex);
+
+			if (!block || block->Empty() || block->_dedicated)
+			{
+				continue;
+			}
+
+			const auto occupancy = static_cast<float>(block->GetUsedSize()) / static_cast<float>(block->GetSize());
+			const auto relocatableSize = blockRelocatableSizes.find(blockIndex) != blockRelocatableSizes.cend() ? blockRelocatableSizes.at(blockIndex) : 0;
+			const auto movable = relocatableSize > 0 && relocatableSize + block->_cachedSize == block->GetUsedSize();
+
+			if (movable && occupancy <= settings.maxSourceOccupancy)
+			{
+				sources.push_back(blockIndex);
+			}
+			else
+			{
+				destinations.push_back(blockIndex);
+			}
+		}
+
+		const auto byUsedSize = [this](auto lhs, auto rhs) {
+			return _blocks.at(lhs)->GetUsedSize() < _blocks.at(rhs)->GetUsedSize();
+		};
+
+		std::sort(sources.begin(), sources.end(), byUsedSize);
+		std::sort(destinations.begin(), destinations.end(), [&byUsedSize](auto lhs, auto rhs) { return byUsedSize(rhs, lhs); });
+
+		std::size_t relocatedSize = 0;
+
+		while (!sources.empty())
+		{
+			const auto sourceIndex = sources.front();
+			sources.erase(sources.begin());
+
+			auto& handles = blockHandles.at(sourceIndex);
+			std::sort(handles.begin(), handles.end(), [](auto lhs, auto rhs) {
+				return lhs->_entry.value().range.GetLength() > rhs->_entry.value().range.GetLength();
+			});
+
+			for (const auto handle : handles)
+			{
+				const auto from = handle->_entry.value();
+				const auto length = from.range.GetLength();
+
+				if (relocatedSize > 0 && relocatedSize + length > settings.frameByteBudget)
+				{
+					return relocations;
+				}
+
+				for (const auto destinationIndex : destinations)
+				{
+					const auto range = _blocks.at(destinationIndex)->TryAllocate({ length, from.alignment });
+
+					if (range.has_value())
+					{
+						const Entry to { destinationIndex, range.value(), from.alignment };
+						_pendingRelocations.emplace(handle, to);
+						relocations.push_back({ from, to });
+						relocatedSize += length;
+						break;
+					}
+				}
+			}
+		}
+
+		return relocations;
+	}
+
+	void Heap::CommitRelocations()
+	{
+		std::vector<Handle::RelocationCallback> callbacks;
+
+		{
+			std::lock_guard lock(_relocationMutex);
+
+			std::unordered_map<Handle*, Entry> pendingRelocations;
+			std::swap(pendingRelocations, _pendingRelocations);
+
+			{
+				const auto blocksLock = LockExclusive();
+				std::unordered_set<std::size_t> sourceBlocks;
+
+				for (const auto& [handle, to] : pendingRelocations)
+				{
+					const auto from = handle->_entry.value();
+					_blocks.at(from.blockIndex)->Release(from.range);
+					sourceBlocks.emplace(from.blockIndex);
+					handle->_entry = to;
+				}
+
+				for (const auto blockIndex : sourceBlocks)
+				{
+					auto& block = _blocks.at(blockIndex);
+
+					if (block && block->Empty())
+					{
+						block = nullptr;
+					}
+					else if (block)
+					{
+						block->_drained = true;
+					}
+				}
+			}
+
+			for (const auto& [handle, to] : pendingRelocations)
+			{
+				OnHandleRelocated(*handle);
+				callbacks.push_back(handle->_relocationCallback);
+			}
+		}
+
+		for (const auto& callback : callbacks)
+		{
+			callback();
+		}
+	}
+
+	Heap::Statistics Heap::GetStatistics() const
+	{
+		Statistics statistics {};
+		const auto blocksLock = LockShared();
+
+		for (const auto& block : _blocks)
+		{
+			if (!block)
+			{
+				continue;
+			}
+
+			const auto blockLock = LockBlock(*block);
+
+			++statistics.blocksCount;
+			statistics.dedicatedBlocksCount += block->_dedicated ? 1 : 0;
+			statistics.reservedBytes += block->GetSize();
+			statistics.allocatedBytes += block->GetUsedSize();
+			statistics.allocationsCount += block->GetAllocationsCount();
+			statistics.freeRangesCount += block->GetFreeRangesCount();
+			statistics.largestFreeRange = (std::max)(statistics.largestFreeRange, block->GetLargestFreeRangeLength());
+		}
+
+		const auto freeBytes = statistics.reservedBytes - statistics.allocatedBytes;
+
+		if (freeBytes > 0)
+		{
+			statistics.fragmentation = 1.0f - static_cast<float>(statistics.largestFreeRange) / static_cast<float>(freeBytes);
+		}
+
+		return statistics;
+	}
+
+	std::shared_ptr<Core::BaseTask> Heap::CreateDefragmentationTask(const DefragmentationSettings& settings)
+	{
+		const auto ctx = std::make_shared<DefragmentationTaskContext>();
+		ctx->heap = shared_from_this();
+		ctx->settings = settings;
+		return std::make_shared<DefragmentationTask>(ctx);
+	}
+
+	Heap::DefragmentationTask::DefragmentationTask(const std::shared_ptr<DefragmentationTaskContext>& ctx)
+		: _ctx(ctx)
+	{
+	}
+
+	void Heap::DefragmentationTask::OnScheduled(const std::shared_ptr<Core::BaseStream>& stream)
+	{
+		Core::BaseTask::OnScheduled(stream);
+
+		const auto relocations = _ctx->heap->PlanRelocations(_ctx->settings);
+
+		if (!relocations.empty())
+		{
+			stream->Schedule(_ctx->heap->CreateRelocationTask(relocations));
+		}
+	}
+
+	void Heap::DefragmentationTask::OnComplete(const std::shared_ptr<Core::BaseStream>& stream)
+	{
+		Core::BaseTask::OnComplete(stream);
+		_ctx->heap->CommitRelocations();
+	}
 }
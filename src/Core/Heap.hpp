@@ -1,8 +1,13 @@
 #pragma once
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <Core/Task.hpp>
 #include <Core/Entity.hpp>
@@ -22,6 +27,7 @@ namespace MMPEngine::Core
 	protected:
 		class Block
 		{
+			friend Heap;
 		public:
 
 			struct Range final
@@ -43,6 +49,11 @@ namespace MMPEngine::Core
 			std::optional<Range> TryAllocate(const Request& request);
 			void Release(const Range& range);
 			std::size_t GetSize() const;
+			std::size_t GetUsedSize() const;
+			std::size_t GetAllocationsCount() const;
+			std::size_t GetLargestFreeRangeLength() const;
+			std::size_t GetFreeRangesCount() const;
+			bool IsDedicated() const;
 			bool Empty() const;
 			virtual std::shared_ptr<Core::BaseEntity> GetEntity() const = 0;
 
@@ -59,6 +70,12 @@ namespace MMPEngine::Core
 			std::unordered_map<std::size_t, Range> _fromMap;
 			std::unordered_map<std::size_t, Range> _toMap;
 			std::size_t _size;
+			std::size_t _usedSize = 0;
+			std::size_t _allocationsCount = 0;
+			std::atomic<std::size_t> _cachedSize = 0;
+			bool _dedicated = false;
+			bool _drained = false;
+			std::mutex _mutex;
 		};
 	public:
 		struct Settings final
@@ -66,7 +83,31 @@ namespace MMPEngine::Core
 			std::size_t initialSize = 1024;
 			std::size_t growthFactor = 2;
 			bool removeEmptyBlocks = false;
+			bool concurrent = false;
+			std::size_t threadCacheMaxEntrySize = 4096;
+			std::size_t threadCacheCapacity = 32;
+			std::size_t maxBlockSize = (std::numeric_limits<std::size_t>::max)();
+			std::size_t dedicatedThreshold = 0;
 		};
+
+		struct Statistics final
+		{
+			std::size_t blocksCount = 0;
+			std::size_t dedicatedBlocksCount = 0;
+			std::size_t reservedBytes = 0;
+			std::size_t allocatedBytes = 0;
+			std::size_t allocationsCount = 0;
+			std::size_t freeRangesCount = 0;
+			std::size_t largestFreeRange = 0;
+			float fragmentation = 0.0f;
+		};
+
+		struct DefragmentationSettings final
+		{
+			std::size_t frameByteBudget = 4 * 1024 * 1024;
+			float maxSourceOccupancy = 0.5f;
+		};
+
 		Heap(const Settings& settings);
 		Heap(const Heap&) = delete;
 		Heap(Heap&&) noexcept = delete;
@@ -74,33 +115,57 @@ namespace MMPEngine::Core
 		Heap& operator=(Heap&&) noexcept = delete;
 		virtual ~Heap();
 		std::shared_ptr<Core::BaseTask> CreateTaskToInitializeBlocks();
+		std::shared_ptr<Core::BaseTask> CreateDefragmentationTask(const DefragmentationSettings& settings);
+		Statistics GetStatistics() const;
+		void FlushThreadCache();
+		bool IsDedicatedSize(std::size_t size) const;
 	protected:
 		struct Entry final
 		{
 			std::size_t blockIndex;
 			Block::Range range;
+			std::size_t alignment = 1;
+			bool dedicated = false;
+		};
+
+		struct Relocation final
+		{
+			Entry from;
+			Entry to;
 		};
 
 		virtual Entry AllocateEntry(const Request& request);
 		virtual std::unique_ptr<Block> InstantiateBlock(std::size_t size) = 0;
 		virtual void ReleaseEntry(const Entry& entry);
+		Entry AllocateDedicatedEntry(std::unique_ptr<Block>&& block, const Request& request);
+		std::shared_ptr<Core::BaseEntity> GetBlockEntity(std::size_t blockIndex) const;
+		// the block stays alive only while the caller holds a live entry in it
+		Block* GetBlock(std::size_t blockIndex) const;
 
 		class Handle
 		{
+			friend Heap;
 		protected:
 			Handle();
 			Handle(const std::shared_ptr<Heap>& heap, const Entry& entry);
 		public:
+			using RelocationCallback = std::function<void()>;
+
 			Handle(const Handle&) = delete;
 			Handle(Handle&& movableHandle) noexcept;
 			Handle& operator=(const Handle&) = delete;
 			Handle& operator=(Handle&& movableHandle) noexcept;
 			virtual ~Handle();
+			void EnableRelocation(RelocationCallback&& callback);
 		protected:
 			std::optional<Entry> _entry;
 			std::weak_ptr<Heap> _heap;
+			RelocationCallback _relocationCallback;
 		};
 
+		virtual std::shared_ptr<Core::BaseTask> CreateRelocationTask(const std::vector<Relocation>& relocations);
+		virtual void OnHandleRelocated(Handle& handle);
+
 		Settings _settings;
 		std::vector<std::unique_ptr<Block>> _blocks;
 	private:
@@ -120,6 +185,60 @@ namespace MMPEngine::Core
 			std::shared_ptr<InitBlocksTaskContext> _ctx;
 		};
 
+		class DefragmentationTaskContext final : public Core::TaskContext
+		{
+		public:
+			std::shared_ptr<Heap> heap;
+			DefragmentationSettings settings;
+		};
+
+		class DefragmentationTask final : public Core::BaseTask
+		{
+		public:
+			DefragmentationTask(const std::shared_ptr<DefragmentationTaskContext>& ctx);
+			void OnScheduled(const std::shared_ptr<Core::BaseStream>& stream) override;
+			void OnComplete(const std::shared_ptr<Core::BaseStream>& stream) override;
+		private:
+			std::shared_ptr<DefragmentationTaskContext> _ctx;
+		};
+
+		struct ThreadCache final
+		{
+			ThreadCache();
+			ThreadCache(const ThreadCache&) = delete;
+			ThreadCache(ThreadCache&&) noexcept = default;
+			ThreadCache& operator=(const ThreadCache&) = delete;
+			ThreadCache& operator=(ThreadCache&&) noexcept = default;
+			~ThreadCache();
+
+			std::weak_ptr<Heap> heap;
+			std::unordered_map<std::size_t, std::vector<Entry>> entries;
+			std::size_t entriesCount = 0;
+		};
+
+		std::shared_lock<std::shared_mutex> LockShared() const;
+		std::unique_lock<std::shared_mutex> LockExclusive() const;
+		std::unique_lock<std::mutex> LockBlock(Block& block) const;
+		Entry AllocateEntryExclusive(const Request& request);
+		void ReleaseEntryLocked(const Entry& entry);
+		std::optional<Entry> TryAllocateCachedEntry(const Request& request);
+		bool TryCacheEntry(const Entry& entry);
+		void TrackCachedEntry(const Entry& entry, bool cached);
+		ThreadCache& GetThreadCache();
+
+		std::vector<Relocation> PlanRelocations(const DefragmentationSettings& settings);
+		void CommitRelocations();
+		void ReplaceRelocatableHandle(Handle* oldHandle, Handle* newHandle);
+		void RemoveRelocatableHandle(Handle* handle);
+
 		std::unordered_set<std::uint64_t> _initializedBlockEntityIds;
+		std::unordered_set<Handle*> _relocatableHandles;
+		std::unordered_map<Handle*, Entry> _pendingRelocations;
+		std::mutex _relocationMutex;
+		mutable std::shared_mutex _blocksMutex;
+		std::uint64_t _id;
+
+		static std::atomic<std::uint64_t> _idCounter;
+		static thread_local std::unordered_map<std::uint64_t, ThreadCache> _threadCaches;
 	};
 }
@@ -2,6 +2,7 @@
 #include <Core/Math.hpp>
 #include <Core/Node.hpp>
 #include <cassert>
+#include <cstring>
 #include <stack>
 
 namespace MMPEngine::Core
@@ -425,6 +426,107 @@ namespace MMPEngine::Core
 		Transpose(res, inv);
     }
 
+	void Math::ToAffine(Affine3x4& res, const Matrix4x4& m) const
+	{
+		std::memcpy(&res, &m, sizeof(res));
+	}
+
+	void Math::FromAffine(Matrix4x4& res, const Affine3x4& m) const
+	{
+		std::memcpy(&res, &m, sizeof(m));
+		std::memcpy(&res.m[3], &kMatrix4x4Identity.m[3], sizeof(res.m[3]));
+	}
+
+	void Math::TRS(Affine3x4& res, const Transform& transform) const
+	{
+		Matrix4x4 rotation {};
+		Rotation(rotation, transform.rotation);
+
+		const std::float_t scale[3] = { transform.scale.x, transform.scale.y, transform.scale.z };
+		const std::float_t position[3] = { transform.position.x, transform.position.y, transform.position.z };
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				res.m[i][j] = rotation.m[i][j] * scale[j];
+			}
+
+			res.m[i][3] = position[i];
+		}
+	}
+
+	void Math::Multiply(Affine3x4& res, const Affine3x4& m1, const Affine3x4& m2) const
+	{
+		Affine3x4 tmp {};
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				tmp.m[i][j] = m1.m[i][0] * m2.m[0][j] + m1.m[i][1] * m2.m[1][j] + m1.m[i][2] * m2.m[2][j];
+			}
+
+			tmp.m[i][3] += m1.m[i][3];
+		}
+
+		res = tmp;
+	}
+
+	std::float_t Math::CalculateAffineCofactors(Matrix3x3& res, const Affine3x4& m)
+	{
+		res.m[0][0] = m.m[1][1] * m.m[2][2] - m.m[1][2] * m.m[2][1];
+		res.m[0][1] = m.m[1][2] * m.m[2][0] - m.m[1][0] * m.m[2][2];
+		res.m[0][2] = m.m[1][0] * m.m[2][1] - m.m[1][1] * m.m[2][0];
+
+		res.m[1][0] = m.m[0][2] * m.m[2][1] - m.m[0][1] * m.m[2][2];
+		res.m[1][1] = m.m[0][0] * m.m[2][2] - m.m[0][2] * m.m[2][0];
+		res.m[1][2] = m.m[0][1] * m.m[2][0] - m.m[0][0] * m.m[2][1];
+
+		res.m[2][0] = m.m[0][1] * m.m[1][2] - m.m[0][2] * m.m[1][1];
+		res.m[2][1] = m.m[0][2] * m.m[1][0] - m.m[0][0] * m.m[1][2];
+		res.m[2][2] = m.m[0][0] * m.m[1][1] - m.m[0][1] * m.m[1][0];
+
+		return m.m[0][0] * res.m[0][0] + m.m[0][1] * res.m[0][1] + m.m[0][2] * res.m[0][2];
+	}
+
+	void Math::Inverse(Affine3x4& res, const Affine3x4& m) const
+	{
+		Matrix3x3 cofactors {};
+		const auto det = CalculateAffineCofactors(cofactors, m);
+		assert(std::abs(det) >= _minValidationFloat);
+		const auto invDet = 1.0f / det;
+
+		Affine3x4 tmp {};
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				tmp.m[i][j] = cofactors.m[j][i] * invDet;
+			}
+
+			tmp.m[i][3] = -(tmp.m[i][0] * m.m[0][3] + tmp.m[i][1] * m.m[1][3] + tmp.m[i][2] * m.m[2][3]);
+		}
+
+		res = tmp;
+	}
+
+	void Math::InverseTranspose(Matrix3x3& res, const Affine3x4& m) const
+	{
+		const auto det = CalculateAffineCofactors(res, m);
+		assert(std::abs(det) >= _minValidationFloat);
+		const auto invDet = 1.0f / det;
+
+		for (auto& row : res.m)
+		{
+			for (auto& value : row)
+			{
+				value *= invDet;
+			}
+		}
+	}
+
 	void Math::Transpose(Matrix4x4& res, const Matrix4x4& m) const
 	{
 		for(std::size_t i = 0; i < 4; ++i)
@@ -567,6 +669,21 @@ namespace MMPEngine::Core
 		}
 	}
 
+	void Math::CalculateLocalToWorldSpaceMatrix(Affine3x4& res, const std::shared_ptr<const Node>& node) const
+	{
+		TRS(res, node->localTransform);
+		auto currentNode = node->GetParent();
+
+		while (currentNode)
+		{
+			Affine3x4 currentNodeTrs {};
+			TRS(currentNodeTrs, currentNode->localTransform);
+			Multiply(res, currentNodeTrs, res);
+
+			currentNode = currentNode->GetParent();
+		}
+	}
+
 	void Math::CalculateWorldSpaceTransform(Vector3Float& position, Quaternion& rotation, Matrix4x4& scale, const std::shared_ptr<const Node>& node) const
 	{
 		Matrix4x4 trs {};
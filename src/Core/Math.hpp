@@ -27,6 +27,14 @@ namespace MMPEngine::Core
 			}
 		};
 
+		static constexpr Affine3x4 kAffine3x4Identity = {
+			{
+		{1.0f, 0.0f, 0.0f, 0.0f},
+		{0.0f, 1.0f, 0.0f, 0.0f},
+		{0.0f, 0.0f, 1.0f, 0.0f}
+			}
+		};
+
 		static constexpr Quaternion kQuaternionIdentity = {
 			0.0f, 0.0f, 0.0f, 1.0f
 		};
@@ -59,6 +67,13 @@ namespace MMPEngine::Core
 		virtual void Inverse(Matrix4x4& res, const Matrix4x4& m) const;
 		virtual void InverseTranspose(Matrix4x4& res, const Matrix4x4& m) const;
 
+		virtual void ToAffine(Affine3x4& res, const Matrix4x4& m) const;
+		virtual void FromAffine(Matrix4x4& res, const Affine3x4& m) const;
+		virtual void TRS(Affine3x4& res, const Transform& transform) const;
+		virtual void Multiply(Affine3x4& res, const Affine3x4& m1, const Affine3x4& m2) const;
+		virtual void Inverse(Affine3x4& res, const Affine3x4& m) const;
+		virtual void InverseTranspose(Matrix3x3& res, const Affine3x4& m) const;
+
 		virtual void Normalize(Quaternion& q) const;
 		virtual void Inverse(Quaternion& res, const Quaternion& q) const;
 		virtual void Multiply(Quaternion& res, const Quaternion& q1, const Quaternion& q2) const;
@@ -67,6 +82,7 @@ namespace MMPEngine::Core
 		virtual void RotationFromEuler(Quaternion& res, const Vector3Float& eulerAngles) const;
 
 		virtual void CalculateLocalToWorldSpaceMatrix(Matrix4x4& res, const std::shared_ptr<const Node>& node) const;
+		virtual void CalculateLocalToWorldSpaceMatrix(Affine3x4& res, const std::shared_ptr<const Node>& node) const;
 		virtual void CalculateWorldSpaceTransform(Vector3Float& position, Quaternion& rotation, Matrix4x4& scale, const std::shared_ptr<const Node>& node) const;
 
 		template<typename TVec>
@@ -80,6 +96,7 @@ namespace MMPEngine::Core
 		static constexpr auto _minValidationFloat = 1.0e-7f;
 
 		static void ConjugateInPlace(Quaternion& q);
+		static std::float_t CalculateAffineCofactors(Matrix3x3& res, const Affine3x4& m);
 
 		template<typename TMatrix>
 		std::float_t DeterminantInternal(const TMatrix& m) const;
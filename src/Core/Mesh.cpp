@@ -1,12 +1,25 @@
 #include <Core/Mesh.hpp>
 #include <Core/Task.hpp>
+#include <Core/Node.hpp>
+#include <Core/TransformHierarchy.hpp>
+#include <algorithm>
+#include <cstring>
 
 namespace MMPEngine::Core
 {
-	Mesh::Mesh(GeometryPrototype&& proto) : _proto(std::move(proto)), _indexBufferInfo {}, _topology(GeometryPrototype::Topology::Triangles)
+	Mesh::Mesh(GeometryPrototype&& proto) : Mesh(std::move(proto), Settings {})
 	{
 	}
 
+	Mesh::Mesh(GeometryPrototype&& proto, const Settings& settings) : _settings(settings), _proto(std::move(proto)), _indexBufferInfo {}, _topology(GeometryPrototype::Topology::Triangles)
+	{
+	}
+
+	const Mesh::Settings& Mesh::GetSettings() const
+	{
+		return _settings;
+	}
+
 	Mesh::CreateBuffers::CreateBuffers(const std::shared_ptr<InitTaskContext>& ctx) : ContextualTask(ctx)
 	{
 	}
@@ -15,23 +28,105 @@ namespace MMPEngine::Core
 	{
 		ContextualTask::OnScheduled(stream);
 		const auto mesh = GetTaskContext()->mesh;
+		const auto& settings = mesh->_settings;
+
+		std::vector<const VertexBufferPrototype*> interleavedProtos {};
+
+		if (settings.arena)
+		{
+			for (const auto& vbProto : mesh->_proto.vertexBuffers)
+			{
+				interleavedProtos.push_back(vbProto.get());
+			}
+		}
+		else if (settings.vertexLayout != VertexLayout::Separate)
+		{
+			for (const auto& vbProto : mesh->_proto.vertexBuffers)
+			{
+				const auto semantics = vbProto->GetVBSettings().semantics;
+
+				if (settings.vertexLayout == VertexLayout::PositionAndInterleaved && semantics == VertexBufferPrototype::Semantics::Position)
+				{
+					continue;
+				}
+
+				if (!settings.interleavedSemantics.empty() && std::find(settings.interleavedSemantics.cbegin(), settings.interleavedSemantics.cend(), semantics) == settings.interleavedSemantics.cend())
+				{
+					continue;
+				}
+
+				interleavedProtos.push_back(vbProto.get());
+			}
+
+			if (interleavedProtos.size() < 2)
+			{
+				interleavedProtos.clear();
+			}
+		}
+
+		std::shared_ptr<VertexBuffer> interleavedBuffer = nullptr;
+
+		if (!interleavedProtos.empty())
+		{
+			mesh->_interleavedProto = std::make_unique<InterleavedVertexBufferPrototype>(interleavedProtos, BaseGeometryBufferPrototype::Settings {});
+
+			if (settings.arena)
+			{
+				mesh->_vertexAllocation = settings.arena->AllocateVertices(mesh->_interleavedProto->GetStride(), mesh->_interleavedProto->GetElementsCount());
+				mesh->_baseVertex = static_cast<std::uint32_t>(mesh->_vertexAllocation->GetFirstElement());
+				interleavedBuffer = std::dynamic_pointer_cast<VertexBuffer>(mesh->_vertexAllocation->handle.GetBuffer());
+			}
+			else
+			{
+				interleavedBuffer = mesh->CreateVertexBuffer(mesh->_interleavedProto.get());
+			}
+		}
 
 		for(const auto& vbProto : mesh->_proto.vertexBuffers)
 		{
+			auto& semanticBuffers = mesh->_vertexBufferInfos[vbProto->GetVBSettings().semantics];
+			const auto interleavedIt = std::find(interleavedProtos.cbegin(), interleavedProtos.cend(), vbProto.get());
+
+			if (interleavedIt != interleavedProtos.cend())
+			{
+				const auto& element = mesh->_interleavedProto->GetElements().at(std::distance(interleavedProtos.cbegin(), interleavedIt));
+				semanticBuffers.push_back(VertexBufferInfo{
+					interleavedBuffer,
+					element.settings,
+					element.format,
+					mesh->_interleavedProto->GetStride(),
+					mesh->_interleavedProto->GetElementsCount(),
+					element.offset
+				});
+				continue;
+			}
+
 			const auto vertexBuffer = mesh->CreateVertexBuffer(vbProto.get());
 
-			auto& semanticBuffers = mesh->_vertexBufferInfos[vbProto->GetVBSettings().semantics];
 			semanticBuffers.push_back(VertexBufferInfo{
 				vertexBuffer,
 	{vbProto->GetVBSettings(), vbProto->GetSettings()},
 				vbProto->GetFormat(),
 				vbProto->GetStride(),
-				vbProto->GetElementsCount()
+				vbProto->GetElementsCount(),
+				0
 			});
 		}
 
 		const auto& ibProto = mesh->_proto.indexBuffer;
-		const auto indexBuffer = mesh->CreateIndexBuffer(ibProto.get());
+		std::shared_ptr<IndexBuffer> indexBuffer = nullptr;
+
+		if (settings.arena)
+		{
+			mesh->_indexAllocation = settings.arena->AllocateIndices(ibProto->GetFormat(), ibProto->GetElementsCount());
+			mesh->_indexStart = static_cast<std::uint32_t>(mesh->_indexAllocation->GetFirstElement());
+			indexBuffer = std::dynamic_pointer_cast<IndexBuffer>(mesh->_indexAllocation->handle.GetBuffer());
+		}
+		else
+		{
+			indexBuffer = mesh->CreateIndexBuffer(ibProto.get());
+		}
+
 		mesh->_indexBufferInfo = IndexBufferInfo {
 			indexBuffer,
 			ibProto->GetSettings(),
@@ -55,11 +150,28 @@ namespace MMPEngine::Core
 						ctx->mesh->_topology = ctx->mesh->_proto.topology;
 						ctx->mesh->_subsets = ctx->mesh->_proto.subsets;
 
+						if (const auto& arena = ctx->mesh->_settings.arena)
+						{
+							if (ctx->mesh->_vertexAllocation.has_value())
+							{
+								stream->Schedule(arena->CreateWriteTask(ctx->mesh->_vertexAllocation.value(), ctx->mesh->_interleavedProto->GetDataPtr()));
+							}
+
+							stream->Schedule(arena->CreateWriteTask(ctx->mesh->_indexAllocation.value(), ctx->mesh->_proto.indexBuffer->GetDataPtr()));
+							return;
+						}
+
+						std::vector<std::shared_ptr<VertexBuffer>> vertexBuffers {};
+
 						for(const auto& vbInfos : ctx->mesh->_vertexBufferInfos)
 						{
 							for(const auto& vbInfo : vbInfos.second)
 							{
-								stream->Schedule(vbInfo.ptr->CreateInitializationTask());
+								if (std::find(vertexBuffers.cbegin(), vertexBuffers.cend(), vbInfo.ptr) == vertexBuffers.cend())
+								{
+									vertexBuffers.push_back(vbInfo.ptr);
+									stream->Schedule(vbInfo.ptr->CreateInitializationTask());
+								}
 							}
 						}
 
@@ -76,6 +188,7 @@ namespace MMPEngine::Core
 				{
 					GeometryPrototype empty{};
 					std::swap(ctx->mesh->_proto, empty);
+					ctx->mesh->_interleavedProto.reset();
 				}
 			)
 		});
@@ -91,6 +204,16 @@ namespace MMPEngine::Core
 		return _topology;
 	}
 
+	std::uint32_t Mesh::GetBaseVertex() const
+	{
+		return _baseVertex;
+	}
+
+	std::uint32_t Mesh::GetIndexStart() const
+	{
+		return _indexStart;
+	}
+
 	std::shared_ptr<const Mesh> Mesh::GetUnderlyingMesh() const
 	{
 		return shared_from_this();
@@ -126,12 +249,25 @@ namespace MMPEngine::Core
 				FunctionalTask::Handler {},
 				[ctx](const auto& stream)
 				{
-					if(ctx->renderer->_settings.staticData.manageUniformData)
+					if(!ctx->renderer->_settings.staticData.manageUniformData)
+					{
+						return;
+					}
+
+					if (ctx->renderer->_settings.staticData.dataLayout == DataLayout::Affine)
+					{
+						AffineData data{};
+						ctx->renderer->FillAffineData(stream->GetGlobalContext(), data);
+						ctx->renderer->_affineUniformBufferWriteTask = ctx->renderer->_affineUniformBuffer->CreateWriteAsyncTask(data);
+					}
+					else
 					{
 						Data data{};
 						ctx->renderer->FillData(stream->GetGlobalContext(), data);
 						ctx->renderer->_uniformBufferWriteTask = ctx->renderer->_uniformBuffer->CreateWriteAsyncTask(data);
 					}
+
+					ctx->renderer->_uploadedTransforms.clear();
 				},
 				FunctionalTask::Handler {}
 			),
@@ -149,7 +285,17 @@ namespace MMPEngine::Core
 
 		const auto renderer = GetTaskContext()->renderer;
 
-		if(renderer->_settings.staticData.manageUniformData)
+		if(!renderer->_settings.staticData.manageUniformData)
+		{
+			return;
+		}
+
+		if (renderer->_settings.staticData.dataLayout == DataLayout::Affine)
+		{
+			renderer->_affineUniformBuffer = renderer->CreateAffineUniformBuffer();
+			stream->Schedule(renderer->_affineUniformBuffer->CreateInitializationTask());
+		}
+		else
 		{
 			renderer->_uniformBuffer = renderer->CreateUniformBuffer();
 			stream->Schedule(renderer->_uniformBuffer->CreateInitializationTask());
@@ -166,6 +312,21 @@ namespace MMPEngine::Core
 		return _node;
 	}
 
+	void Mesh::Renderer::SetTransformHierarchy(const std::shared_ptr<const TransformHierarchy>& transformHierarchy)
+	{
+		_transformHierarchy = transformHierarchy;
+	}
+
+	std::uint32_t Mesh::Renderer::GetBaseVertex() const
+	{
+		return _mesh->GetBaseVertex();
+	}
+
+	std::uint32_t Mesh::Renderer::GetIndexStart() const
+	{
+		return _mesh->GetIndexStart();
+	}
+
 	const Mesh::Renderer::Settings& Mesh::Renderer::GetSettings() const
 	{
 		return _settings;
@@ -178,6 +339,11 @@ namespace MMPEngine::Core
 
 	std::shared_ptr<BaseEntity> Mesh::Renderer::GetUniformDataEntity() const
 	{
+		if (_settings.staticData.dataLayout == DataLayout::Affine)
+		{
+			return _affineUniformBuffer;
+		}
+
 		return _uniformBuffer;
 	}
 
@@ -191,10 +357,110 @@ namespace MMPEngine::Core
         return const_cast<Mesh::Renderer*>(this)->GetDynamicSettings().instancesCount > 0;
     }
 
-	void Mesh::Renderer::FillData(const std::shared_ptr<GlobalContext>& globalContext, Data& data) const
+	void Mesh::Renderer::CalculateLocalToWorldMatrix(const std::shared_ptr<GlobalContext>& globalContext, Matrix4x4& matrix) const
+	{
+		if (_transformHierarchy)
+		{
+			if (const auto index = _transformHierarchy->GetIndex(_node.get()))
+			{
+				matrix = _transformHierarchy->GetWorldMatrix(index.value());
+				return;
+			}
+		}
+
+		globalContext->math->CalculateLocalToWorldSpaceMatrix(matrix, _node);
+	}
+
+	void Mesh::Renderer::CalculateLocalToWorldMatrix(const std::shared_ptr<GlobalContext>& globalContext, Affine3x4& matrix) const
 	{
-		globalContext->math->CalculateLocalToWorldSpaceMatrix(data.localToWorldMatrix, GetNode());
+		if (_transformHierarchy)
+		{
+			if (const auto index = _transformHierarchy->GetIndex(_node.get()))
+			{
+				globalContext->math->ToAffine(matrix, _transformHierarchy->GetWorldMatrix(index.value()));
+				return;
+			}
+		}
+
+		globalContext->math->CalculateLocalToWorldSpaceMatrix(matrix, _node);
+	}
+
+	void Mesh::Renderer::FillData(const std::shared_ptr<GlobalContext>& globalContext, Data& data)
+	{
+		CalculateLocalToWorldMatrix(globalContext, data.localToWorldMatrix);
 		globalContext->math->InverseTranspose(data.localToWorldMatrixIT, data.localToWorldMatrix);
+		CaptureUploadedTransforms();
+	}
+
+	void Mesh::Renderer::FillAffineData(const std::shared_ptr<GlobalContext>& globalContext, AffineData& data)
+	{
+		CalculateLocalToWorldMatrix(globalContext, data.localToWorldMatrix);
+
+		Matrix3x3 localToWorldMatrixIT {};
+		globalContext->math->InverseTranspose(localToWorldMatrixIT, data.localToWorldMatrix);
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			data.localToWorldMatrixIT[i] = { localToWorldMatrixIT.m[i][0], localToWorldMatrixIT.m[i][1], localToWorldMatrixIT.m[i][2], 0.0f };
+		}
+
+		CaptureUploadedTransforms();
+	}
+
+	void Mesh::Renderer::ConvertToAffineData(const std::shared_ptr<GlobalContext>& globalContext, const Data& data, AffineData& affineData)
+	{
+		globalContext->math->ToAffine(affineData.localToWorldMatrix, data.localToWorldMatrix);
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			const auto& row = data.localToWorldMatrixIT.m[i];
+			affineData.localToWorldMatrixIT[i] = { row[0], row[1], row[2], 0.0f };
+		}
+	}
+
+	void Mesh::Renderer::CaptureUploadedTransforms()
+	{
+		_uploadedTransforms.clear();
+
+		for (auto node = _node.get(); node; node = node->GetParent().get())
+		{
+			_uploadedTransforms.push_back({ node, node->localTransform });
+		}
+	}
+
+	bool Mesh::Renderer::IsUniformDataChanged() const
+	{
+		auto node = _node.get();
+
+		for (const auto& uploaded : _uploadedTransforms)
+		{
+			if (uploaded.node != node || std::memcmp(&uploaded.localTransform, &node->localTransform, sizeof(Transform)) != 0)
+			{
+				return true;
+			}
+
+			node = node->GetParent().get();
+		}
+
+		return node != nullptr || _uploadedTransforms.empty();
+	}
+
+	std::shared_ptr<BaseTask> Mesh::Renderer::CreateTaskToUpdateAndWriteChangedUniformData(const std::vector<std::shared_ptr<Renderer>>& renderers)
+	{
+		return std::make_shared<FunctionalTask>(
+			[renderers](const auto& stream)
+			{
+				for (const auto& renderer : renderers)
+				{
+					if (renderer->GetUnderlyingRenderer()->IsUniformDataChanged())
+					{
+						stream->Schedule(renderer->CreateTaskToUpdateAndWriteUniformData());
+					}
+				}
+			},
+			FunctionalTask::Handler {},
+			FunctionalTask::Handler {}
+		);
 	}
 
 	std::shared_ptr<ContextualTask<Mesh::Renderer::UpdateDataTaskContext>> Mesh::Renderer::CreateTaskToUpdateAndWriteUniformData()
@@ -214,19 +480,49 @@ namespace MMPEngine::Core
 		ContextualTask::OnScheduled(stream);
 		const auto ctx = _internalContext;
 
-		if(ctx->renderer->_settings.staticData.manageUniformData)
+		if(!ctx->renderer->_settings.staticData.manageUniformData)
+		{
+			return;
+		}
+
+		if (!ctx->precomputed.has_value() && !ctx->renderer->IsUniformDataChanged())
 		{
+			return;
+		}
+
+		const auto globalContext = stream->GetGlobalContext();
+
+		if (ctx->renderer->_settings.staticData.dataLayout == DataLayout::Affine)
+		{
+			auto& data = ctx->renderer->_affineUniformBufferWriteTask->GetTaskContext()->data;
+
 			if (ctx->precomputed.has_value())
 			{
-				ctx->renderer->_uniformBufferWriteTask->GetTaskContext()->data = ctx->precomputed.value();
+				ConvertToAffineData(globalContext, ctx->precomputed.value(), data);
+				ctx->renderer->_uploadedTransforms.clear();
 			}
 			else
 			{
-				ctx->renderer->FillData(stream->GetGlobalContext(), ctx->renderer->_uniformBufferWriteTask->GetTaskContext()->data);
+				ctx->renderer->FillAffineData(globalContext, data);
 			}
 
-			stream->Schedule(ctx->renderer->_uniformBufferWriteTask);
+			stream->Schedule(ctx->renderer->_affineUniformBufferWriteTask);
+			return;
 		}
+
+		auto& data = ctx->renderer->_uniformBufferWriteTask->GetTaskContext()->data;
+
+		if (ctx->precomputed.has_value())
+		{
+			data = ctx->precomputed.value();
+			ctx->renderer->_uploadedTransforms.clear();
+		}
+		else
+		{
+			ctx->renderer->FillData(globalContext, data);
+		}
+
+		stream->Schedule(ctx->renderer->_uniformBufferWriteTask);
 	}
 
 }
@@ -7,9 +7,12 @@
 #include <Core/Context.hpp>
 #include <Core/Task.hpp>
 #include <Core/Buffer.hpp>
+#include <Core/GeometryArena.hpp>
 
 namespace MMPEngine::Core
 {
+	class TransformHierarchy;
+
 	class Mesh : public IInitializationTaskSource, public std::enable_shared_from_this<Mesh>
 	{
 	private:
@@ -26,11 +29,27 @@ namespace MMPEngine::Core
 			void OnScheduled(const std::shared_ptr<BaseStream>& stream) override;
 		};
 	public:
+		enum class VertexLayout : std::uint8_t
+		{
+			Separate,
+			Interleaved,
+			PositionAndInterleaved
+		};
+
+		struct Settings final
+		{
+			VertexLayout vertexLayout = VertexLayout::Separate;
+			std::vector<VertexBufferPrototype::Semantics> interleavedSemantics {};
+			std::shared_ptr<GeometryArena> arena = nullptr;
+		};
+
 		Mesh(GeometryPrototype&& proto);
+		Mesh(GeometryPrototype&& proto, const Settings& settings);
 		std::shared_ptr<BaseTask> CreateInitializationTask() override;
+		const Settings& GetSettings() const;
 	protected:
 		virtual std::shared_ptr<BaseTask> CreateInternalInitializationTask() = 0;
-		virtual std::shared_ptr<VertexBuffer> CreateVertexBuffer(const VertexBufferPrototype* vbPrototype) = 0;
+		virtual std::shared_ptr<VertexBuffer> CreateVertexBuffer(const BaseGeometryBufferPrototype* vbPrototype) = 0;
 		virtual std::shared_ptr<IndexBuffer> CreateIndexBuffer(const IndexBufferPrototype* ibPrototype) = 0;
 	protected:
 
@@ -41,6 +60,7 @@ namespace MMPEngine::Core
 			VertexBufferPrototype::Format format;
 			std::size_t stride;
 			std::size_t elementsCount;
+			std::size_t offset;
 		};
 
 		struct IndexBufferInfo final
@@ -52,11 +72,17 @@ namespace MMPEngine::Core
 			std::size_t elementsCount;
 		};
 
+		Settings _settings;
 		GeometryPrototype _proto;
+		std::unique_ptr<InterleavedVertexBufferPrototype> _interleavedProto;
 		std::map<VertexBufferPrototype::Semantics, std::vector<VertexBufferInfo>> _vertexBufferInfos;
 		IndexBufferInfo _indexBufferInfo;
 		GeometryPrototype::Topology _topology;
 		std::vector<GeometryPrototype::Subset> _subsets;
+		std::optional<GeometryArena::Allocation> _vertexAllocation;
+		std::optional<GeometryArena::Allocation> _indexAllocation;
+		std::uint32_t _baseVertex = 0;
+		std::uint32_t _indexStart = 0;
 
 	public:
 		virtual std::shared_ptr<const Mesh> GetUnderlyingMesh() const;
@@ -65,6 +91,8 @@ namespace MMPEngine::Core
 		virtual const IndexBufferInfo& GetIndexBufferInfo() const;
 		virtual const std::vector<GeometryPrototype::Subset>& GetSubsets() const;
 		virtual GeometryPrototype::Topology GetTopology() const;
+		virtual std::uint32_t GetBaseVertex() const;
+		virtual std::uint32_t GetIndexStart() const;
 
 		class Renderer : public IInitializationTaskSource, public IGeometryRenderer, public std::enable_shared_from_this<Renderer>
 		{
@@ -74,12 +102,31 @@ namespace MMPEngine::Core
 				Matrix4x4 localToWorldMatrix;
 				Matrix4x4 localToWorldMatrixIT;
 			};
+			struct AffineData final
+			{
+				Affine3x4 localToWorldMatrix;
+				Vector4Float localToWorldMatrixIT[3];
+			};
+			// Affine renderers upload AffineData, so their materials must read MeshRendererAffineData
+			enum class DataLayout : std::uint8_t
+			{
+				Full,
+				Affine
+			};
 			struct Settings final
 			{
+				struct Indirect final
+				{
+					std::shared_ptr<BaseUnorderedAccessBuffer> indices;
+					std::shared_ptr<BaseUnorderedAccessBuffer> arguments;
+				};
+
 				struct Static final
 				{
 					bool manageUniformData = true;
+					DataLayout dataLayout = DataLayout::Full;
 					std::optional<std::vector<GeometryPrototype::VertexAttribute>> requiredMeshAttributes = std::nullopt;
+					std::optional<Indirect> indirect = std::nullopt;
 				};
 				struct Dynamic final
 				{
@@ -122,20 +169,37 @@ namespace MMPEngine::Core
 				std::shared_ptr<InternalUpdateDataTaskContext> _internalContext;
 			};
 
-			void FillData(const std::shared_ptr<GlobalContext>& globalContext, Data& data) const;
+			struct UploadedTransform final
+			{
+				const Node* node;
+				Transform localTransform;
+			};
+
+			void CalculateLocalToWorldMatrix(const std::shared_ptr<GlobalContext>& globalContext, Matrix4x4& matrix) const;
+			void CalculateLocalToWorldMatrix(const std::shared_ptr<GlobalContext>& globalContext, Affine3x4& matrix) const;
+			void FillData(const std::shared_ptr<GlobalContext>& globalContext, Data& data);
+			void FillAffineData(const std::shared_ptr<GlobalContext>& globalContext, AffineData& data);
+			void CaptureUploadedTransforms();
+			static void ConvertToAffineData(const std::shared_ptr<GlobalContext>& globalContext, const Data& data, AffineData& affineData);
 		public:
 			Renderer(const Settings& settings, const std::shared_ptr<Mesh>& mesh, const std::shared_ptr<Node>& node);
 			std::shared_ptr<BaseTask> CreateInitializationTask() override;
 			std::shared_ptr<Mesh> GetMesh() const;
 			std::shared_ptr<Node> GetNode() const;
+			void SetTransformHierarchy(const std::shared_ptr<const TransformHierarchy>& transformHierarchy);
+			std::uint32_t GetBaseVertex() const;
+			std::uint32_t GetIndexStart() const;
             bool IsActive() const override;
 			virtual const Settings& GetSettings() const;
 			virtual Settings::Dynamic& GetDynamicSettings();
 			virtual std::shared_ptr<BaseEntity> GetUniformDataEntity() const;
 			virtual std::shared_ptr<Renderer> GetUnderlyingRenderer();
 			virtual std::shared_ptr<ContextualTask<UpdateDataTaskContext>> CreateTaskToUpdateAndWriteUniformData();
+			bool IsUniformDataChanged() const;
+			static std::shared_ptr<BaseTask> CreateTaskToUpdateAndWriteChangedUniformData(const std::vector<std::shared_ptr<Renderer>>& renderers);
 		protected:
 			virtual std::shared_ptr<UniformBuffer<Data>> CreateUniformBuffer() = 0;
+			virtual std::shared_ptr<UniformBuffer<AffineData>> CreateAffineUniformBuffer() = 0;
 			virtual std::shared_ptr<BaseTask> CreateInternalInitializationTask() = 0;
 
 			template<typename TAttributeCallback, typename = std::enable_if_t<std::is_invocable_v<TAttributeCallback, const VertexBufferInfo&, const GeometryPrototype::VertexAttribute&>>>
@@ -145,8 +209,12 @@ namespace MMPEngine::Core
 		private:
 			std::shared_ptr<Mesh> _mesh;
 			std::shared_ptr<Node> _node;
+			std::shared_ptr<const TransformHierarchy> _transformHierarchy;
 			std::shared_ptr<UniformBuffer<Data>> _uniformBuffer;
 			std::shared_ptr<ContextualTask<UniformBuffer<Data>::WriteTaskContext>> _uniformBufferWriteTask;
+			std::shared_ptr<UniformBuffer<AffineData>> _affineUniformBuffer;
+			std::shared_ptr<ContextualTask<UniformBuffer<AffineData>::WriteTaskContext>> _affineUniformBufferWriteTask;
+			std::vector<UploadedTransform> _uploadedTransforms;
 		};
 	};
 
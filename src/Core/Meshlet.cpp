@@ -0,0 +1,285 @@
+#include <Core/Meshlet.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace MMPEngine::Core
+{
+	namespace
+	{
+		std::vector<std::uint32_t> ReadIndices(const IndexBufferPrototype& indexBuffer)
+		{
+			if (indexBuffer.GetFormat() == IndexBufferPrototype::Format::Uint16)
+			{
+				const auto& data = dynamic_cast<const IndexBufferPrototype16&>(indexBuffer).data;
+				return { data.cbegin(), data.cend() };
+			}
+
+			return dynamic_cast<const IndexBufferPrototype32&>(indexBuffer).data;
+		}
+
+		Vector3Float Sub(const Vector3Float& a, const Vector3Float& b)
+		{
+			return { a.x - b.x, a.y - b.y, a.z - b.z };
+		}
+
+		std::float_t Dot(const Vector3Float& a, const Vector3Float& b)
+		{
+			return a.x * b.x + a.y * b.y + a.z * b.z;
+		}
+
+		Vector3Float Cross(const Vector3Float& a, const Vector3Float& b)
+		{
+			return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+		}
+
+		Vector4Float NormalizePlane(const Vector4Float& plane)
+		{
+			const auto length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			return length > 0.0f ? Vector4Float { plane.x / length, plane.y / length, plane.z / length, plane.w / length } : plane;
+		}
+	}
+
+	MeshletGeometry MeshletGeometry::Build(const GeometryPrototype& proto, const Settings& settings)
+	{
+		assert(settings.maxVertices >= 3 && settings.maxVertices < std::numeric_limits<std::uint8_t>::max());
+		assert(settings.maxTriangles >= 1);
+
+		const auto positionsIt = std::find_if(proto.vertexBuffers.cbegin(), proto.vertexBuffers.cend(), [](const auto& vb)
+		{
+			return vb->GetVBSettings().semantics == VertexBufferPrototype::Semantics::Position && vb->GetFormat() == VertexBufferPrototype::Format::Float3;
+		});
+
+		if (!proto.indexBuffer || positionsIt == proto.vertexBuffers.cend() || proto.topology != GeometryPrototype::Topology::Triangles)
+		{
+			throw UnsupportedException("meshlets require indexed triangles with float3 positions");
+		}
+
+		const auto positions = static_cast<const Vector3Float*>((*positionsIt)->GetDataPtr());
+		const auto vertexCount = (*positionsIt)->GetElementsCount();
+		const auto indices = ReadIndices(*proto.indexBuffer);
+
+		MeshletGeometry result {};
+		std::vector<std::uint8_t> localIndices(vertexCount, std::numeric_limits<std::uint8_t>::max());
+
+		for (const auto& subset : proto.subsets)
+		{
+			assert(subset.indexCount % 3 == 0);
+			assert(static_cast<std::size_t>(subset.indexStart) + subset.indexCount <= indices.size());
+
+			Meshlet current {};
+
+			const auto flush = [&]()
+			{
+				if (current.triangleCount == 0)
+				{
+					return;
+				}
+
+				current.indexCount = current.triangleCount * 3;
+				current.baseVertex = subset.baseVertex;
+				ComputeBounds(current, indices.data() + current.indexStart, positions + subset.baseVertex);
+
+				for (std::uint32_t v = 0; v < current.vertexCount; ++v)
+				{
+					localIndices[result.vertices[current.vertexOffset + v]] = std::numeric_limits<std::uint8_t>::max();
+				}
+
+				result.meshlets.push_back(current);
+				current = {};
+			};
+
+			for (auto i = subset.indexStart; i < subset.indexStart + subset.indexCount; i += 3)
+			{
+				std::uint32_t newVertices = 0;
+
+				for (std::uint32_t c = 0; c < 3; ++c)
+				{
+					const auto vertex = indices[i + c] + subset.baseVertex;
+					assert(vertex < vertexCount);
+					newVertices += (localIndices[vertex] == std::numeric_limits<std::uint8_t>::max()) ? 1 : 0;
+				}
+
+				if (current.vertexCount + newVertices > settings.maxVertices || current.triangleCount + 1 > settings.maxTriangles)
+				{
+					flush();
+				}
+
+				if (current.triangleCount == 0)
+				{
+					current.vertexOffset = static_cast<std::uint32_t>(result.vertices.size());
+					current.triangleOffset = static_cast<std::uint32_t>(result.triangles.size());
+					current.indexStart = i;
+				}
+
+				for (std::uint32_t c = 0; c < 3; ++c)
+				{
+					const auto vertex = indices[i + c] + subset.baseVertex;
+
+					if (localIndices[vertex] == std::numeric_limits<std::uint8_t>::max())
+					{
+						localIndices[vertex] = static_cast<std::uint8_t>(current.vertexCount++);
+						result.vertices.push_back(vertex);
+					}
+
+					result.triangles.push_back(localIndices[vertex]);
+				}
+
+				++current.triangleCount;
+			}
+
+			flush();
+		}
+
+		return result;
+	}
+
+	void MeshletGeometry::ComputeBounds(Meshlet& meshlet, const std::uint32_t* indices, const Vector3Float* positions)
+	{
+		Vector3Float min { std::numeric_limits<std::float_t>::max(), std::numeric_limits<std::float_t>::max(), std::numeric_limits<std::float_t>::max() };
+		Vector3Float max { std::numeric_limits<std::float_t>::lowest(), std::numeric_limits<std::float_t>::lowest(), std::numeric_limits<std::float_t>::lowest() };
+
+		for (std::uint32_t i = 0; i < meshlet.indexCount; ++i)
+		{
+			const auto& p = positions[indices[i]];
+			min = { std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z) };
+			max = { std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z) };
+		}
+
+		meshlet.center = { (min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f };
+		meshlet.radius = 0.0f;
+
+		for (std::uint32_t i = 0; i < meshlet.indexCount; ++i)
+		{
+			const auto d = Sub(positions[indices[i]], meshlet.center);
+			meshlet.radius = std::max(meshlet.radius, std::sqrt(Dot(d, d)));
+		}
+
+		std::vector<Vector3Float> normals {};
+		normals.reserve(meshlet.triangleCount);
+		Vector3Float axis { 0.0f, 0.0f, 0.0f };
+
+		for (std::uint32_t t = 0; t < meshlet.triangleCount; ++t)
+		{
+			const auto& p0 = positions[indices[t * 3 + 0]];
+			const auto& p1 = positions[indices[t * 3 + 1]];
+			const auto& p2 = positions[indices[t * 3 + 2]];
+
+			const auto n = Cross(Sub(p1, p0), Sub(p2, p0));
+			const auto length = std::sqrt(Dot(n, n));
+
+			if (length <= std::numeric_limits<std::float_t>::epsilon())
+			{
+				continue;
+			}
+
+			normals.push_back({ n.x / length, n.y / length, n.z / length });
+			axis = { axis.x + normals.back().x, axis.y + normals.back().y, axis.z + normals.back().z };
+		}
+
+		const auto axisLength = std::sqrt(Dot(axis, axis));
+		meshlet.coneAxis = { 0.0f, 0.0f, 0.0f };
+		meshlet.coneCutoff = 1.0f;
+
+		if (axisLength <= std::numeric_limits<std::float_t>::epsilon())
+		{
+			return;
+		}
+
+		meshlet.coneAxis = { axis.x / axisLength, axis.y / axisLength, axis.z / axisLength };
+
+		auto minDot = 1.0f;
+
+		for (const auto& n : normals)
+		{
+			minDot = std::min(minDot, Dot(n, meshlet.coneAxis));
+		}
+
+		if (minDot > 0.1f)
+		{
+			meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+		}
+	}
+
+	MeshletGeometry::CullingData MeshletGeometry::CreateCullingData(const Matrix4x4& localToClip, const Vector3Float& localCameraPosition, std::uint32_t meshletCount, IndexBufferPrototype::Format indexFormat)
+	{
+		const auto row = [&localToClip](std::size_t r)
+		{
+			return Vector4Float { localToClip.m[r][0], localToClip.m[r][1], localToClip.m[r][2], localToClip.m[r][3] };
+		};
+
+		const auto add = [](const Vector4Float& a, const Vector4Float& b)
+		{
+			return Vector4Float { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w };
+		};
+
+		const auto sub = [](const Vector4Float& a, const Vector4Float& b)
+		{
+			return Vector4Float { a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w };
+		};
+
+		CullingData data {};
+		data.frustumPlanes[0] = NormalizePlane(add(row(3), row(0)));
+		data.frustumPlanes[1] = NormalizePlane(sub(row(3), row(0)));
+		data.frustumPlanes[2] = NormalizePlane(add(row(3), row(1)));
+		data.frustumPlanes[3] = NormalizePlane(sub(row(3), row(1)));
+		data.frustumPlanes[4] = NormalizePlane(row(2));
+		data.frustumPlanes[5] = NormalizePlane(sub(row(3), row(2)));
+		data.cameraPosition = { localCameraPosition.x, localCameraPosition.y, localCameraPosition.z, 1.0f };
+		data.meshletCount = meshletCount;
+		data.instanceCount = 1;
+		data.indexFormat = static_cast<std::uint32_t>(indexFormat);
+		data.flags = CullingData::kFrustum | CullingData::kCone;
+		return data;
+	}
+
+	bool MeshletGeometry::IsVisible(const Meshlet& meshlet, const CullingData& data)
+	{
+		if (data.flags & CullingData::kFrustum)
+		{
+			for (const auto& plane : data.frustumPlanes)
+			{
+				if (plane.x * meshlet.center.x + plane.y * meshlet.center.y + plane.z * meshlet.center.z + plane.w < -meshlet.radius)
+				{
+					return false;
+				}
+			}
+		}
+
+		if (data.flags & CullingData::kCone)
+		{
+			const auto d = Sub(meshlet.center, { data.cameraPosition.x, data.cameraPosition.y, data.cameraPosition.z });
+
+			if (Dot(d, meshlet.coneAxis) >= meshlet.coneCutoff * std::sqrt(Dot(d, d)) + meshlet.radius)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	MeshletGeometry::DrawIndexedArguments MeshletGeometry::Cull(const std::vector<Meshlet>& meshlets, const CullingData& data, const IndexBufferPrototype& indexBuffer, std::vector<std::uint32_t>& compactedIndices)
+	{
+		const auto indices = ReadIndices(indexBuffer);
+		compactedIndices.clear();
+
+		for (std::size_t m = 0; m < std::min<std::size_t>(meshlets.size(), data.meshletCount); ++m)
+		{
+			const auto& meshlet = meshlets[m];
+
+			if (!IsVisible(meshlet, data))
+			{
+				continue;
+			}
+
+			for (std::uint32_t i = 0; i < meshlet.indexCount; ++i)
+			{
+				compactedIndices.push_back(indices[meshlet.indexStart + i] + meshlet.baseVertex);
+			}
+		}
+
+		return { static_cast<std::uint32_t>(compactedIndices.size()), data.instanceCount, 0, 0, 0 };
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <vector>
+#include <Core/Geometry.hpp>
+
+namespace MMPEngine::Core
+{
+	class MeshletGeometry final
+	{
+	public:
+		static constexpr std::uint32_t kMaxVertices = 64;
+		static constexpr std::uint32_t kMaxTriangles = 124;
+
+		struct Settings final
+		{
+			std::uint32_t maxVertices = kMaxVertices;
+			std::uint32_t maxTriangles = kMaxTriangles;
+		};
+
+		struct Meshlet final
+		{
+			Vector3Float center;
+			std::float_t radius;
+			Vector3Float coneAxis;
+			std::float_t coneCutoff;
+			std::uint32_t vertexOffset;
+			std::uint32_t vertexCount;
+			std::uint32_t triangleOffset;
+			std::uint32_t triangleCount;
+			std::uint32_t indexStart;
+			std::uint32_t indexCount;
+			std::uint32_t baseVertex;
+			std::uint32_t reserved;
+		};
+
+		struct CullingData final
+		{
+			enum Flags : std::uint32_t
+			{
+				kFrustum = 1 << 0,
+				kCone = 1 << 1
+			};
+
+			Vector4Float frustumPlanes[6];
+			Vector4Float cameraPosition;
+			std::uint32_t meshletCount;
+			std::uint32_t instanceCount;
+			std::uint32_t indexFormat;
+			std::uint32_t flags;
+		};
+
+		struct DrawIndexedArguments final
+		{
+			std::uint32_t indexCount;
+			std::uint32_t instanceCount;
+			std::uint32_t firstIndex;
+			std::int32_t vertexOffset;
+			std::uint32_t firstInstance;
+		};
+
+		std::vector<Meshlet> meshlets;
+		std::vector<std::uint32_t> vertices;
+		std::vector<std::uint8_t> triangles;
+
+		static MeshletGeometry Build(const GeometryPrototype& proto, const Settings& settings);
+
+		static CullingData CreateCullingData(const Matrix4x4& localToClip, const Vector3Float& localCameraPosition, std::uint32_t meshletCount, IndexBufferPrototype::Format indexFormat);
+		static bool IsVisible(const Meshlet& meshlet, const CullingData& data);
+		static DrawIndexedArguments Cull(const std::vector<Meshlet>& meshlets, const CullingData& data, const IndexBufferPrototype& indexBuffer, std::vector<std::uint32_t>& compactedIndices);
+	private:
+		static void ComputeBounds(Meshlet& meshlet, const std::uint32_t* indices, const Vector3Float* positions);
+	};
+}
@@ -1,10 +1,25 @@
 #include <Core/Node.hpp>
+#include <algorithm>
 #include <cassert>
-#include <queue>
-#include <string>
+#include <mutex>
 
 namespace MMPEngine::Core
 {
+	namespace
+	{
+		struct NameRegistry final
+		{
+			std::mutex mutex;
+			std::unordered_map<std::string, Node::NameId> ids;
+		};
+
+		NameRegistry& GetNameRegistry()
+		{
+			static NameRegistry registry;
+			return registry;
+		}
+	}
+
 	Node::Node() :
 		_parent(nullptr),
 		localTransform{ {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f} }
@@ -15,6 +30,7 @@ namespace MMPEngine::Core
 
 	Node::Node(std::string_view name) :
 		_name({ name.cbegin(), name.cend() }),
+		_nameId(InternName(name)),
 		_parent(nullptr),
 		localTransform{ {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f} }
 	{
@@ -22,58 +38,87 @@ namespace MMPEngine::Core
 
 	Node::Node(const Node& origin) :
 		enable_shared_from_this(origin),
-		_name({ origin.GetName().cbegin(), origin.GetName().cend() })
+		_name({ origin.GetName().cbegin(), origin.GetName().cend() }),
+		_nameId(origin._nameId)
 	{
 		CloneSubtree(&origin, this);
 	}
 
 	void Node::SetParent(const std::shared_ptr<Node>& newParent)
 	{
-		const auto thisPtr = shared_from_this();
+		assert(!newParent || !newParent->IsInSubtreeOf(this));
 
-		if (_parent)
-		{
-			_parent->_children.erase(thisPtr);
-		}
+		Detach();
 
 		if (newParent)
 		{
-			newParent->_children.emplace(thisPtr);
+			const auto index = newParent->GetRootIndex();
+			Attach(newParent, index, index ? newParent->GetPathKey() : 0);
 		}
+	}
 
-		const auto oldParent = _parent;
-		_parent = newParent;
+	void Node::AddChild(const std::shared_ptr<Node>& newChild)
+	{
+		newChild->SetParent(shared_from_this());
+	}
 
-		if (newParent)
+	void Node::AddChildren(const std::vector<std::shared_ptr<Node>>& newChildren)
+	{
+		const auto thisPtr = shared_from_this();
+
+		for (const auto& c : newChildren)
 		{
-			newParent->ValidateSubtree();
+			assert(c && !IsInSubtreeOf(c.get()));
+			c->Detach();
 		}
 
-		if (oldParent)
+		const auto index = GetRootIndex();
+		const auto pathKey = index ? GetPathKey() : 0;
+		_children.reserve(_children.size() + newChildren.size());
+
+		for (const auto& c : newChildren)
 		{
-			oldParent->ValidateSubtree();
+			if (!c->_parent)
+			{
+				c->Attach(thisPtr, index, pathKey);
+			}
 		}
 	}
 
-	void Node::AddChild(const std::shared_ptr<Node>& newChild)
+	void Node::Detach()
 	{
-		const auto thisPtr = shared_from_this();
+		if (!_parent)
+		{
+			return;
+		}
 
-		if (newChild->_parent)
+		if (const auto index = GetRootIndex())
 		{
-			newChild->_parent->_children.erase(newChild);
+			UpdateIndex(*index, GetPathKey(), false);
 		}
-		_children.emplace(newChild);
 
-		const auto oldParent = newChild->_parent;
-		newChild->_parent = thisPtr;
+		_parent->_children.erase(shared_from_this());
+		_parent = nullptr;
+	}
 
-		if (oldParent)
+	void Node::Attach(const std::shared_ptr<Node>& parent, Index* index, std::size_t parentPathKey)
+	{
+		assert(!_parent);
+
+		_index.reset();
+		_parent = parent;
+		_parent->_children.emplace(shared_from_this());
+
+		if (index)
 		{
-			oldParent->ValidateSubtree();
+			UpdateIndex(*index, CombinePathKey(parentPathKey, GetNameId()), true);
 		}
+	}
 
-		thisPtr->ValidateSubtree();
+	void Node::RemoveChild(const std::shared_ptr<Node>& child)
+	{
+		assert(child->_parent.get() == this);
+		child->SetParent(nullptr);
 	}
 
 	std::shared_ptr<Node> Node::GetParent() const
@@ -91,16 +136,158 @@ namespace MMPEngine::Core
 		return _name;
 	}
 
+	Node::NameId Node::GetNameId() const
+	{
+		if (!_nameId.has_value())
+		{
+			_nameId = InternName(_name);
+		}
+
+		return _nameId.value();
+	}
+
+	Node::NameId Node::InternName(std::string_view name)
+	{
+		auto& registry = GetNameRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		return registry.ids.emplace(std::string { name }, registry.ids.size()).first->second;
+	}
+
+	std::optional<Node::NameId> Node::FindNameId(std::string_view name)
+	{
+		auto& registry = GetNameRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		const auto it = registry.ids.find(std::string { name });
+
+		if (it == registry.ids.cend())
+		{
+			return std::nullopt;
+		}
+
+		return it->second;
+	}
+
+	void Node::EnableIndex()
+	{
+		assert(!_parent);
+
+		if (!_index)
+		{
+			_index = std::make_unique<Index>();
+			UpdateIndex(*_index, GetPathKey(), true);
+		}
+	}
+
+	bool Node::HasIndex() const
+	{
+		return _index != nullptr;
+	}
+
+	const Node* Node::GetRoot() const
+	{
+		auto node = this;
+
+		while (node->_parent)
+		{
+			node = node->_parent.get();
+		}
+
+		return node;
+	}
+
+	Node::Index* Node::GetRootIndex() const
+	{
+		return GetRoot()->_index.get();
+	}
+
+	std::size_t Node::CombinePathKey(std::size_t parentKey, NameId nameId)
+	{
+		return parentKey ^ (std::hash<NameId> {}(nameId) + 0x9e3779b97f4a7c15ull + (parentKey << 6) + (parentKey >> 2));
+	}
+
+	std::size_t Node::GetPathKey() const
+	{
+		return _parent ? CombinePathKey(_parent->GetPathKey(), GetNameId()) : 0;
+	}
+
+	bool Node::IsInSubtreeOf(const Node* ancestor) const
+	{
+		auto node = this;
+
+		while (node && node != ancestor)
+		{
+			node = node->_parent.get();
+		}
+
+		return node == ancestor;
+	}
+
+	void Node::UpdateIndex(Index& index, std::size_t pathKey, bool add)
+	{
+		for (auto entries : { &index.names[GetNameId()], &index.paths[pathKey] })
+		{
+			if (add)
+			{
+				entries->push_back(this);
+			}
+			else
+			{
+				const auto it = std::find(entries->begin(), entries->end(), this);
+				assert(it != entries->end());
+				*it = entries->back();
+				entries->pop_back();
+			}
+		}
+
+		for (const auto& c : _children)
+		{
+			c->UpdateIndex(index, CombinePathKey(pathKey, c->GetNameId()), add);
+		}
+	}
+
 	std::shared_ptr<Node> Node::FindNodeInSubtree(std::string_view name) const
 	{
-		if (_name == name)
+		if (const auto nameId = FindNameId(name))
+		{
+			return FindNodeInSubtree(nameId.value());
+		}
+
+		if (GetRootIndex())
+		{
+			return nullptr;
+		}
+
+		return FindNodeInSubtreeByName(name);
+	}
+
+	std::shared_ptr<Node> Node::FindNodeInSubtree(NameId nameId) const
+	{
+		if (GetNameId() == nameId)
 		{
 			return std::const_pointer_cast<Node>(shared_from_this());
 		}
 
+		if (const auto index = GetRootIndex())
+		{
+			const auto it = index->names.find(nameId);
+
+			if (it != index->names.cend())
+			{
+				for (const auto node : it->second)
+				{
+					if (node->IsInSubtreeOf(this))
+					{
+						return node->shared_from_this();
+					}
+				}
+			}
+
+			return nullptr;
+		}
+
 		for (auto& c : _children)
 		{
-			if (const auto node = c->FindNodeInSubtree(name))
+			if (const auto node = c->FindNodeInSubtree(nameId))
 			{
 				return node;
 			}
@@ -109,28 +296,129 @@ namespace MMPEngine::Core
 		return nullptr;
 	}
 
-	void Node::ValidateSubtree() const
+	std::shared_ptr<Node> Node::FindNodeInSubtreeByName(std::string_view name) const
 	{
-		std::queue<std::shared_ptr<const Node>> bfs;
-		std::unordered_set<std::shared_ptr<const Node>> visited;
-		const auto sharedThis = shared_from_this();
-		bfs.emplace(sharedThis);
+		if (GetName() == name)
+		{
+			return std::const_pointer_cast<Node>(shared_from_this());
+		}
 
-		while (!bfs.empty())
+		for (auto& c : _children)
 		{
-			const auto currentNode = bfs.front();
-			bfs.pop();
+			if (const auto node = c->FindNodeInSubtreeByName(name))
+			{
+				return node;
+			}
+		}
 
-			assert(visited.find(currentNode) == visited.cend());
-			visited.emplace(currentNode);
+		return nullptr;
+	}
+
+	std::shared_ptr<Node> Node::FindNodeByPath(std::string_view path) const
+	{
+		std::vector<std::string_view> names;
+		std::vector<NameId> nameIds;
+
+		while (!path.empty())
+		{
+			const auto separator = path.find('/');
+			const auto segment = path.substr(0, separator);
 
-			for (const auto& c : currentNode->GetChildren())
+			if (!segment.empty())
 			{
-				assert(c->GetParent() == currentNode);
-				bfs.emplace(c);
+				names.push_back(segment);
+
+				if (const auto nameId = FindNameId(segment))
+				{
+					nameIds.push_back(nameId.value());
+				}
 			}
+
+			path = separator == std::string_view::npos ? std::string_view {} : path.substr(separator + 1);
+		}
+
+		if (nameIds.size() != names.size())
+		{
+			return GetRootIndex() ? nullptr : FindNodeByNames(names, 0);
 		}
+
+		if (const auto index = GetRootIndex())
+		{
+			auto pathKey = GetPathKey();
+
+			for (const auto nameId : nameIds)
+			{
+				pathKey = CombinePathKey(pathKey, nameId);
+			}
+
+			const auto it = index->paths.find(pathKey);
+
+			if (it != index->paths.cend())
+			{
+				for (const auto node : it->second)
+				{
+					auto current = node;
+
+					for (auto nameId = nameIds.crbegin(); current && nameId != nameIds.crend(); ++nameId)
+					{
+						current = current->GetNameId() == *nameId ? current->_parent.get() : nullptr;
+					}
+
+					if (current == this)
+					{
+						return node->shared_from_this();
+					}
+				}
+			}
+
+			return nullptr;
+		}
+
+		return FindNodeByNameIds(nameIds, 0);
 	}
+
+	std::shared_ptr<Node> Node::FindNodeByNameIds(const std::vector<NameId>& nameIds, std::size_t depth) const
+	{
+		if (depth == nameIds.size())
+		{
+			return std::const_pointer_cast<Node>(shared_from_this());
+		}
+
+		for (const auto& c : _children)
+		{
+			if (c->GetNameId() == nameIds[depth])
+			{
+				if (const auto node = c->FindNodeByNameIds(nameIds, depth + 1))
+				{
+					return node;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	std::shared_ptr<Node> Node::FindNodeByNames(const std::vector<std::string_view>& names, std::size_t depth) const
+	{
+		if (depth == names.size())
+		{
+			return std::const_pointer_cast<Node>(shared_from_this());
+		}
+
+		for (const auto& c : _children)
+		{
+			if (c->GetName() == names[depth])
+			{
+				if (const auto node = c->FindNodeByNames(names, depth + 1))
+				{
+					return node;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
 	void Node::CloneSubtree(const Node* origin, Node* target)
 	{
 		target->localTransform = origin->localTransform;
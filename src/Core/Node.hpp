@@ -1,13 +1,20 @@
 #pragma once
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <Core/Base.hpp>
 
 namespace MMPEngine::Core
 {
 	class Node final : public std::enable_shared_from_this<Node>
 	{
+		friend class TransformHierarchy;
 	public:
+		using NameId = std::size_t;
+
 		Node();
 		Node(std::string_view);
 		Node(const Node&);
@@ -18,16 +25,46 @@ namespace MMPEngine::Core
 
 		void SetParent(const std::shared_ptr<Node>&);
 		void AddChild(const std::shared_ptr<Node>&);
+		void AddChildren(const std::vector<std::shared_ptr<Node>>&);
+		void RemoveChild(const std::shared_ptr<Node>&);
 		std::shared_ptr<Node> GetParent() const;
 		const std::unordered_set<std::shared_ptr<Node>>& GetChildren() const;
 		std::string_view GetName() const;
+		NameId GetNameId() const;
+
+		void EnableIndex();
+		bool HasIndex() const;
 
 		std::shared_ptr<Node> FindNodeInSubtree(std::string_view) const;
+		std::shared_ptr<Node> FindNodeInSubtree(NameId) const;
+		std::shared_ptr<Node> FindNodeByPath(std::string_view) const;
+
+		static NameId InternName(std::string_view);
+		static std::optional<NameId> FindNameId(std::string_view);
 	private:
+		struct Index final
+		{
+			std::unordered_map<NameId, std::vector<Node*>> names;
+			std::unordered_map<std::size_t, std::vector<Node*>> paths;
+		};
+
 		std::string _name;
+		mutable std::optional<NameId> _nameId;
 		std::shared_ptr<Node> _parent;
 		std::unordered_set<std::shared_ptr<Node>> _children;
-		void ValidateSubtree() const;
+		std::unique_ptr<Index> _index;
+
+		const Node* GetRoot() const;
+		Index* GetRootIndex() const;
+		std::size_t GetPathKey() const;
+		bool IsInSubtreeOf(const Node*) const;
+		void UpdateIndex(Index&, std::size_t pathKey, bool add);
+		void Detach();
+		void Attach(const std::shared_ptr<Node>& parent, Index* index, std::size_t parentPathKey);
+		std::shared_ptr<Node> FindNodeByNameIds(const std::vector<NameId>&, std::size_t) const;
+		std::shared_ptr<Node> FindNodeByNames(const std::vector<std::string_view>&, std::size_t) const;
+		std::shared_ptr<Node> FindNodeInSubtreeByName(std::string_view) const;
+		static std::size_t CombinePathKey(std::size_t, NameId);
 		static void CloneSubtree(const Node*, Node*);
 	public:
 		Transform localTransform;
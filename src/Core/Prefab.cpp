@@ -0,0 +1,200 @@
+#include <Core/Prefab.hpp>
+#include <cassert>
+
+namespace MMPEngine::Core
+{
+	Prefab::Prefab(const std::shared_ptr<const Node>& root)
+	{
+		assert(root);
+
+		std::vector<const Node*> nodes { root.get() };
+		_entries.push_back({ std::string { root->GetName() }, root->GetNameId(), kNoParent, 0, 0, root->localTransform });
+
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			_entries[i].firstChild = nodes.size();
+			_entries[i].childrenCount = nodes[i]->GetChildren().size();
+
+			for (const auto& c : nodes[i]->GetChildren())
+			{
+				nodes.push_back(c.get());
+				_entries.push_back({ std::string { c->GetName() }, c->GetNameId(), i, 0, 0, c->localTransform });
+			}
+		}
+	}
+
+	Prefab::~Prefab() = default;
+
+	std::size_t Prefab::GetEntriesCount() const
+	{
+		return _entries.size();
+	}
+
+	const Prefab::Entry& Prefab::GetEntry(std::size_t index) const
+	{
+		assert(index < _entries.size());
+		return _entries[index];
+	}
+
+	std::optional<std::size_t> Prefab::FindEntry(std::string_view path) const
+	{
+		std::size_t current = 0;
+
+		while (!path.empty())
+		{
+			const auto separator = path.find('/');
+			const auto segment = path.substr(0, separator);
+			path = separator == std::string_view::npos ? std::string_view {} : path.substr(separator + 1);
+
+			if (segment.empty())
+			{
+				continue;
+			}
+
+			const auto nameId = Node::FindNameId(segment);
+
+			if (!nameId.has_value())
+			{
+				return std::nullopt;
+			}
+
+			const auto& entry = _entries[current];
+			const auto childrenEnd = entry.firstChild + entry.childrenCount;
+			auto child = entry.firstChild;
+
+			while (child < childrenEnd && _entries[child].nameId != nameId.value())
+			{
+				++child;
+			}
+
+			if (child == childrenEnd)
+			{
+				return std::nullopt;
+			}
+
+			current = child;
+		}
+
+		return current;
+	}
+
+	std::shared_ptr<Prefab::Instance> Prefab::Instantiate() const
+	{
+		return std::make_shared<Instance>(shared_from_this());
+	}
+
+	Prefab::Instance::Instance(const std::shared_ptr<const Prefab>& prefab) : _prefab(prefab)
+	{
+		assert(_prefab);
+	}
+
+	Prefab::Instance::~Instance() = default;
+
+	std::shared_ptr<const Prefab> Prefab::Instance::GetPrefab() const
+	{
+		return _prefab;
+	}
+
+	const Transform& Prefab::Instance::GetLocalTransform(std::size_t index) const
+	{
+		if (IsMaterialized())
+		{
+			return _nodes[index]->localTransform;
+		}
+
+		const auto it = _overrides.find(index);
+		return it == _overrides.cend() ? _prefab->GetEntry(index).localTransform : it->second;
+	}
+
+	void Prefab::Instance::SetLocalTransform(std::size_t index, const Transform& transform)
+	{
+		assert(index < _prefab->GetEntriesCount());
+
+		if (IsMaterialized())
+		{
+			_nodes[index]->localTransform = transform;
+			return;
+		}
+
+		_overrides[index] = transform;
+	}
+
+	std::size_t Prefab::Instance::GetOverridesCount() const
+	{
+		return _overrides.size();
+	}
+
+	bool Prefab::Instance::IsMaterialized() const
+	{
+		return !_nodes.empty();
+	}
+
+	std::shared_ptr<Node> Prefab::Instance::GetNode(std::size_t index)
+	{
+		assert(index < _prefab->GetEntriesCount());
+
+		if (!IsMaterialized())
+		{
+			Materialize();
+		}
+
+		return _nodes[index];
+	}
+
+	void Prefab::Instance::Materialize()
+	{
+		const auto entriesCount = _prefab->GetEntriesCount();
+		_nodes.reserve(entriesCount);
+
+		for (std::size_t i = 0; i < entriesCount; ++i)
+		{
+			const auto& entry = _prefab->GetEntry(i);
+			const auto it = _overrides.find(i);
+
+			_nodes.push_back(std::make_shared<Node>(entry.name));
+			_nodes.back()->localTransform = it == _overrides.cend() ? entry.localTransform : it->second;
+		}
+
+		for (std::size_t i = 0; i < entriesCount; ++i)
+		{
+			const auto& entry = _prefab->GetEntry(i);
+
+			if (entry.childrenCount > 0)
+			{
+				const auto firstChild = _nodes.cbegin() + static_cast<std::ptrdiff_t>(entry.firstChild);
+				_nodes[i]->AddChildren({ firstChild, firstChild + static_cast<std::ptrdiff_t>(entry.childrenCount) });
+			}
+		}
+
+		_overrides.clear();
+	}
+
+	void Prefab::Instance::CalculateLocalToWorldSpaceMatrices(std::vector<Matrix4x4>& res, const Math& math) const
+	{
+		const auto entriesCount = _prefab->GetEntriesCount();
+		res.resize(entriesCount);
+
+		for (std::size_t i = 0; i < entriesCount; ++i)
+		{
+			const auto parent = _prefab->GetEntry(i).parent;
+
+			if (parent == kNoParent)
+			{
+				if (IsMaterialized())
+				{
+					math.CalculateLocalToWorldSpaceMatrix(res[i], _nodes[i]);
+				}
+				else
+				{
+					math.TRS(res[i], GetLocalTransform(i));
+				}
+
+				continue;
+			}
+
+			Matrix4x4 local {};
+			math.TRS(local, GetLocalTransform(i));
+			math.Multiply(res[i], res[parent], local);
+		}
+	}
+}
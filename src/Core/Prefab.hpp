@@ -0,0 +1,66 @@
+#pragma once
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <Core/Node.hpp>
+#include <Core/Math.hpp>
+
+namespace MMPEngine::Core
+{
+	class Prefab final : public std::enable_shared_from_this<Prefab>
+	{
+	public:
+		static constexpr auto kNoParent = (std::numeric_limits<std::size_t>::max)();
+
+		struct Entry final
+		{
+			std::string name;
+			Node::NameId nameId;
+			std::size_t parent;
+			std::size_t firstChild;
+			std::size_t childrenCount;
+			Transform localTransform;
+		};
+
+		class Instance final
+		{
+		public:
+			Instance(const std::shared_ptr<const Prefab>& prefab);
+			Instance(const Instance&) = delete;
+			Instance(Instance&&) noexcept = delete;
+			Instance& operator=(const Instance&) = delete;
+			Instance& operator=(Instance&&) noexcept = delete;
+			~Instance();
+
+			std::shared_ptr<const Prefab> GetPrefab() const;
+			const Transform& GetLocalTransform(std::size_t index) const;
+			void SetLocalTransform(std::size_t index, const Transform& transform);
+			std::size_t GetOverridesCount() const;
+
+			bool IsMaterialized() const;
+			std::shared_ptr<Node> GetNode(std::size_t index);
+			void CalculateLocalToWorldSpaceMatrices(std::vector<Matrix4x4>& res, const Math& math) const;
+		private:
+			void Materialize();
+
+			std::shared_ptr<const Prefab> _prefab;
+			std::unordered_map<std::size_t, Transform> _overrides;
+			std::vector<std::shared_ptr<Node>> _nodes;
+		};
+
+		Prefab(const std::shared_ptr<const Node>& root);
+		Prefab(const Prefab&) = delete;
+		Prefab(Prefab&&) noexcept = delete;
+		Prefab& operator=(const Prefab&) = delete;
+		Prefab& operator=(Prefab&&) noexcept = delete;
+		~Prefab();
+
+		std::size_t GetEntriesCount() const;
+		const Entry& GetEntry(std::size_t index) const;
+		std::optional<std::size_t> FindEntry(std::string_view path) const;
+		std::shared_ptr<Instance> Instantiate() const;
+	private:
+		std::vector<Entry> _entries;
+	};
+}
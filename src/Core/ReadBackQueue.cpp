@@ -0,0 +1,152 @@
+#include <Core/ReadBackQueue.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace MMPEngine::Core
+{
+	ReadBackQueue::ReadBackQueue(const Settings& settings) : _settings(settings)
+	{
+		assert(_settings.framesInFlight > 0);
+		assert(_settings.frameByteLength > 0);
+	}
+
+	ReadBackQueue::~ReadBackQueue() = default;
+
+	const ReadBackQueue::Settings& ReadBackQueue::GetSettings() const
+	{
+		return _settings;
+	}
+
+	std::shared_ptr<BaseTask> ReadBackQueue::CreateInitializationTask()
+	{
+		std::vector<std::shared_ptr<BaseTask>> tasks;
+		_frames.resize(_settings.framesInFlight);
+
+		for (auto& frame : _frames)
+		{
+			frame.buffer = CreateReadBackBuffer(_settings.frameByteLength);
+			tasks.push_back(frame.buffer->CreateInitializationTask());
+		}
+
+		return std::make_shared<StaticBatchTask>(std::move(tasks));
+	}
+
+	std::shared_ptr<BaseTask> ReadBackQueue::CreateFrameTask()
+	{
+		const auto queue = shared_from_this();
+
+		return std::make_shared<FunctionalTask>(
+			[queue](const auto& stream)
+			{
+				queue->Deliver(stream);
+				queue->Record(stream);
+			},
+			FunctionalTask::Handler {},
+			FunctionalTask::Handler {}
+		);
+	}
+
+	void ReadBackQueue::Enqueue(const std::shared_ptr<Buffer>& src, std::size_t byteLength, std::size_t srcByteOffset, Callback&& callback)
+	{
+		assert(src);
+		assert(byteLength > 0 && byteLength <= _settings.frameByteLength);
+		assert(srcByteOffset + byteLength <= src->GetSettings().byteLength);
+
+		_pendingRequests.push_back({ src, byteLength, srcByteOffset, 0, std::move(callback) });
+	}
+
+	std::future<std::vector<std::uint8_t>> ReadBackQueue::Enqueue(const std::shared_ptr<Buffer>& src, std::size_t byteLength, std::size_t srcByteOffset)
+	{
+		const auto promise = std::make_shared<std::promise<std::vector<std::uint8_t>>>();
+		auto future = promise->get_future();
+
+		Enqueue(src, byteLength, srcByteOffset, [promise](const void* data, std::size_t dataByteLength)
+		{
+			const auto bytes = static_cast<const std::uint8_t*>(data);
+			promise->set_value(std::vector<std::uint8_t>(bytes, bytes + dataByteLength));
+		});
+
+		return future;
+	}
+
+	std::size_t ReadBackQueue::GetPendingRequestsCount() const
+	{
+		return _pendingRequests.size();
+	}
+
+	std::size_t ReadBackQueue::GetFramesInFlightCount() const
+	{
+		return static_cast<std::size_t>(std::count_if(_frames.cbegin(), _frames.cend(), [](const auto& frame) { return frame.inFlight; }));
+	}
+
+	void ReadBackQueue::Deliver(const std::shared_ptr<BaseStream>& stream)
+	{
+		for (std::size_t i = 0; i < _frames.size(); ++i)
+		{
+			auto& frame = _frames[(_nextFrameIndex + i) % _frames.size()];
+
+			if (!frame.inFlight || !stream->IsSyncCounterValueCompleted(frame.syncCounterValue))
+			{
+				continue;
+			}
+
+			const auto data = std::make_shared<std::vector<std::uint8_t>>(frame.usedByteLength);
+			const auto readTask = frame.buffer->CreateReadTask(data->data(), frame.usedByteLength, 0);
+			readTask->GetTaskContext()->synchronize = false;
+
+			stream->Schedule(readTask);
+			stream->Schedule(std::make_shared<FunctionalTask>(
+				FunctionalTask::Handler {},
+				[data, requests = std::move(frame.requests)](const auto&)
+				{
+					for (const auto& request : requests)
+					{
+						if (request.callback)
+						{
+							request.callback(data->data() + request.dstByteOffset, request.byteLength);
+						}
+					}
+				},
+				FunctionalTask::Handler {}
+			));
+
+			frame.requests.clear();
+			frame.usedByteLength = 0;
+			frame.inFlight = false;
+		}
+	}
+
+	void ReadBackQueue::Record(const std::shared_ptr<BaseStream>& stream)
+	{
+		assert(!_frames.empty());
+
+		auto& frame = _frames[_nextFrameIndex];
+
+		if (_pendingRequests.empty() || frame.inFlight)
+		{
+			return;
+		}
+
+		while (!_pendingRequests.empty())
+		{
+			auto& request = _pendingRequests.front();
+			const auto dstByteOffset = (frame.usedByteLength + kAlignment - 1) / kAlignment * kAlignment;
+
+			if (dstByteOffset + request.byteLength > _settings.frameByteLength)
+			{
+				break;
+			}
+
+			request.dstByteOffset = dstByteOffset;
+			stream->Schedule(request.src->CreateCopyToBufferTask(frame.buffer, request.byteLength, request.srcByteOffset, request.dstByteOffset));
+
+			frame.usedByteLength = dstByteOffset + request.byteLength;
+			frame.requests.push_back(std::move(request));
+			_pendingRequests.pop_front();
+		}
+
+		frame.syncCounterValue = stream->GetSyncCounterValue();
+		frame.inFlight = true;
+		_nextFrameIndex = (_nextFrameIndex + 1) % _frames.size();
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <deque>
+#include <functional>
+#include <future>
+#include <Core/Buffer.hpp>
+
+namespace MMPEngine::Core
+{
+	class ReadBackQueue : public IInitializationTaskSource, public std::enable_shared_from_this<ReadBackQueue>
+	{
+	public:
+		struct Settings final
+		{
+			std::size_t framesInFlight = 3;
+			std::size_t frameByteLength = 64 * 1024;
+			std::string name = {};
+		};
+
+		using Callback = std::function<void(const void* data, std::size_t byteLength)>;
+	private:
+		struct Request final
+		{
+			std::shared_ptr<Buffer> src;
+			std::size_t byteLength = 0;
+			std::size_t srcByteOffset = 0;
+			std::size_t dstByteOffset = 0;
+			Callback callback;
+		};
+
+		struct Frame final
+		{
+			std::shared_ptr<ReadBackBuffer> buffer;
+			std::vector<Request> requests;
+			std::size_t usedByteLength = 0;
+			std::uint64_t syncCounterValue = 0;
+			bool inFlight = false;
+		};
+	public:
+		static constexpr std::size_t kAlignment = 16;
+
+		ReadBackQueue(const Settings& settings);
+		ReadBackQueue(const ReadBackQueue&) = delete;
+		ReadBackQueue(ReadBackQueue&&) noexcept = delete;
+		ReadBackQueue& operator=(const ReadBackQueue&) = delete;
+		ReadBackQueue& operator=(ReadBackQueue&&) noexcept = delete;
+		~ReadBackQueue() override;
+
+		std::shared_ptr<BaseTask> CreateInitializationTask() override;
+		// delivery polls the recording frame's sync counter; streams still wait at the end of each frame, so results arrive one frame later
+		std::shared_ptr<BaseTask> CreateFrameTask();
+		void Enqueue(const std::shared_ptr<Buffer>& src, std::size_t byteLength, std::size_t srcByteOffset, Callback&& callback);
+		std::future<std::vector<std::uint8_t>> Enqueue(const std::shared_ptr<Buffer>& src, std::size_t byteLength, std::size_t srcByteOffset = 0);
+		std::size_t GetPendingRequestsCount() const;
+		std::size_t GetFramesInFlightCount() const;
+		const Settings& GetSettings() const;
+	protected:
+		virtual std::shared_ptr<ReadBackBuffer> CreateReadBackBuffer(std::size_t byteLength) = 0;
+	private:
+		void Deliver(const std::shared_ptr<BaseStream>& stream);
+		void Record(const std::shared_ptr<BaseStream>& stream);
+	private:
+		Settings _settings;
+		std::vector<Frame> _frames;
+		std::deque<Request> _pendingRequests;
+		std::size_t _nextFrameIndex = 0;
+	};
+}
@@ -4,6 +4,7 @@
 #include <Core/Text.hpp>
 #include <Core/Context.hpp>
 #include <cassert>
+#include <utility>
 
 namespace MMPEngine::Core
 {
@@ -90,6 +91,7 @@ namespace MMPEngine::Core
 
 		SwitchState(State::Execution);
 
+		const auto start = std::chrono::steady_clock::now();
 		const auto thisPtr = shared_from_this();
 		while (!_scheduledTasks.empty())
 		{
@@ -101,6 +103,7 @@ namespace MMPEngine::Core
 		}
 
 		SubmitInternal();
+		_submitAndWaitTime += std::chrono::steady_clock::now() - start;
 	}
 
 	void BaseStream::Wait()
@@ -111,7 +114,9 @@ namespace MMPEngine::Core
 		}
 
 		SwitchState(State::Sync);
+		const auto start = std::chrono::steady_clock::now();
 		WaitInternal();
+		_submitAndWaitTime += std::chrono::steady_clock::now() - start;
 		SwitchState(State::Complete);
 		_lastCompletedSyncCounter = _syncCounter;
 	}
@@ -139,6 +144,11 @@ namespace MMPEngine::Core
 		Wait();
 	}
 
+	std::chrono::nanoseconds BaseStream::ConsumeSubmitAndWaitTime()
+	{
+		return std::exchange(_submitAndWaitTime, std::chrono::nanoseconds::zero());
+	}
+
 	std::shared_ptr<GlobalContext> BaseStream::GetGlobalContext() const
 	{
 		return _globalContext;
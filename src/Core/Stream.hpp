@@ -1,4 +1,5 @@
 #pragma once
+#include <chrono>
 #include <memory>
 #include <queue>
 #include <unordered_map>
@@ -67,6 +68,7 @@ namespace MMPEngine::Core
         virtual void Submit();
 		void Wait();
 		void SubmitAndWait();
+		std::chrono::nanoseconds ConsumeSubmitAndWaitTime();
 
 		std::shared_ptr<GlobalContext> GetGlobalContext() const;
 		std::shared_ptr<StreamContext> GetStreamContext() const;
@@ -79,6 +81,7 @@ namespace MMPEngine::Core
 
 		std::uint64_t _syncCounter = 0;
 		std::uint64_t _lastCompletedSyncCounter = 0;
+		std::chrono::nanoseconds _submitAndWaitTime {};
 
 		std::queue<std::shared_ptr<BaseTask>> _scheduledTasks;
 		std::queue<std::shared_ptr<BaseTask>> _finalizedTasks;
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <Core/AccessTracker.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class AccessTrackerTests : public testing::Test
+	{
+	protected:
+		static constexpr AccessTracker::StageFlags kCompute = 1 << 0;
+		static constexpr AccessTracker::StageFlags kVertex = 1 << 1;
+		static constexpr AccessTracker::StageFlags kFragment = 1 << 2;
+		static constexpr AccessTracker::AccessFlags kRead = 1 << 0;
+		static constexpr AccessTracker::AccessFlags kWrite = 1 << 1;
+
+		AccessTracker _tracker { kWrite };
+	};
+
+	TEST_F(AccessTrackerTests, SkipsBarriersWithoutPriorWrites)
+	{
+		ASSERT_FALSE(_tracker.Track(kVertex, kRead).has_value());
+		ASSERT_EQ(_tracker.GetReadStage(), kVertex);
+
+		const auto write = _tracker.Track(kCompute, kWrite);
+		ASSERT_TRUE(write.has_value());
+		ASSERT_EQ(write->srcStage, kVertex);
+		ASSERT_EQ(write->srcAccess, 0);
+		ASSERT_EQ(_tracker.GetReadStage(), 0);
+	}
+
+	TEST_F(AccessTrackerTests, MakesWritesVisibleOncePerStage)
+	{
+		_tracker.Track(kCompute, kWrite);
+
+		const auto read = _tracker.Track(kVertex, kRead);
+		ASSERT_TRUE(read.has_value());
+		ASSERT_EQ(read->srcStage, kCompute);
+		ASSERT_EQ(read->srcAccess, kWrite);
+
+		ASSERT_FALSE(_tracker.Track(kVertex, kRead).has_value());
+		ASSERT_TRUE(_tracker.Track(kFragment, kRead).has_value());
+
+		const auto write = _tracker.Track(kCompute, kRead | kWrite);
+		ASSERT_TRUE(write.has_value());
+		ASSERT_EQ(write->srcStage, kCompute | kVertex | kFragment);
+		ASSERT_FALSE(_tracker.Track(kCompute, kRead).has_value());
+	}
+}
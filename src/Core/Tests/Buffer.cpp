@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <Core/Buffer.hpp>
+#include <algorithm>
+#include <numeric>
+
+namespace MMPEngine::Core::Tests
+{
+	class BufferTests : public testing::Test
+	{
+	protected:
+		std::vector<std::uint8_t> _source;
+		std::vector<std::uint8_t> _destination;
+
+		inline void SetUp() override
+		{
+			_source.resize(1024);
+			_destination.resize(1024, 0);
+			std::iota(_source.begin(), _source.end(), static_cast<std::uint8_t>(1));
+		}
+	};
+
+	TEST_F(BufferTests, CoalescesAdjacentRegions)
+	{
+		const auto writeRegions = UploadBuffer::CoalesceWriteRegions({
+			UploadBuffer::WriteRegion { _source.data() + 64, 32, 64 },
+			UploadBuffer::WriteRegion { _source.data(), 64, 0 },
+			UploadBuffer::WriteRegion { _source.data() + 96, 0, 96 },
+			UploadBuffer::WriteRegion { _source.data() + 256, 16, 96 },
+			UploadBuffer::WriteRegion { _source.data() + 128, 16, 128 }
+		});
+
+		ASSERT_EQ(writeRegions.size(), 3);
+		ASSERT_EQ(writeRegions[0].src, _source.data());
+		ASSERT_EQ(writeRegions[0].byteLength, 96);
+		ASSERT_EQ(writeRegions[1].byteOffset, 96);
+		ASSERT_EQ(writeRegions[1].src, _source.data() + 256);
+		ASSERT_EQ(writeRegions[2].byteOffset, 128);
+
+		const auto copyRegions = Buffer::CoalesceCopyRegions({
+			Buffer::CopyRegion { 16, 16, 16 },
+			Buffer::CopyRegion { 16, 0, 0 },
+			Buffer::CopyRegion { 16, 64, 32 },
+			Buffer::CopyRegion { 16, 48, 48 }
+		});
+
+		ASSERT_EQ(copyRegions.size(), 3);
+		ASSERT_EQ(copyRegions[0].byteLength, 32);
+		ASSERT_EQ(copyRegions[1].srcByteOffset, 64);
+		ASSERT_EQ(copyRegions[2].dstByteOffset, 48);
+	}
+
+	TEST_F(BufferTests, WritesRegions)
+	{
+		for (const auto nonTemporal : { false, true })
+		{
+			std::fill(_destination.begin(), _destination.end(), static_cast<std::uint8_t>(0));
+
+			UploadBuffer::WriteTaskContext context {};
+			context.nonTemporal = nonTemporal;
+			context.regions = UploadBuffer::CoalesceWriteRegions({
+				UploadBuffer::WriteRegion { _source.data() + 3, 517, 3 },
+				UploadBuffer::WriteRegion { _source.data() + 700, 7, 701 }
+			});
+
+			UploadBuffer::Write(_destination.data(), context);
+
+			ASSERT_EQ(_destination[2], 0);
+			ASSERT_TRUE(std::equal(_source.begin() + 3, _source.begin() + 520, _destination.begin() + 3));
+			ASSERT_EQ(_destination[520], 0);
+			ASSERT_TRUE(std::equal(_source.begin() + 700, _source.begin() + 707, _destination.begin() + 701));
+			ASSERT_EQ(_destination[708], 0);
+		}
+
+		UploadBuffer::WriteTaskContext context {};
+		context.src = _source.data();
+		context.byteLength = 100;
+		context.byteOffset = 10;
+		UploadBuffer::Write(_destination.data(), context);
+
+		ASSERT_TRUE(std::equal(_source.begin(), _source.begin() + 100, _destination.begin() + 10));
+	}
+}
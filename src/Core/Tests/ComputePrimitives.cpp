@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <Core/ComputePrimitives.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace MMPEngine::Core::Tests
+{
+	class ComputePrimitivesTests : public testing::Test
+	{
+	protected:
+		std::vector<std::uint32_t> _values;
+
+		inline void SetUp() override
+		{
+			std::mt19937 generator { 7 };
+			_values.resize(70000);
+			std::generate(_values.begin(), _values.end(), [&generator]() { return static_cast<std::uint32_t>(generator()); });
+		}
+	};
+
+	TEST_F(ComputePrimitivesTests, PlansScanLevels)
+	{
+		ASSERT_EQ(ComputePrimitives::GetScanLevels(1), std::vector<std::uint32_t> { 1 });
+		ASSERT_EQ(ComputePrimitives::GetScanLevels(ComputePrimitives::kGroupSize), std::vector<std::uint32_t> { ComputePrimitives::kGroupSize });
+		ASSERT_EQ(ComputePrimitives::GetScanLevels(70000), (std::vector<std::uint32_t> { 70000, 274, 2 }));
+		ASSERT_EQ(ComputePrimitives::GetGroupsCount(0), 1);
+		ASSERT_EQ(ComputePrimitives::GetGroupsCount(257), 2);
+		ASSERT_NE(ComputePrimitives::GetShaderId(ComputePrimitives::Kernel::RadixScatter), ComputePrimitives::GetShaderId(ComputePrimitives::Kernel::RadixCount));
+		ASSERT_EQ(ComputePrimitives::GetSegmentedReduceGroupsCount(3), 3);
+		ASSERT_EQ(ComputePrimitives::GetSegmentedReduceGroupsCount(70000), ComputePrimitives::kMaxGroupsCount);
+	}
+
+	TEST_F(ComputePrimitivesTests, RanksRadixDigitsWithPackedCounts)
+	{
+		std::vector<std::uint32_t> digits(ComputePrimitives::kGroupSize);
+		std::vector<std::uint32_t> ranks(digits.size());
+
+		std::fill(digits.begin(), digits.end(), ComputePrimitives::kRadixSize - 1);
+		ComputePrimitives::RankRadixDigits(digits.data(), digits.size(), ranks.data());
+
+		for (std::size_t i = 0; i < ranks.size(); ++i)
+		{
+			ASSERT_EQ(ranks[i], i);
+		}
+
+		std::transform(_values.begin(), _values.begin() + digits.size(), digits.begin(), [](auto value) { return value % ComputePrimitives::kRadixSize; });
+		ComputePrimitives::RankRadixDigits(digits.data(), digits.size(), ranks.data());
+
+		for (std::size_t i = 0; i < ranks.size(); ++i)
+		{
+			ASSERT_EQ(ranks[i], static_cast<std::uint32_t>(std::count(digits.begin(), digits.begin() + i, digits[i])));
+		}
+	}
+
+	TEST_F(ComputePrimitivesTests, ScansAndCompacts)
+	{
+		const std::vector<std::uint32_t> input { 3, 0, 2, 5, 0, 1 };
+		std::vector<std::uint32_t> output(input.size());
+
+		ComputePrimitives::Scan(input.data(), output.data(), input.size(), false);
+		ASSERT_EQ(output, (std::vector<std::uint32_t> { 0, 3, 3, 5, 10, 10 }));
+
+		ComputePrimitives::Scan(input.data(), output.data(), input.size(), true);
+		ASSERT_EQ(output, (std::vector<std::uint32_t> { 3, 3, 5, 10, 10, 11 }));
+
+		const std::vector<std::uint32_t> values { 10, 11, 12, 13, 14, 15 };
+		std::vector<std::uint32_t> compacted(values.size());
+
+		ASSERT_EQ(ComputePrimitives::Compact(values.data(), input.data(), compacted.data(), values.size()), 4);
+		ASSERT_EQ(std::vector<std::uint32_t>(compacted.begin(), compacted.begin() + 4), (std::vector<std::uint32_t> { 10, 12, 13, 15 }));
+	}
+
+	TEST_F(ComputePrimitivesTests, RadixSortsKeysWithPayload)
+	{
+		auto keys = _values;
+		std::transform(keys.begin(), keys.end(), keys.begin(), [](auto key) { return key % 1000; });
+
+		std::vector<std::uint32_t> payload(keys.size());
+		std::iota(payload.begin(), payload.end(), 0u);
+
+		const auto original = keys;
+		ComputePrimitives::RadixSort(keys.data(), payload.data(), keys.size());
+
+		ASSERT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+		for (std::size_t i = 0; i < keys.size(); ++i)
+		{
+			ASSERT_EQ(original[payload[i]], keys[i]);
+			ASSERT_TRUE(i == 0 || keys[i - 1] != keys[i] || payload[i - 1] < payload[i]);
+		}
+	}
+
+	TEST_F(ComputePrimitivesTests, ReducesSegmentsAndBuildsHistogram)
+	{
+		const std::vector<std::uint32_t> values { 1, 2, 3, 4, 5, 6, 7 };
+		const std::vector<std::uint32_t> offsets { 0, 2, 2, 7 };
+		std::vector<std::uint32_t> sums(offsets.size() - 1);
+
+		ComputePrimitives::SegmentedReduce(values.data(), offsets.data(), sums.size(), sums.data());
+		ASSERT_EQ(sums, (std::vector<std::uint32_t> { 3, 0, 25 }));
+
+		std::vector<std::uint32_t> bins(16);
+		ComputePrimitives::Histogram(_values.data(), _values.size(), 28, static_cast<std::uint32_t>(bins.size()), bins.data());
+
+		ASSERT_EQ(std::accumulate(bins.begin(), bins.end(), 0u), _values.size());
+		ASSERT_EQ(ComputePrimitives::GetHistogramBin(0xFFFFFFFF, 0, 16), 15);
+		ASSERT_EQ(ComputePrimitives::GetHistogramBin(3, 0, 16), 3);
+	}
+}
@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <Core/FrameGraph.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class ResidentBuffer final : public Core::ResidentBuffer
+	{
+	public:
+		ResidentBuffer(const Settings& settings) : Core::ResidentBuffer(settings)
+		{
+		}
+		std::shared_ptr<BaseTask> CreateCopyToBufferTask(const std::shared_ptr<Core::Buffer>&, std::size_t, std::size_t, std::size_t) const override
+		{
+			return BaseTask::kEmpty;
+		}
+	};
+
+	class FrameGraphTests : public testing::Test
+	{
+	protected:
+		using Stage = FrameGraph::Stage;
+		using Access = FrameGraph::Access;
+
+		std::shared_ptr<FrameGraph> _graph;
+
+		inline void SetUp() override
+		{
+			testing::Test::SetUp();
+			_graph = std::make_shared<FrameGraph>();
+		}
+
+		inline void TearDown() override
+		{
+			_graph.reset();
+			testing::Test::TearDown();
+		}
+
+		FrameGraph::ResourceId ImportBuffer(std::size_t byteLength)
+		{
+			return _graph->Import(std::make_shared<ResidentBuffer>(Core::Buffer::Settings { byteLength }));
+		}
+	};
+
+	TEST_F(FrameGraphTests, CullsUnusedPasses)
+	{
+		const auto output = ImportBuffer(64);
+		const auto unused = _graph->CreateTransient(64);
+		const auto intermediate = _graph->CreateTransient(64);
+
+		const auto p0 = _graph->AddPass("unused", { { unused, Stage::kComputeShader, Access::kShaderWrite } }, BaseTask::kEmpty, false);
+		const auto p1 = _graph->AddPass("produce", { { intermediate, Stage::kComputeShader, Access::kShaderWrite } }, BaseTask::kEmpty, false);
+		const auto p2 = _graph->AddPass("consume", {
+			{ intermediate, Stage::kComputeShader, Access::kShaderRead },
+			{ output, Stage::kComputeShader, Access::kShaderWrite }
+		}, BaseTask::kEmpty, false);
+		const auto p3 = _graph->AddPass("debug", {}, BaseTask::kEmpty);
+
+		_graph->Compile();
+
+		ASSERT_TRUE(_graph->IsPassCulled(p0));
+		ASSERT_FALSE(_graph->IsPassCulled(p1));
+		ASSERT_FALSE(_graph->IsPassCulled(p2));
+		ASSERT_FALSE(_graph->IsPassCulled(p3));
+		ASSERT_EQ(_graph->GetCompiledPasses().size(), 3);
+		ASSERT_EQ(_graph->GetTransientArenaByteLength(), 64);
+	}
+
+	TEST_F(FrameGraphTests, KeepsPassesWithUntrackedOutputsByDefault)
+	{
+		const auto input = ImportBuffer(64);
+		const auto scratch = _graph->CreateTransient(64);
+
+		const auto p0 = _graph->AddPass("draw", { { input, Stage::kVertexInput, Access::kVertexRead } }, BaseTask::kEmpty);
+		const auto p1 = _graph->AddPass("scratch", { { scratch, Stage::kComputeShader, Access::kShaderWrite } }, BaseTask::kEmpty);
+
+		_graph->Compile();
+
+		ASSERT_FALSE(_graph->IsPassCulled(p0));
+		ASSERT_FALSE(_graph->IsPassCulled(p1));
+		ASSERT_EQ(_graph->GetCompiledPasses().size(), 2);
+	}
+
+	TEST_F(FrameGraphTests, ResetAllowsRecompile)
+	{
+		_graph->AddPass("write", { { _graph->CreateTransient(128), Stage::kComputeShader, Access::kShaderWrite } }, BaseTask::kEmpty);
+		_graph->Compile();
+		ASSERT_EQ(_graph->GetTransientArenaByteLength(), 128);
+
+		_graph->Reset();
+		ASSERT_FALSE(_graph->IsCompiled());
+		ASSERT_EQ(_graph->GetResourcesCount(), 0);
+
+		_graph->AddPass("write", { { _graph->CreateTransient(64), Stage::kComputeShader, Access::kShaderWrite } }, BaseTask::kEmpty);
+		_graph->Compile();
+		ASSERT_EQ(_graph->GetCompiledPasses().size(), 1);
+		ASSERT_EQ(_graph->GetTransientArenaByteLength(), 64);
+	}
+
+	TEST_F(FrameGraphTests, ElidesReadAfterRead)
+	{
+		const auto buffer = ImportBuffer(64);
+
+		_graph->AddPass("write", { { buffer, Stage::kComputeShader, Access::kShaderWrite } }, BaseTask::kEmpty);
+		_graph->AddPass("read0", { { buffer, Stage::kVertexShader, Access::kShaderRead } }, BaseTask::kEmpty, true);
+		_graph->AddPass("read1", { { buffer, Stage::kVertexShader, Access::kShaderRead } }, BaseTask::kEmpty, true);
+		_graph->AddPass("read2", { { buffer, Stage::kFragmentShader, Access::kShaderRead } }, BaseTask::kEmpty, true);
+
+		_graph->Compile();
+
+		const auto& passes = _graph->GetCompiledPasses();
+		ASSERT_EQ(passes.size(), 4);
+
+		ASSERT_EQ(passes[0].barriers.size(), 1);
+		ASSERT_EQ(passes[0].barriers[0].srcStage, Stage::kTransfer);
+		ASSERT_EQ(passes[0].barriers[0].srcAccess, Access::kTransferWrite);
+		ASSERT_EQ(passes[0].barriers[0].dstStage, Stage::kComputeShader);
+
+		ASSERT_EQ(passes[1].barriers.size(), 1);
+		ASSERT_EQ(passes[1].barriers[0].srcStage, Stage::kComputeShader);
+		ASSERT_EQ(passes[1].barriers[0].srcAccess, Access::kShaderWrite);
+		ASSERT_EQ(passes[1].barriers[0].dstStage, Stage::kVertexShader);
+		ASSERT_EQ(passes[1].barriers[0].dstAccess, Access::kShaderRead);
+
+		ASSERT_TRUE(passes[2].barriers.empty());
+
+		ASSERT_EQ(passes[3].barriers.size(), 1);
+		ASSERT_EQ(passes[3].barriers[0].dstStage, Stage::kFragmentShader);
+	}
+
+	TEST_F(FrameGraphTests, WriteAfterReadWaitsForReaders)
+	{
+		const auto buffer = ImportBuffer(64);
+
+		_graph->AddPass("read", { { buffer, Stage::kVertexInput, Access::kVertexRead } }, BaseTask::kEmpty, true);
+		_graph->AddPass("write", { { buffer, Stage::kTransfer, Access::kTransferWrite } }, BaseTask::kEmpty);
+
+		_graph->Compile();
+
+		const auto& passes = _graph->GetCompiledPasses();
+		ASSERT_EQ(passes[1].barriers.size(), 1);
+		ASSERT_EQ(passes[1].barriers[0].srcStage, Stage::kTransfer | Stage::kVertexInput);
+		ASSERT_EQ(passes[1].barriers[0].dstStage, Stage::kTransfer);
+		ASSERT_EQ(passes[1].barriers[0].dstAccess, Access::kTransferWrite);
+	}
+
+	TEST_F(FrameGraphTests, MergesBarriersPerPass)
+	{
+		const auto a = ImportBuffer(64);
+		const auto b = ImportBuffer(64);
+		const auto c = ImportBuffer(64);
+
+		_graph->AddPass("draw", {
+			{ a, Stage::kVertexInput, Access::kVertexRead },
+			{ b, Stage::kVertexInput, Access::kIndexRead },
+			{ c, Stage::kVertexShader, Access::kUniformRead },
+			{ c, Stage::kFragmentShader, Access::kUniformRead }
+		}, BaseTask::kEmpty, true);
+
+		_graph->Compile();
+
+		const auto& passes = _graph->GetCompiledPasses();
+		ASSERT_EQ(passes.size(), 1);
+		ASSERT_EQ(passes[0].barriers.size(), 3);
+		ASSERT_EQ(passes[0].barriers[2].resource, c);
+		ASSERT_EQ(passes[0].barriers[2].dstStage, Stage::kVertexShader | Stage::kFragmentShader);
+	}
+
+	TEST_F(FrameGraphTests, AliasesTransients)
+	{
+		const auto output = ImportBuffer(64);
+		const auto t0 = _graph->CreateTransient(256);
+		const auto t1 = _graph->CreateTransient(256);
+		const auto t2 = _graph->CreateTransient(128);
+
+		_graph->AddPass("p0", { { t0, Stage::kComputeShader, Access::kShaderWrite } }, BaseTask::kEmpty);
+		_graph->AddPass("p1", {
+			{ t0, Stage::kComputeShader, Access::kShaderRead },
+			{ t1, Stage::kComputeShader, Access::kShaderWrite }
+		}, BaseTask::kEmpty);
+		_graph->AddPass("p2", {
+			{ t1, Stage::kComputeShader, Access::kShaderRead },
+			{ t2, Stage::kComputeShader, Access::kShaderWrite }
+		}, BaseTask::kEmpty);
+		_graph->AddPass("p3", {
+			{ t2, Stage::kComputeShader, Access::kShaderRead },
+			{ output, Stage::kComputeShader, Access::kShaderWrite }
+		}, BaseTask::kEmpty);
+
+		_graph->Compile();
+
+		const auto& p0 = _graph->GetTransientPlacement(t0);
+		const auto& p1 = _graph->GetTransientPlacement(t1);
+		const auto& p2 = _graph->GetTransientPlacement(t2);
+
+		ASSERT_EQ(p0.byteOffset, 0);
+		ASSERT_EQ(p1.byteOffset, 256);
+		ASSERT_EQ(p2.byteOffset, 0);
+		ASSERT_EQ(_graph->GetTransientArenaByteLength(), 512);
+
+		const auto& passes = _graph->GetCompiledPasses();
+		ASSERT_EQ(passes.size(), 4);
+		ASSERT_TRUE(passes[0].barriers.empty());
+
+		const auto aliasBarrier = std::find_if(passes[2].barriers.cbegin(), passes[2].barriers.cend(), [t2](const auto& b)
+		{
+			return b.resource == t2;
+		});
+
+		ASSERT_NE(aliasBarrier, passes[2].barriers.cend());
+		ASSERT_EQ(aliasBarrier->srcStage, Stage::kComputeShader);
+		ASSERT_EQ(aliasBarrier->srcAccess, Access::kShaderWrite);
+	}
+
+	TEST_F(FrameGraphTests, TracksPassUsagesForLaterJobs)
+	{
+		const auto buffer = ImportBuffer(64);
+		const auto other = ImportBuffer(64);
+
+		_graph->AddPass("write", { { buffer, Stage::kComputeShader, Access::kShaderWrite } }, BaseTask::kEmpty, true);
+		_graph->AddPass("read", { { other, Stage::kVertexShader, Access::kShaderRead } }, BaseTask::kEmpty, true);
+
+		_graph->Compile();
+
+		AccessTracker bufferTracker { Access::kWriteMask };
+		AccessTracker otherTracker { Access::kWriteMask };
+		otherTracker.Reset(Stage::kTransfer, Access::kTransferWrite);
+
+		for (const auto& pass : _graph->GetCompiledPasses())
+		{
+			for (const auto& usage : pass.usages)
+			{
+				(usage.resource == buffer ? bufferTracker : otherTracker).Track(usage.stage, usage.access);
+			}
+		}
+
+		const auto jobRead = bufferTracker.Track(Stage::kVertexShader, Access::kShaderRead);
+		ASSERT_TRUE(jobRead.has_value());
+		ASSERT_EQ(jobRead->srcStage, Stage::kComputeShader);
+		ASSERT_EQ(jobRead->srcAccess, Access::kShaderWrite);
+		ASSERT_FALSE(bufferTracker.Track(Stage::kVertexShader, Access::kShaderRead).has_value());
+
+		const auto jobWrite = otherTracker.Track(Stage::kTransfer, Access::kTransferWrite);
+		ASSERT_TRUE(jobWrite.has_value());
+		ASSERT_EQ(jobWrite->srcStage, Stage::kTransfer | Stage::kVertexShader);
+	}
+}
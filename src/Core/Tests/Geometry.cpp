@@ -0,0 +1,48 @@
+#include <cstring>
+#include <gtest/gtest.h>
+#include <Core/Geometry.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class GeometryTests : public testing::Test
+	{
+	};
+
+	TEST_F(GeometryTests, InterleavesVertexStreams)
+	{
+		VertexBufferPrototypeFloat3 positions { VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::Position }, {} } };
+		VertexBufferPrototypeFloat2 uvs { VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::UV }, {} } };
+		VertexBufferPrototypeUnorm8x4 colors { VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::Color }, {} } };
+
+		for (std::uint8_t i = 0; i < 8; ++i)
+		{
+			const auto f = static_cast<std::float_t>(i);
+			positions.data.push_back({ f, f + 0.5f, -f });
+			uvs.data.push_back({ f * 0.1f, 1.0f - f * 0.1f });
+			colors.data.push_back({ i, static_cast<std::uint8_t>(i * 2), static_cast<std::uint8_t>(i * 3), 255 });
+		}
+
+		const InterleavedVertexBufferPrototype interleaved { { &positions, &uvs, &colors }, {} };
+		const auto& elements = interleaved.GetElements();
+
+		ASSERT_EQ(interleaved.GetStride(), sizeof(Vector3Float) + sizeof(Vector2Float) + sizeof(Vector4Unorm8));
+		ASSERT_EQ(interleaved.GetElementsCount(), positions.data.size());
+		ASSERT_EQ(interleaved.GetByteLength(), interleaved.GetStride() * positions.data.size());
+		ASSERT_EQ(elements.size(), 3);
+		ASSERT_EQ(elements[0].offset, 0);
+		ASSERT_EQ(elements[1].offset, sizeof(Vector3Float));
+		ASSERT_EQ(elements[2].offset, sizeof(Vector3Float) + sizeof(Vector2Float));
+		ASSERT_EQ(elements[1].settings.vb.semantics, VertexBufferPrototype::Semantics::UV);
+		ASSERT_EQ(elements[2].format, VertexBufferPrototype::Format::Unorm8x4);
+
+		const auto bytes = static_cast<const std::uint8_t*>(interleaved.GetDataPtr());
+
+		for (std::size_t v = 0; v < positions.data.size(); ++v)
+		{
+			const auto vertex = bytes + v * interleaved.GetStride();
+			ASSERT_EQ(std::memcmp(vertex + elements[0].offset, &positions.data[v], sizeof(Vector3Float)), 0);
+			ASSERT_EQ(std::memcmp(vertex + elements[1].offset, &uvs.data[v], sizeof(Vector2Float)), 0);
+			ASSERT_EQ(std::memcmp(vertex + elements[2].offset, &colors.data[v], sizeof(Vector4Unorm8)), 0);
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <Core/GeometryArena.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class GeometryArena final : public Core::GeometryArena
+	{
+	private:
+		template<typename TBuffer>
+		class Buffer final : public TBuffer
+		{
+		public:
+			Buffer(const InputAssemblerBuffer::Settings& settings) : TBuffer(settings)
+			{
+			}
+			std::shared_ptr<BaseTask> CreateCopyToBufferTask(const std::shared_ptr<Core::Buffer>&, std::size_t, std::size_t, std::size_t) const override
+			{
+				return BaseTask::kEmpty;
+			}
+		};
+
+		class UploadBuffer final : public Core::UploadBuffer
+		{
+		public:
+			UploadBuffer(const Settings& settings) : Core::UploadBuffer(settings)
+			{
+			}
+			std::shared_ptr<BaseTask> CreateCopyToBufferTask(const std::shared_ptr<Core::Buffer>&, std::size_t, std::size_t, std::size_t) const override
+			{
+				return BaseTask::kEmpty;
+			}
+			std::shared_ptr<ContextualTask<WriteTaskContext>> CreateWriteTask(const void*, std::size_t, std::size_t) override
+			{
+				return nullptr;
+			}
+		};
+	public:
+		GeometryArena(const Settings& settings) : Core::GeometryArena(settings)
+		{
+		}
+	protected:
+		std::shared_ptr<VertexBuffer> CreateVertexBlockBuffer(std::size_t byteLength) override
+		{
+			return std::make_shared<Buffer<VertexBuffer>>(InputAssemblerBuffer::Settings { { nullptr }, { byteLength } });
+		}
+		std::shared_ptr<IndexBuffer> CreateIndexBlockBuffer(std::size_t byteLength) override
+		{
+			return std::make_shared<Buffer<IndexBuffer>>(InputAssemblerBuffer::Settings { { nullptr }, { byteLength } });
+		}
+		std::shared_ptr<Core::UploadBuffer> CreateUploadBuffer(std::size_t byteLength) override
+		{
+			return std::make_shared<UploadBuffer>(Core::Buffer::Settings { byteLength });
+		}
+	};
+
+	class GeometryArenaTests : public testing::Test
+	{
+	protected:
+		std::shared_ptr<GeometryArena> _arena;
+
+		inline void SetUp() override
+		{
+			_arena = std::make_shared<GeometryArena>(GeometryArena::Settings { 1200, 256 });
+		}
+	};
+
+	TEST_F(GeometryArenaTests, SuballocatesSharedBuffers)
+	{
+		const auto first = _arena->AllocateVertices(12, 40);
+		const auto second = _arena->AllocateVertices(12, 30);
+		const auto other = _arena->AllocateVertices(20, 10);
+
+		ASSERT_EQ(first.handle.GetBuffer(), second.handle.GetBuffer());
+		ASSERT_NE(first.handle.GetBuffer(), other.handle.GetBuffer());
+		ASSERT_EQ(first.handle.GetSize(), 40 * 12);
+		ASSERT_EQ(second.handle.GetOffset() % 12, 0);
+		ASSERT_EQ(second.GetFirstElement() * 12, second.handle.GetOffset());
+		ASSERT_TRUE(second.GetFirstElement() >= 40 || second.GetFirstElement() + 30 <= first.GetFirstElement());
+
+		const auto indices16 = _arena->AllocateIndices(IndexBufferPrototype::Format::Uint16, 3);
+		const auto indices32 = _arena->AllocateIndices(IndexBufferPrototype::Format::Uint32, 6);
+		const auto moreIndices16 = _arena->AllocateIndices(IndexBufferPrototype::Format::Uint16, 9);
+
+		ASSERT_EQ(indices16.handle.GetBuffer(), moreIndices16.handle.GetBuffer());
+		ASSERT_NE(indices16.handle.GetBuffer(), indices32.handle.GetBuffer());
+		ASSERT_EQ(moreIndices16.handle.GetOffset() % sizeof(std::uint16_t), 0);
+		ASSERT_EQ(indices32.handle.GetSize(), 6 * sizeof(std::uint32_t));
+		ASSERT_NE(indices16.GetFirstElement(), moreIndices16.GetFirstElement());
+	}
+
+	TEST_F(GeometryArenaTests, ReusesReleasedRangesAndGrows)
+	{
+		std::size_t releasedOffset = 0;
+
+		{
+			const auto allocation = _arena->AllocateVertices(12, 50);
+			releasedOffset = allocation.handle.GetOffset();
+		}
+
+		const auto reused = _arena->AllocateVertices(12, 50);
+		ASSERT_EQ(reused.handle.GetOffset(), releasedOffset);
+
+		const auto remaining = _arena->AllocateVertices(12, 50);
+		ASSERT_EQ(remaining.handle.GetBuffer(), reused.handle.GetBuffer());
+
+		const auto overflow = _arena->AllocateVertices(12, 10);
+		ASSERT_NE(overflow.handle.GetBuffer(), reused.handle.GetBuffer());
+		ASSERT_EQ(overflow.GetFirstElement(), 0);
+
+		const auto large = _arena->AllocateVertices(12, 500);
+		ASSERT_EQ(large.handle.GetSize(), 500 * 12);
+		ASSERT_EQ(large.handle.GetBuffer()->GetSettings().byteLength, 500 * 12);
+	}
+}
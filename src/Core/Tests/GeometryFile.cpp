@@ -0,0 +1,182 @@
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Core/GeometryFile.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class GeometryFileTests : public testing::Test
+	{
+	protected:
+		std::filesystem::path _path;
+
+		inline void SetUp() override
+		{
+			testing::Test::SetUp();
+			_path = std::filesystem::temp_directory_path() / "mmpengine.geometry_file_tests.mmpg";
+		}
+
+		inline void TearDown() override
+		{
+			std::filesystem::remove(_path);
+			testing::Test::TearDown();
+		}
+
+		static GeometryPrototype CreatePrototype()
+		{
+			GeometryPrototype proto;
+
+			auto positions = std::make_unique<VertexBufferPrototypeFloat3>(VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::Position }, {} });
+			auto uvs = std::make_unique<VertexBufferPrototypeFloat2>(VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::UV }, {} });
+			auto indices = std::make_unique<IndexBufferPrototype16>(IndexBufferPrototype::Settings {});
+
+			positions->data = { { -1.0f, 0.0f, 2.0f }, { 3.0f, -4.0f, 0.5f }, { 0.0f, 5.0f, -6.0f } };
+			uvs->data = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 0.0f, 1.0f } };
+			indices->data = { 0, 1, 2, 2, 1, 0 };
+
+			proto.vertexBuffers.push_back(std::move(positions));
+			proto.vertexBuffers.push_back(std::move(uvs));
+			proto.indexBuffer = std::move(indices);
+			proto.subsets = { { 3, 0, 0 }, { 3, 3, 0 } };
+
+			return proto;
+		}
+
+		template<typename TFunc>
+		void Patch(TFunc&& func) const
+		{
+			std::vector<char> bytes;
+
+			{
+				std::ifstream file { _path, std::ios::in | std::ios::binary };
+				bytes.assign(std::istreambuf_iterator<char> { file }, std::istreambuf_iterator<char> {});
+			}
+
+			GeometryFile::Header header {};
+			GeometryFile::VertexStreamDesc desc {};
+			std::memcpy(&header, bytes.data(), sizeof(header));
+			std::memcpy(&desc, bytes.data() + sizeof(header), sizeof(desc));
+
+			func(header, desc);
+
+			std::memcpy(bytes.data(), &header, sizeof(header));
+			std::memcpy(bytes.data() + sizeof(header), &desc, sizeof(desc));
+
+			std::ofstream file { _path, std::ios::out | std::ios::binary | std::ios::trunc };
+			file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+		}
+	};
+
+	TEST_F(GeometryFileTests, RoundTrip)
+	{
+		const auto source = CreatePrototype();
+		GeometryFile::Write(source, _path);
+
+		const GeometryFile file { _path };
+		const auto& header = file.GetHeader();
+
+		ASSERT_EQ(header.vertexStreamCount, 2);
+		ASSERT_EQ(header.subsetCount, 2);
+		ASSERT_EQ(header.vertexCount, 3);
+		ASSERT_EQ(header.indexCount, 6);
+		ASSERT_EQ(header.indexFormat, IndexBufferPrototype::Format::Uint16);
+		ASSERT_EQ(header.bounds.min, (Vector3Float { -1.0f, -4.0f, -6.0f }));
+		ASSERT_EQ(header.bounds.max, (Vector3Float { 3.0f, 5.0f, 2.0f }));
+
+		for (std::size_t i = 0; i < header.vertexStreamCount; ++i)
+		{
+			ASSERT_EQ(reinterpret_cast<std::uintptr_t>(file.GetVertexStreamData(i)) % GeometryFile::kDataAlignment, 0);
+			ASSERT_EQ(file.GetVertexStreamByteLength(i), source.vertexBuffers[i]->GetByteLength());
+			ASSERT_EQ(std::memcmp(file.GetVertexStreamData(i), source.vertexBuffers[i]->GetDataPtr(), file.GetVertexStreamByteLength(i)), 0);
+		}
+
+		const auto loaded = file.CreatePrototype();
+
+		ASSERT_EQ(loaded.vertexBuffers.size(), source.vertexBuffers.size());
+		ASSERT_EQ(loaded.vertexBuffers[1]->GetVBSettings().semantics, VertexBufferPrototype::Semantics::UV);
+		ASSERT_EQ(loaded.vertexBuffers[1]->GetFormat(), VertexBufferPrototype::Format::Float2);
+		ASSERT_EQ(loaded.indexBuffer->GetByteLength(), source.indexBuffer->GetByteLength());
+		ASSERT_EQ(std::memcmp(loaded.indexBuffer->GetDataPtr(), source.indexBuffer->GetDataPtr(), loaded.indexBuffer->GetByteLength()), 0);
+		ASSERT_EQ(loaded.subsets.size(), 2);
+		ASSERT_EQ(loaded.subsets[1].indexStart, 3);
+	}
+
+	TEST_F(GeometryFileTests, RejectsCorruptedFile)
+	{
+		GeometryFile::Write(CreatePrototype(), _path);
+		std::filesystem::resize_file(_path, std::filesystem::file_size(_path) - 4);
+
+		ASSERT_THROW(GeometryFile { _path }, std::runtime_error);
+	}
+
+	TEST_F(GeometryFileTests, RoundTripWithoutIndexBuffer)
+	{
+		auto source = CreatePrototype();
+		source.indexBuffer.reset();
+		source.subsets.clear();
+		GeometryFile::Write(source, _path);
+
+		const GeometryFile file { _path };
+		ASSERT_EQ(file.GetHeader().indexCount, 0);
+		ASSERT_EQ(file.GetIndexByteLength(), 0);
+
+		const auto loaded = file.CreatePrototype();
+		ASSERT_EQ(loaded.vertexBuffers.size(), source.vertexBuffers.size());
+		ASSERT_EQ(loaded.indexBuffer, nullptr);
+	}
+
+	TEST_F(GeometryFileTests, RejectsTruncatedHeader)
+	{
+		GeometryFile::Write(CreatePrototype(), _path);
+		std::filesystem::resize_file(_path, sizeof(GeometryFile::Header) - 1);
+
+		ASSERT_THROW(GeometryFile { _path }, std::runtime_error);
+	}
+
+	TEST_F(GeometryFileTests, RejectsStrideMismatch)
+	{
+		GeometryFile::Write(CreatePrototype(), _path);
+		Patch([](auto&, auto& desc)
+		{
+			desc.stride = sizeof(std::float_t);
+		});
+
+		ASSERT_THROW(GeometryFile { _path }, std::runtime_error);
+	}
+
+	TEST_F(GeometryFileTests, RejectsUnknownVertexFormat)
+	{
+		GeometryFile::Write(CreatePrototype(), _path);
+		Patch([](auto&, auto& desc)
+		{
+			desc.format = static_cast<VertexBufferPrototype::Format>(0xFF);
+		});
+
+		ASSERT_THROW(GeometryFile { _path }, std::runtime_error);
+	}
+
+	TEST_F(GeometryFileTests, RejectsUnknownIndexFormat)
+	{
+		GeometryFile::Write(CreatePrototype(), _path);
+		Patch([](auto& header, auto&)
+		{
+			header.indexFormat = static_cast<IndexBufferPrototype::Format>(0xFF);
+		});
+
+		ASSERT_THROW(GeometryFile { _path }, std::runtime_error);
+	}
+
+	TEST_F(GeometryFileTests, RejectsOverflowingElementCount)
+	{
+		GeometryFile::Write(CreatePrototype(), _path);
+		Patch([](auto&, auto& desc)
+		{
+			desc.elementCount = std::numeric_limits<std::uint64_t>::max() / desc.stride + 2;
+		});
+
+		ASSERT_THROW(GeometryFile { _path }, std::runtime_error);
+	}
+}
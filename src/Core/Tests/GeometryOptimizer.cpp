@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <array>
+#include <random>
+#include <gtest/gtest.h>
+#include <Core/GeometryOptimizer.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class GeometryOptimizerTests : public testing::Test
+	{
+	protected:
+		using Triangle = std::array<std::array<std::float_t, 3>, 3>;
+
+		static GeometryPrototype CreateShuffledUnweldedGrid(std::uint32_t size)
+		{
+			std::vector<std::array<Vector3Float, 3>> triangles {};
+
+			for (std::uint32_t y = 0; y < size; ++y)
+			{
+				for (std::uint32_t x = 0; x < size; ++x)
+				{
+					const auto fx = static_cast<std::float_t>(x);
+					const auto fy = static_cast<std::float_t>(y);
+					triangles.push_back({ Vector3Float { fx, fy, 0.0f }, Vector3Float { fx, fy + 1.0f, 0.0f }, Vector3Float { fx + 1.0f, fy, 0.0f } });
+					triangles.push_back({ Vector3Float { fx + 1.0f, fy, 0.0f }, Vector3Float { fx, fy + 1.0f, 0.0f }, Vector3Float { fx + 1.0f, fy + 1.0f, 0.0f } });
+				}
+			}
+
+			std::mt19937 random { 42 };
+			std::shuffle(triangles.begin(), triangles.end(), random);
+
+			GeometryPrototype proto;
+			auto positions = std::make_unique<VertexBufferPrototypeFloat3>(VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::Position }, {} });
+			auto indices = std::make_unique<IndexBufferPrototype32>(IndexBufferPrototype::Settings {});
+
+			for (const auto& t : triangles)
+			{
+				for (const auto& p : t)
+				{
+					indices->data.push_back(static_cast<std::uint32_t>(positions->data.size()));
+					positions->data.push_back(p);
+				}
+			}
+
+			proto.vertexBuffers.push_back(std::move(positions));
+			proto.indexBuffer = std::move(indices);
+			proto.subsets = { { static_cast<std::uint32_t>(proto.indexBuffer->GetElementsCount()), 0, 0 } };
+			return proto;
+		}
+
+		static std::vector<Triangle> CollectTriangles(const GeometryPrototype& proto)
+		{
+			const auto positions = static_cast<const Vector3Float*>(proto.vertexBuffers.front()->GetDataPtr());
+			const auto& indices = dynamic_cast<const IndexBufferPrototype32&>(*proto.indexBuffer).data;
+			std::vector<Triangle> triangles {};
+
+			for (const auto& subset : proto.subsets)
+			{
+				for (auto i = subset.indexStart; i < subset.indexStart + subset.indexCount; i += 3)
+				{
+					Triangle t {};
+
+					for (std::size_t k = 0; k < 3; ++k)
+					{
+						const auto& p = positions[subset.baseVertex + indices[i + k]];
+						t[k] = { p.x, p.y, p.z };
+					}
+
+					std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+					triangles.push_back(t);
+				}
+			}
+
+			std::sort(triangles.begin(), triangles.end());
+			return triangles;
+		}
+	};
+
+	TEST_F(GeometryOptimizerTests, CountsCacheMisses)
+	{
+		const std::vector<std::uint32_t> indices { 0, 1, 2, 2, 1, 3, 4, 5, 0 };
+		ASSERT_EQ(GeometryOptimizer::CountCacheMisses(indices.data(), indices.size(), 16), 6);
+		ASSERT_EQ(GeometryOptimizer::CountCacheMisses(indices.data(), indices.size(), 4), 7);
+	}
+
+	TEST_F(GeometryOptimizerTests, WeldsAndImprovesCacheLocality)
+	{
+		constexpr std::uint32_t size = 32;
+		auto proto = CreateShuffledUnweldedGrid(size);
+		const auto trianglesBefore = CollectTriangles(proto);
+
+		const auto statistics = GeometryOptimizer::Optimize(proto, GeometryOptimizer::Settings {});
+
+		ASSERT_EQ(statistics.vertexCountBefore, size * size * 6);
+		ASSERT_EQ(statistics.vertexCountAfter, (size + 1) * (size + 1));
+		ASSERT_EQ(proto.vertexBuffers.front()->GetElementsCount(), statistics.vertexCountAfter);
+		ASSERT_LT(statistics.acmrAfter, 0.8f);
+		ASSERT_LT(statistics.acmrAfter, statistics.acmrBefore);
+		ASSERT_LT(statistics.atvrAfter, 1.5f);
+		ASSERT_EQ(CollectTriangles(proto), trianglesBefore);
+	}
+}
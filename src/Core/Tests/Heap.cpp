@@ -1,21 +1,43 @@
 #include <gtest/gtest.h>
 #include <Core/Heap.hpp>
+#include <array>
+#include <future>
+#include <random>
+#include <thread>
 
 namespace MMPEngine::Core::Tests
 {
+	class HeapGlobalContext final : public Core::GlobalContext
+	{
+	public:
+		HeapGlobalContext() : Core::GlobalContext(Settings { false, BackendType::Vulkan }, Environment {}, std::make_unique<DefaultMath>())
+		{
+		}
+	};
+
+	class HeapStream final : public BaseStream
+	{
+	public:
+		HeapStream() : BaseStream(std::make_shared<HeapGlobalContext>(), std::make_shared<StreamContext>())
+		{
+		}
+	};
+
 	class Heap final : public Core::Heap
 	{
 	public:
 		class Block final: public Core::Heap::Block
 		{
 		public:
-			Block(std::size_t size) : Core::Heap::Block(size)
+			Block(std::size_t size) : Core::Heap::Block(size), owners(size)
 			{
 			}
 			std::shared_ptr<Core::BaseEntity> GetEntity() const override
 			{
 				return nullptr;
 			}
+
+			std::vector<std::atomic<std::uint32_t>> owners;
 		};
 		class Handle final : public Core::Heap::Handle
 		{
@@ -49,6 +71,24 @@ namespace MMPEngine::Core::Tests
 		{
 			return std::make_unique<Block>(size);
 		}
+
+		std::shared_ptr<BaseTask> CreateRelocationTask(const std::vector<Relocation>& relocations) override
+		{
+			relocationsCount += relocations.size();
+			return BaseTask::kEmpty;
+		}
+
+		Block* GetTestBlock(std::size_t blockIndex) const
+		{
+			return static_cast<Block*>(GetBlock(blockIndex));
+		}
+
+		bool HasBlock(std::size_t blockIndex) const
+		{
+			return blockIndex < _blocks.size() && _blocks.at(blockIndex);
+		}
+
+		std::size_t relocationsCount = 0;
 	};
 
 	class HeapTests : public testing::Test
@@ -62,6 +102,14 @@ namespace MMPEngine::Core::Tests
 			_heap = std::make_shared<Heap>(Core::Heap::Settings{1024, 2});
 		}
 
+		inline void Defragment(std::size_t frameByteBudget)
+		{
+			const auto stream = std::make_shared<HeapStream>();
+			stream->Restart();
+			stream->Schedule(_heap->CreateDefragmentationTask({ frameByteBudget, 0.5f }));
+			stream->SubmitAndWait();
+		}
+
 		inline void TearDown() override
 		{
 			_heap.reset();
@@ -202,4 +250,266 @@ namespace MMPEngine::Core::Tests
 		ASSERT_EQ(h3->GetLength(), 5);
 		ASSERT_EQ(h3->GetOffset(), 16);
 	}
-}
\ No newline at end of file
+
+	TEST_F(HeapTests, DefragmentationReleasesSparseBlock)
+	{
+		auto h1 = std::make_unique<Heap::Handle>(_heap->Allocate({ 600 }));
+		const auto h2 = std::make_unique<Heap::Handle>(_heap->Allocate({ 600 }));
+		const auto h3 = std::make_unique<Heap::Handle>(_heap->Allocate({ 300, 64 }));
+		const auto h4 = std::make_unique<Heap::Handle>(_heap->Allocate({ 200 }));
+
+		ASSERT_EQ(h3->GetBlockIndex(), 0);
+		ASSERT_EQ(h3->GetOffset(), 640);
+		ASSERT_EQ(h4->GetBlockIndex(), 1);
+
+		h1.reset();
+
+		std::size_t relocatedCount = 0;
+		h3->EnableRelocation([&relocatedCount]() { ++relocatedCount; });
+
+		Defragment(4096);
+
+		ASSERT_EQ(_heap->relocationsCount, 1);
+		ASSERT_EQ(relocatedCount, 1);
+		ASSERT_EQ(h3->GetBlockIndex(), 1);
+		ASSERT_EQ(h3->GetLength(), 300);
+		ASSERT_EQ(h3->GetOffset() % 64, 0);
+		ASSERT_FALSE(_heap->HasBlock(0));
+
+		Defragment(4096);
+		ASSERT_EQ(_heap->relocationsCount, 1);
+	}
+
+	TEST_F(HeapTests, DefragmentationRespectsFrameBudget)
+	{
+		auto h1 = std::make_unique<Heap::Handle>(_heap->Allocate({ 600 }));
+		const auto h2 = std::make_unique<Heap::Handle>(_heap->Allocate({ 600 }));
+		const auto h3 = std::make_unique<Heap::Handle>(_heap->Allocate({ 200 }));
+		const auto h4 = std::make_unique<Heap::Handle>(_heap->Allocate({ 150 }));
+
+		ASSERT_EQ(h3->GetBlockIndex(), 0);
+		ASSERT_EQ(h4->GetBlockIndex(), 0);
+
+		h1.reset();
+		h3->EnableRelocation([]() {});
+		h4->EnableRelocation([]() {});
+
+		Defragment(200);
+
+		ASSERT_EQ(h3->GetBlockIndex(), 1);
+		ASSERT_EQ(h4->GetBlockIndex(), 0);
+		ASSERT_TRUE(_heap->HasBlock(0));
+
+		Defragment(200);
+
+		ASSERT_EQ(h4->GetBlockIndex(), 1);
+		ASSERT_FALSE(_heap->HasBlock(0));
+	}
+
+	TEST_F(HeapTests, RelocatableHandleSurvivesMove)
+	{
+		auto h1 = std::make_unique<Heap::Handle>(_heap->Allocate({ 600 }));
+		const auto h2 = std::make_unique<Heap::Handle>(_heap->Allocate({ 600 }));
+		auto h3 = std::make_unique<Heap::Handle>(_heap->Allocate({ 100 }));
+
+		h1.reset();
+		h3->EnableRelocation([]() {});
+
+		const auto moved = std::make_unique<Heap::Handle>(std::move(*h3));
+		h3.reset();
+
+		Defragment(4096);
+
+		ASSERT_EQ(moved->GetBlockIndex(), 1);
+		ASSERT_EQ(moved->GetLength(), 100);
+		ASSERT_FALSE(_heap->HasBlock(0));
+	}
+
+	TEST_F(HeapTests, DefragmentationIgnoresThreadCachedEntries)
+	{
+		_heap = std::make_shared<Heap>(Core::Heap::Settings { 1024, 2, false, true });
+
+		auto h1 = std::make_unique<Heap::Handle>(_heap->Allocate({ 600 }));
+		const auto h2 = std::make_unique<Heap::Handle>(_heap->Allocate({ 600 }));
+		const auto h3 = std::make_unique<Heap::Handle>(_heap->Allocate({ 200 }));
+
+		ASSERT_EQ(h3->GetBlockIndex(), 0);
+
+		std::promise<void> cached;
+		std::promise<void> defragmented;
+
+		std::thread worker([this, &cached, &defragmented]() {
+			{
+				const auto h4 = std::make_unique<Heap::Handle>(_heap->Allocate({ 100 }));
+				EXPECT_EQ(h4->GetBlockIndex(), 0);
+			}
+
+			cached.set_value();
+			defragmented.get_future().wait();
+		});
+
+		cached.get_future().wait();
+		h1.reset();
+		h3->EnableRelocation([]() {});
+
+		Defragment(4096);
+
+		ASSERT_EQ(_heap->relocationsCount, 1);
+		ASSERT_EQ(h3->GetBlockIndex(), 1);
+		ASSERT_TRUE(_heap->HasBlock(0));
+
+		defragmented.set_value();
+		worker.join();
+
+		ASSERT_FALSE(_heap->HasBlock(0));
+	}
+
+	TEST_F(HeapTests, Statistics)
+	{
+		auto statistics = _heap->GetStatistics();
+		ASSERT_EQ(statistics.blocksCount, 0);
+		ASSERT_EQ(statistics.reservedBytes, 0);
+
+		auto h1 = std::make_unique<Heap::Handle>(_heap->Allocate({ 100 }));
+		const auto h2 = std::make_unique<Heap::Handle>(_heap->Allocate({ 200 }));
+		const auto h3 = std::make_unique<Heap::Handle>(_heap->Allocate({ 2000 }));
+
+		statistics = _heap->GetStatistics();
+		ASSERT_EQ(statistics.blocksCount, 2);
+		ASSERT_EQ(statistics.reservedBytes, 1024 + 2048);
+		ASSERT_EQ(statistics.allocatedBytes, 2300);
+		ASSERT_EQ(statistics.allocationsCount, 3);
+		ASSERT_EQ(statistics.largestFreeRange, 724);
+		ASSERT_FLOAT_EQ(statistics.fragmentation, 1.0f - 724.0f / 772.0f);
+
+		h1.reset();
+
+		statistics = _heap->GetStatistics();
+		ASSERT_EQ(statistics.allocatedBytes, 2200);
+		ASSERT_EQ(statistics.allocationsCount, 2);
+		ASSERT_EQ(statistics.freeRangesCount, 3);
+		ASSERT_EQ(statistics.largestFreeRange, 724);
+	}
+
+	TEST_F(HeapTests, ConcurrentAllocationsDoNotOverlap)
+	{
+		const auto heap = std::make_shared<Heap>(Core::Heap::Settings { 4096, 2, false, true, 256, 16 });
+
+		constexpr std::size_t threadsCount = 8;
+		constexpr std::size_t iterationsCount = 4000;
+		constexpr std::size_t maxLiveHandlesCount = 64;
+		constexpr std::array<std::size_t, 6> sizes { 16, 32, 48, 64, 256, 1000 };
+
+		std::atomic<bool> overlap { false };
+		std::vector<std::thread> threads;
+
+		const auto mark = [&heap, &overlap](const Heap::Handle& handle, std::uint32_t tag) {
+			auto& owners = heap->GetTestBlock(handle.GetBlockIndex())->owners;
+
+			for (auto i = handle.GetOffset(); i < handle.GetOffset() + handle.GetLength(); ++i)
+			{
+				std::uint32_t expected = 0;
+
+				if (!owners[i].compare_exchange_strong(expected, tag))
+				{
+					overlap = true;
+				}
+			}
+		};
+
+		const auto unmark = [&heap, &overlap](const Heap::Handle& handle, std::uint32_t tag) {
+			auto& owners = heap->GetTestBlock(handle.GetBlockIndex())->owners;
+
+			for (auto i = handle.GetOffset(); i < handle.GetOffset() + handle.GetLength(); ++i)
+			{
+				if (owners[i].exchange(0) != tag)
+				{
+					overlap = true;
+				}
+			}
+		};
+
+		for (std::size_t threadIndex = 0; threadIndex < threadsCount; ++threadIndex)
+		{
+			threads.emplace_back([&, threadIndex]() {
+				std::mt19937 generator { static_cast<std::uint32_t>(threadIndex) };
+				std::vector<std::pair<std::unique_ptr<Heap::Handle>, std::uint32_t>> handles;
+
+				for (std::size_t i = 0; i < iterationsCount; ++i)
+				{
+					if (handles.empty() || (handles.size() < maxLiveHandlesCount && generator() % 3 != 0))
+					{
+						const auto size = sizes[generator() % sizes.size()];
+						const auto alignment = generator() % 2 == 0 ? std::optional<std::size_t> { 16 } : std::nullopt;
+						const auto tag = static_cast<std::uint32_t>(threadIndex * iterationsCount + i + 1);
+
+						auto handle = std::make_unique<Heap::Handle>(heap->Allocate({ size, alignment }));
+						mark(*handle, tag);
+						handles.emplace_back(std::move(handle), tag);
+					}
+					else
+					{
+						const auto index = generator() % handles.size();
+						unmark(*handles[index].first, handles[index].second);
+						std::swap(handles[index], handles.back());
+						handles.pop_back();
+					}
+				}
+
+				for (const auto& [handle, tag] : handles)
+				{
+					unmark(*handle, tag);
+				}
+
+				handles.clear();
+				heap->FlushThreadCache();
+			});
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		ASSERT_FALSE(overlap);
+
+		const auto statistics = heap->GetStatistics();
+		ASSERT_EQ(statistics.allocationsCount, 0);
+		ASSERT_EQ(statistics.allocatedBytes, 0);
+	}
+
+	TEST_F(HeapTests, DedicatedAllocationsAndMaxBlockSize)
+	{
+		Core::Heap::Settings settings {};
+		settings.initialSize = 1024;
+		settings.maxBlockSize = 2048;
+		settings.dedicatedThreshold = 4096;
+
+		const auto heap = std::make_shared<Heap>(settings);
+
+		const auto h1 = std::make_unique<Heap::Handle>(heap->Allocate({ 1000 }));
+		const auto h2 = std::make_unique<Heap::Handle>(heap->Allocate({ 1000 }));
+		const auto h3 = std::make_unique<Heap::Handle>(heap->Allocate({ 2000 }));
+		const auto h4 = std::make_unique<Heap::Handle>(heap->Allocate({ 2000 }));
+
+		ASSERT_EQ(heap->GetStatistics().reservedBytes, 1024 + 2048 * 3);
+
+		auto dedicated = std::make_unique<Heap::Handle>(heap->Allocate({ 5000 }));
+		ASSERT_EQ(dedicated->GetOffset(), 0);
+
+		auto statistics = heap->GetStatistics();
+		ASSERT_EQ(statistics.dedicatedBlocksCount, 1);
+		ASSERT_EQ(statistics.reservedBytes, 1024 + 2048 * 3 + 5000);
+
+		const auto h5 = std::make_unique<Heap::Handle>(heap->Allocate({ 100 }));
+		ASSERT_NE(h5->GetBlockIndex(), dedicated->GetBlockIndex());
+
+		const auto dedicatedBlockIndex = dedicated->GetBlockIndex();
+		dedicated.reset();
+
+		statistics = heap->GetStatistics();
+		ASSERT_EQ(statistics.dedicatedBlocksCount, 0);
+		ASSERT_FALSE(heap->HasBlock(dedicatedBlockIndex));
+		ASSERT_EQ(statistics.reservedBytes, 1024 + 2048 * 3);
+	}
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <Core/Math.hpp>
+#include <Core/Node.hpp>
 
 namespace MMPEngine::Core::Tests
 {
@@ -63,4 +64,79 @@ namespace MMPEngine::Core::Tests
 		ASSERT_EQ((Vector3Float{ 2.0f,6.0f,10.0f }), v3);
 		ASSERT_EQ((Vector4Float{ 2.0f,6.0f,10.0f,14.0f }), v4);
 	};
-}
\ No newline at end of file
+
+	TEST_F(MathTests, Affine3x4)
+	{
+		Transform t1 { { 1.5f, -2.0f, 0.25f }, Math::kQuaternionIdentity, { 1.2f, 0.8f, 2.0f } };
+		Transform t2 { { -0.5f, 3.0f, 1.0f }, Math::kQuaternionIdentity, { 0.5f, 1.5f, 1.0f } };
+		_default->RotationAroundAxis(t1.rotation, { 1.0f, 2.0f, -0.5f }, Math::ConvertDegreesToRadians(35.0f));
+		_default->RotationAroundAxis(t2.rotation, { -1.0f, 0.3f, 0.7f }, Math::ConvertDegreesToRadians(70.0f));
+
+		Matrix4x4 m1 {};
+		Matrix4x4 m2 {};
+		Affine3x4 a1 {};
+		Affine3x4 a2 {};
+
+		_default->TRS(m1, t1);
+		_default->TRS(m2, t2);
+		_default->TRS(a1, t1);
+		_default->TRS(a2, t2);
+
+		Affine3x4 expected {};
+		_default->ToAffine(expected, m1);
+		ASSERT_EQ(a1, expected);
+
+		Matrix4x4 restored {};
+		_default->FromAffine(restored, a1);
+		ASSERT_EQ(restored, m1);
+
+		Matrix4x4 product {};
+		Affine3x4 affineProduct {};
+		_default->Multiply(product, m1, m2);
+		_default->Multiply(affineProduct, a1, a2);
+		_default->ToAffine(expected, product);
+		ASSERT_EQ(affineProduct, expected);
+
+		Matrix4x4 inverse {};
+		Affine3x4 affineInverse {};
+		_default->Inverse(inverse, product);
+		_default->Inverse(affineInverse, affineProduct);
+		_default->ToAffine(expected, inverse);
+		ASSERT_EQ(affineInverse, expected);
+
+		Matrix4x4 inverseTranspose {};
+		Matrix3x3 normalMatrix {};
+		_default->InverseTranspose(inverseTranspose, product);
+		_default->InverseTranspose(normalMatrix, affineProduct);
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				ASSERT_NEAR(normalMatrix.m[i][j], inverseTranspose.m[i][j], 1e-4f);
+			}
+		}
+	}
+
+	TEST_F(MathTests, AffineLocalToWorldSpaceMatrix)
+	{
+		const auto root = std::make_shared<Node>();
+		const auto child = std::make_shared<Node>();
+		root->AddChild(child);
+
+		root->localTransform.position = { 1.0f, -2.0f, 3.0f };
+		root->localTransform.scale = { 2.0f, 2.0f, 2.0f };
+		_default->RotationAroundAxis(root->localTransform.rotation, { 0.0f, 1.0f, 0.0f }, Math::ConvertDegreesToRadians(30.0f));
+		child->localTransform.position = { 0.5f, 0.0f, -1.0f };
+		_default->RotationAroundAxis(child->localTransform.rotation, { 1.0f, 0.0f, 0.0f }, Math::ConvertDegreesToRadians(45.0f));
+
+		Matrix4x4 matrix {};
+		Affine3x4 affine {};
+		Affine3x4 expected {};
+		_default->CalculateLocalToWorldSpaceMatrix(matrix, child);
+		_default->CalculateLocalToWorldSpaceMatrix(affine, child);
+		_default->ToAffine(expected, matrix);
+
+		ASSERT_EQ(affine, expected);
+	}
+}
@@ -406,6 +406,71 @@ namespace MMPEngine::Core::Tests
 	}
 
 
+	TYPED_TEST_P(MathTests, Affine3x4_Multiply)
+	{
+		constexpr Core::Affine3x4 m1 {
+			{
+				{ 0.457f, -1.333f, 0.049f, -8.24f },
+				{ -0.094f, 0.912f, -0.693f, 5.85f },
+				{ 1.42f, -0.018f, 1.12f, -4.12f }
+			}
+		};
+
+		constexpr Core::Affine3x4 m2 {
+			{
+				{ 1.12f, 0.141f, -0.5177f, 1.0125f },
+				{ -0.56f, 0.892f, 0.784f, 2.5f },
+				{ 0.25f, -0.5f, 1.75f, -3.0f }
+			}
+		};
+
+		Core::Affine3x4 res1 {};
+		Core::Affine3x4 res2 {};
+
+		this->GetDefaultMath()->Multiply(res1, m1, m2);
+		this->GetMathImpl()->Multiply(res2, m1, m2);
+
+		ASSERT_EQ(res1, res2);
+	}
+
+	TYPED_TEST_P(MathTests, Affine3x4_Inverse)
+	{
+		constexpr Core::Affine3x4 m {
+			{
+				{ 0.457f, -1.333f, 0.049f, -8.24f },
+				{ -0.094f, 0.912f, -0.693f, 5.85f },
+				{ 1.42f, -0.018f, 1.12f, -4.12f }
+			}
+		};
+
+		Core::Affine3x4 res1 {};
+		Core::Affine3x4 res2 {};
+
+		this->GetDefaultMath()->Inverse(res1, m);
+		this->GetMathImpl()->Inverse(res2, m);
+
+		ASSERT_EQ(res1, res2);
+	}
+
+	TYPED_TEST_P(MathTests, Affine3x4_InverseTranspose)
+	{
+		constexpr Core::Affine3x4 m {
+			{
+				{ 0.457f, -1.333f, 0.049f, -8.24f },
+				{ -0.094f, 0.912f, -0.693f, 5.85f },
+				{ 1.42f, -0.018f, 1.12f, -4.12f }
+			}
+		};
+
+		Core::Matrix3x3 res1 {};
+		Core::Matrix3x3 res2 {};
+
+		this->GetDefaultMath()->InverseTranspose(res1, m);
+		this->GetMathImpl()->InverseTranspose(res2, m);
+
+		ASSERT_EQ(res1, res2);
+	}
+
 	TYPED_TEST_P(MathTests, Quaternion_RotateAroundAxis)
 	{
 		constexpr Core::Vector3Float v {1.0f, 1.0f, -1.0f};
@@ -690,6 +755,9 @@ namespace MMPEngine::Core::Tests
 		Matrix4x4_DecomposeTRS,
 		Matrix4x4_Transpose,
 		Matrix4x4_InverseTranspose,
+		Affine3x4_Multiply,
+		Affine3x4_Inverse,
+		Affine3x4_InverseTranspose,
 		Quaternion_RotateAroundAxis,
 		Quaternion_Dot,
         Quaternion_Normalize,
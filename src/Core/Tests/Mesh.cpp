@@ -0,0 +1,251 @@
+#include <gtest/gtest.h>
+#include <Core/Mesh.hpp>
+#include <Core/Node.hpp>
+#include <Core/TransformHierarchy.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class MeshGlobalContext final : public Core::GlobalContext
+	{
+	public:
+		MeshGlobalContext() : Core::GlobalContext(Settings { false, BackendType::Vulkan }, Environment {}, std::make_unique<DefaultMath>())
+		{
+		}
+	};
+
+	class MeshStream final : public BaseStream
+	{
+	public:
+		MeshStream() : BaseStream(std::make_shared<MeshGlobalContext>(), std::make_shared<StreamContext>())
+		{
+		}
+	};
+
+	template<typename TData>
+	class MeshUniformBuffer final : public Core::UniformBuffer<TData>
+	{
+	private:
+		using WriteTaskContext = typename Core::UniformBuffer<TData>::WriteTaskContext;
+
+		class WriteTask final : public ContextualTask<WriteTaskContext>
+		{
+		public:
+			WriteTask(const std::shared_ptr<WriteTaskContext>& ctx, MeshUniformBuffer* buffer) : ContextualTask<WriteTaskContext>(ctx), _buffer(buffer)
+			{
+			}
+		protected:
+			void OnScheduled(const std::shared_ptr<BaseStream>& stream) override
+			{
+				ContextualTask<WriteTaskContext>::OnScheduled(stream);
+				_buffer->writes.push_back(this->GetTaskContext()->data);
+			}
+		private:
+			MeshUniformBuffer* _buffer;
+		};
+	public:
+		MeshUniformBuffer() : Core::UniformBuffer<TData>(Core::Buffer::Settings { sizeof(TData) })
+		{
+		}
+		std::shared_ptr<BaseTask> CreateCopyToBufferTask(const std::shared_ptr<Core::Buffer>&, std::size_t, std::size_t, std::size_t) const override
+		{
+			return BaseTask::kEmpty;
+		}
+		std::shared_ptr<ContextualTask<WriteTaskContext>> CreateWriteAsyncTask(const TData& data) override
+		{
+			const auto ctx = std::make_shared<WriteTaskContext>();
+			ctx->data = data;
+			return std::make_shared<WriteTask>(ctx, this);
+		}
+
+		std::vector<TData> writes;
+	};
+
+	class MeshRenderer final : public Mesh::Renderer
+	{
+	public:
+		MeshRenderer(const Settings& settings, const std::shared_ptr<Node>& node) : Mesh::Renderer(settings, nullptr, node)
+		{
+		}
+
+		std::shared_ptr<MeshUniformBuffer<Data>> uniformBuffer;
+		std::shared_ptr<MeshUniformBuffer<AffineData>> affineUniformBuffer;
+	protected:
+		std::shared_ptr<UniformBuffer<Data>> CreateUniformBuffer() override
+		{
+			uniformBuffer = std::make_shared<MeshUniformBuffer<Data>>();
+			return uniformBuffer;
+		}
+		std::shared_ptr<UniformBuffer<AffineData>> CreateAffineUniformBuffer() override
+		{
+			affineUniformBuffer = std::make_shared<MeshUniformBuffer<AffineData>>();
+			return affineUniformBuffer;
+		}
+		std::shared_ptr<BaseTask> CreateInternalInitializationTask() override
+		{
+			return BaseTask::kEmpty;
+		}
+	};
+
+	class MeshRendererTests : public testing::Test
+	{
+	protected:
+		std::shared_ptr<MeshStream> _stream;
+		std::shared_ptr<Node> _root;
+		std::shared_ptr<Node> _node;
+		std::shared_ptr<MeshRenderer> _renderer;
+
+		inline void SetUp() override
+		{
+			testing::Test::SetUp();
+
+			_stream = std::make_shared<MeshStream>();
+			_root = std::make_shared<Node>();
+			_node = std::make_shared<Node>();
+			_root->AddChild(_node);
+
+			_root->localTransform.position = { 1.0f, 2.0f, 3.0f };
+			_node->localTransform.scale = { 2.0f, 2.0f, 2.0f };
+
+			_renderer = std::make_shared<MeshRenderer>(Mesh::Renderer::Settings {}, _node);
+			Execute(_renderer->CreateInitializationTask());
+		}
+
+		inline void TearDown() override
+		{
+			_renderer.reset();
+			_stream.reset();
+			testing::Test::TearDown();
+		}
+
+		inline void Execute(const std::shared_ptr<BaseTask>& task) const
+		{
+			_stream->Restart();
+			_stream->Schedule(task);
+			_stream->SubmitAndWait();
+		}
+
+		inline Matrix4x4 GetExpectedMatrix() const
+		{
+			Matrix4x4 expected {};
+			_stream->GetGlobalContext()->math->CalculateLocalToWorldSpaceMatrix(expected, _node);
+			return expected;
+		}
+	};
+
+	TEST_F(MeshRendererTests, ReadsWorldMatricesFromTransformHierarchy)
+	{
+		const auto& math = *_stream->GetGlobalContext()->math;
+		const auto hierarchy = std::make_shared<TransformHierarchy>(TransformHierarchy::Settings {}, _root);
+		_renderer->SetTransformHierarchy(hierarchy);
+
+		_root->localTransform.position = { -4.0f, 0.0f, 1.0f };
+		hierarchy->Update(math);
+		Execute(_renderer->CreateTaskToUpdateAndWriteUniformData());
+
+		ASSERT_EQ(_renderer->uniformBuffer->writes.size(), 1);
+		ASSERT_EQ(_renderer->uniformBuffer->writes.back().localToWorldMatrix, GetExpectedMatrix());
+
+		const auto hierarchyMatrix = hierarchy->GetWorldMatrix(hierarchy->GetIndex(_node).value());
+		_node->localTransform.position = { 0.0f, 5.0f, 0.0f };
+		Execute(_renderer->CreateTaskToUpdateAndWriteUniformData());
+
+		ASSERT_EQ(_renderer->uniformBuffer->writes.size(), 2);
+		ASSERT_EQ(_renderer->uniformBuffer->writes.back().localToWorldMatrix, hierarchyMatrix);
+
+		_node->localTransform.position = { 0.0f, 6.0f, 0.0f };
+		hierarchy->Update(math);
+		Execute(_renderer->CreateTaskToUpdateAndWriteUniformData());
+
+		ASSERT_EQ(_renderer->uniformBuffer->writes.back().localToWorldMatrix, GetExpectedMatrix());
+	}
+
+	TEST_F(MeshRendererTests, FirstUpdateWritesUniformData)
+	{
+		ASSERT_TRUE(_renderer->IsUniformDataChanged());
+		Execute(_renderer->CreateTaskToUpdateAndWriteUniformData());
+
+		ASSERT_EQ(_renderer->uniformBuffer->writes.size(), 1);
+		ASSERT_EQ(_renderer->uniformBuffer->writes.back().localToWorldMatrix, GetExpectedMatrix());
+		ASSERT_FALSE(_renderer->IsUniformDataChanged());
+	}
+
+	TEST_F(MeshRendererTests, SkipsUnchangedUniformData)
+	{
+		Execute(_renderer->CreateTaskToUpdateAndWriteUniformData());
+		Execute(_renderer->CreateTaskToUpdateAndWriteUniformData());
+		Execute(Mesh::Renderer::CreateTaskToUpdateAndWriteChangedUniformData({ _renderer }));
+
+		ASSERT_EQ(_renderer->uniformBuffer->writes.size(), 1);
+	}
+
+	TEST_F(MeshRendererTests, RewritesAfterAncestorTransformChange)
+	{
+		Execute(_renderer->CreateTaskToUpdateAndWriteUniformData());
+
+		_root->localTransform.position = { 0.0f, -1.0f, 0.0f };
+		ASSERT_TRUE(_renderer->IsUniformDataChanged());
+		Execute(Mesh::Renderer::CreateTaskToUpdateAndWriteChangedUniformData({ _renderer }));
+
+		ASSERT_EQ(_renderer->uniformBuffer->writes.size(), 2);
+		ASSERT_EQ(_renderer->uniformBuffer->writes.back().localToWorldMatrix, GetExpectedMatrix());
+	}
+
+	TEST_F(MeshRendererTests, RewritesAfterReparenting)
+	{
+		Execute(_renderer->CreateTaskToUpdateAndWriteUniformData());
+
+		const auto parent = std::make_shared<Node>();
+		parent->localTransform.position = { 7.0f, 0.0f, 0.0f };
+		parent->AddChild(_node);
+		ASSERT_TRUE(_renderer->IsUniformDataChanged());
+		Execute(Mesh::Renderer::CreateTaskToUpdateAndWriteChangedUniformData({ _renderer }));
+
+		ASSERT_EQ(_renderer->uniformBuffer->writes.size(), 2);
+		ASSERT_EQ(_renderer->uniformBuffer->writes.back().localToWorldMatrix, GetExpectedMatrix());
+	}
+
+	TEST_F(MeshRendererTests, PrecomputedWriteClearsUploadedTransforms)
+	{
+		Execute(_renderer->CreateTaskToUpdateAndWriteUniformData());
+
+		Mesh::Renderer::Data precomputed {};
+		precomputed.localToWorldMatrix.m[3][0] = 1.0f;
+		const auto task = _renderer->CreateTaskToUpdateAndWriteUniformData();
+		task->GetTaskContext()->precomputed = precomputed;
+		Execute(task);
+
+		ASSERT_EQ(_renderer->uniformBuffer->writes.size(), 2);
+		ASSERT_EQ(_renderer->uniformBuffer->writes.back().localToWorldMatrix, precomputed.localToWorldMatrix);
+		ASSERT_TRUE(_renderer->IsUniformDataChanged());
+
+		Execute(Mesh::Renderer::CreateTaskToUpdateAndWriteChangedUniformData({ _renderer }));
+		ASSERT_EQ(_renderer->uniformBuffer->writes.size(), 3);
+		ASSERT_EQ(_renderer->uniformBuffer->writes.back().localToWorldMatrix, GetExpectedMatrix());
+	}
+
+	TEST_F(MeshRendererTests, AffineLayoutComposesWorldMatrix)
+	{
+		const auto& math = *_stream->GetGlobalContext()->math;
+		Mesh::Renderer::Settings settings {};
+		settings.staticData.dataLayout = Mesh::Renderer::DataLayout::Affine;
+
+		const auto renderer = std::make_shared<MeshRenderer>(settings, _node);
+		Execute(renderer->CreateInitializationTask());
+		Execute(renderer->CreateTaskToUpdateAndWriteUniformData());
+
+		Affine3x4 expected {};
+		math.ToAffine(expected, GetExpectedMatrix());
+		ASSERT_EQ(renderer->affineUniformBuffer->writes.size(), 1);
+		ASSERT_EQ(renderer->affineUniformBuffer->writes.back().localToWorldMatrix, expected);
+
+		const auto hierarchy = std::make_shared<TransformHierarchy>(TransformHierarchy::Settings {}, _root);
+		renderer->SetTransformHierarchy(hierarchy);
+		_root->localTransform.position = { 0.0f, 0.0f, -3.0f };
+		hierarchy->Update(math);
+		Execute(renderer->CreateTaskToUpdateAndWriteUniformData());
+
+		math.ToAffine(expected, GetExpectedMatrix());
+		ASSERT_EQ(renderer->affineUniformBuffer->writes.size(), 2);
+		ASSERT_EQ(renderer->affineUniformBuffer->writes.back().localToWorldMatrix, expected);
+	}
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <Core/Meshlet.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class MeshletTests : public testing::Test
+	{
+	protected:
+		static constexpr std::uint32_t kGridSize = 32;
+
+		static GeometryPrototype CreateGrid()
+		{
+			GeometryPrototype proto;
+			auto positions = std::make_unique<VertexBufferPrototypeFloat3>(VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::Position }, {} });
+			auto indices = std::make_unique<IndexBufferPrototype16>(IndexBufferPrototype::Settings {});
+
+			for (std::uint32_t y = 0; y <= kGridSize; ++y)
+			{
+				for (std::uint32_t x = 0; x <= kGridSize; ++x)
+				{
+					positions->data.push_back({ static_cast<std::float_t>(x), static_cast<std::float_t>(y), 0.0f });
+				}
+			}
+
+			for (std::uint32_t y = 0; y < kGridSize; ++y)
+			{
+				for (std::uint32_t x = 0; x < kGridSize; ++x)
+				{
+					const auto v = static_cast<std::uint16_t>(y * (kGridSize + 1) + x);
+					const auto up = static_cast<std::uint16_t>(v + kGridSize + 1);
+					indices->data.insert(indices->data.end(), { v, up, static_cast<std::uint16_t>(v + 1) });
+					indices->data.insert(indices->data.end(), { static_cast<std::uint16_t>(v + 1), up, static_cast<std::uint16_t>(up + 1) });
+				}
+			}
+
+			proto.vertexBuffers.push_back(std::move(positions));
+			proto.indexBuffer = std::move(indices);
+			proto.subsets = { { static_cast<std::uint32_t>(proto.indexBuffer->GetElementsCount()), 0, 0 } };
+			return proto;
+		}
+
+		static Matrix4x4 CreateOrthographic(std::float_t minX, std::float_t maxX, std::float_t minY, std::float_t maxY)
+		{
+			Matrix4x4 m {};
+			m.m[0][0] = 2.0f / (maxX - minX);
+			m.m[0][3] = -(maxX + minX) / (maxX - minX);
+			m.m[1][1] = 2.0f / (maxY - minY);
+			m.m[1][3] = -(maxY + minY) / (maxY - minY);
+			m.m[2][2] = 0.01f;
+			m.m[2][3] = 0.5f;
+			m.m[3][3] = 1.0f;
+			return m;
+		}
+	};
+
+	TEST_F(MeshletTests, BuildsMeshletsWithinLimits)
+	{
+		const auto proto = CreateGrid();
+		const auto& indices = dynamic_cast<const IndexBufferPrototype16&>(*proto.indexBuffer).data;
+		const auto positions = static_cast<const Vector3Float*>(proto.vertexBuffers.front()->GetDataPtr());
+		const auto geometry = MeshletGeometry::Build(proto, {});
+
+		std::size_t triangles = 0;
+
+		for (const auto& meshlet : geometry.meshlets)
+		{
+			ASSERT_LE(meshlet.vertexCount, MeshletGeometry::kMaxVertices);
+			ASSERT_LE(meshlet.triangleCount, MeshletGeometry::kMaxTriangles);
+			ASSERT_EQ(meshlet.indexCount, meshlet.triangleCount * 3);
+			ASSERT_EQ(meshlet.indexStart, triangles * 3);
+			ASSERT_NEAR(meshlet.coneAxis.z, -1.0f, 1e-5f);
+			ASSERT_NEAR(meshlet.coneCutoff, 0.0f, 1e-3f);
+
+			for (std::uint32_t i = 0; i < meshlet.indexCount; ++i)
+			{
+				const auto local = geometry.triangles[meshlet.triangleOffset + i];
+				ASSERT_LT(local, meshlet.vertexCount);
+
+				const auto vertex = geometry.vertices[meshlet.vertexOffset + local];
+				ASSERT_EQ(vertex, indices[meshlet.indexStart + i] + meshlet.baseVertex);
+
+				const auto& p = positions[vertex];
+				const auto dx = p.x - meshlet.center.x;
+				const auto dy = p.y - meshlet.center.y;
+				const auto dz = p.z - meshlet.center.z;
+				ASSERT_LE(std::sqrt(dx * dx + dy * dy + dz * dz), meshlet.radius + 1e-4f);
+			}
+
+			triangles += meshlet.triangleCount;
+		}
+
+		ASSERT_EQ(triangles, indices.size() / 3);
+		ASSERT_EQ(geometry.triangles.size(), indices.size());
+	}
+
+	TEST_F(MeshletTests, CullsAgainstFrustumAndCone)
+	{
+		const auto proto = CreateGrid();
+		const auto geometry = MeshletGeometry::Build(proto, {});
+		const auto meshletCount = static_cast<std::uint32_t>(geometry.meshlets.size());
+		const auto totalIndices = static_cast<std::uint32_t>(proto.indexBuffer->GetElementsCount());
+		const auto size = static_cast<std::float_t>(kGridSize);
+
+		std::vector<std::uint32_t> compacted {};
+
+		const auto front = MeshletGeometry::CreateCullingData(CreateOrthographic(0.0f, size, 0.0f, size), { size * 0.5f, size * 0.5f, -10.0f }, meshletCount, proto.indexBuffer->GetFormat());
+		ASSERT_EQ(MeshletGeometry::Cull(geometry.meshlets, front, *proto.indexBuffer, compacted).indexCount, totalIndices);
+
+		const auto back = MeshletGeometry::CreateCullingData(CreateOrthographic(0.0f, size, 0.0f, size), { size * 0.5f, size * 0.5f, 100.0f }, meshletCount, proto.indexBuffer->GetFormat());
+		ASSERT_EQ(MeshletGeometry::Cull(geometry.meshlets, back, *proto.indexBuffer, compacted).indexCount, 0);
+
+		const auto partial = MeshletGeometry::CreateCullingData(CreateOrthographic(0.0f, size, 0.0f, size * 0.25f), { size * 0.5f, size * 0.5f, -10.0f }, meshletCount, proto.indexBuffer->GetFormat());
+		const auto args = MeshletGeometry::Cull(geometry.meshlets, partial, *proto.indexBuffer, compacted);
+		ASSERT_GT(args.indexCount, 0);
+		ASSERT_LT(args.indexCount, totalIndices);
+		ASSERT_EQ(args.indexCount, compacted.size());
+
+		const auto positions = static_cast<const Vector3Float*>(proto.vertexBuffers.front()->GetDataPtr());
+		const auto& indices = dynamic_cast<const IndexBufferPrototype16&>(*proto.indexBuffer).data;
+		std::size_t insideTriangles = 0;
+		std::size_t keptInsideTriangles = 0;
+
+		for (std::size_t t = 0; t < indices.size(); t += 3)
+		{
+			const auto inside = positions[indices[t]].y <= size * 0.25f && positions[indices[t + 1]].y <= size * 0.25f && positions[indices[t + 2]].y <= size * 0.25f;
+
+			if (!inside)
+			{
+				continue;
+			}
+
+			++insideTriangles;
+
+			for (std::size_t c = 0; c < compacted.size(); c += 3)
+			{
+				if (compacted[c] == indices[t] && compacted[c + 1] == indices[t + 1] && compacted[c + 2] == indices[t + 2])
+				{
+					++keptInsideTriangles;
+					break;
+				}
+			}
+		}
+
+		ASSERT_GT(insideTriangles, 0);
+		ASSERT_EQ(keptInsideTriangles, insideTriangles);
+	}
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <Core/Node.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class NodeTests : public testing::Test
+	{
+	protected:
+		std::shared_ptr<Node> _root;
+		std::shared_ptr<Node> _hips;
+		std::shared_ptr<Node> _spine;
+		std::shared_ptr<Node> _head;
+		std::shared_ptr<Node> _leftHand;
+		std::shared_ptr<Node> _rightHand;
+
+		inline void SetUp() override
+		{
+			testing::Test::SetUp();
+
+			_root = std::make_shared<Node>("character");
+			_hips = std::make_shared<Node>("hips");
+			_spine = std::make_shared<Node>("spine");
+			_head = std::make_shared<Node>("head");
+			_leftHand = std::make_shared<Node>("hand");
+			_rightHand = std::make_shared<Node>("hand");
+
+			_root->AddChild(_hips);
+			_hips->AddChild(_spine);
+			_spine->AddChild(_head);
+			_spine->AddChild(_leftHand);
+			_hips->AddChild(_rightHand);
+		}
+
+		inline void CheckLookups() const
+		{
+			ASSERT_EQ(_root->FindNodeInSubtree("head"), _head);
+			ASSERT_EQ(_spine->FindNodeInSubtree("head"), _head);
+			ASSERT_EQ(_root->FindNodeInSubtree("missing"), nullptr);
+			ASSERT_EQ(_head->FindNodeInSubtree("spine"), nullptr);
+			ASSERT_EQ(_root->FindNodeByPath("hips/spine/head"), _head);
+			ASSERT_EQ(_root->FindNodeByPath("hips/spine/hand"), _leftHand);
+			ASSERT_EQ(_root->FindNodeByPath("hips/hand"), _rightHand);
+			ASSERT_EQ(_hips->FindNodeByPath("spine/hand"), _leftHand);
+			ASSERT_EQ(_root->FindNodeByPath("spine/head"), nullptr);
+			ASSERT_EQ(_root->FindNodeByPath(""), _root);
+		}
+	};
+
+	TEST_F(NodeTests, InternsNames)
+	{
+		ASSERT_EQ(_leftHand->GetNameId(), _rightHand->GetNameId());
+		ASSERT_NE(_leftHand->GetNameId(), _head->GetNameId());
+		ASSERT_EQ(Node::InternName("head"), _head->GetNameId());
+		ASSERT_EQ(Node::FindNameId("spine"), _spine->GetNameId());
+		ASSERT_FALSE(Node::FindNameId("never_interned_node_name").has_value());
+	}
+
+	TEST_F(NodeTests, InternsGeneratedNamesLazily)
+	{
+		const auto anonymous = std::make_shared<Node>();
+		const std::string name { anonymous->GetName() };
+		_spine->AddChild(anonymous);
+
+		ASSERT_FALSE(Node::FindNameId(name).has_value());
+		ASSERT_EQ(_root->FindNodeInSubtree(name), anonymous);
+		ASSERT_EQ(_root->FindNodeByPath("hips/spine/" + name), anonymous);
+		ASSERT_FALSE(Node::FindNameId(name).has_value());
+
+		_root->EnableIndex();
+		ASSERT_EQ(Node::FindNameId(name), anonymous->GetNameId());
+		ASSERT_EQ(_root->FindNodeInSubtree(name), anonymous);
+		ASSERT_EQ(_root->FindNodeByPath("hips/spine/" + name), anonymous);
+	}
+
+	TEST_F(NodeTests, FindsByNameAndPath)
+	{
+		CheckLookups();
+		_root->EnableIndex();
+		ASSERT_TRUE(_root->HasIndex());
+		CheckLookups();
+	}
+
+	TEST_F(NodeTests, IndexFollowsReparenting)
+	{
+		_root->EnableIndex();
+
+		_head->SetParent(_hips);
+		ASSERT_EQ(_root->FindNodeByPath("hips/head"), _head);
+		ASSERT_EQ(_root->FindNodeByPath("hips/spine/head"), nullptr);
+
+		_hips->RemoveChild(_spine);
+		ASSERT_EQ(_spine->GetParent(), nullptr);
+		ASSERT_EQ(_root->FindNodeByPath("hips/spine/hand"), nullptr);
+		ASSERT_EQ(_root->FindNodeInSubtree("spine"), nullptr);
+		ASSERT_EQ(_spine->FindNodeByPath("hand"), _leftHand);
+
+		_spine->EnableIndex();
+		_root->AddChild(_spine);
+		ASSERT_FALSE(_spine->HasIndex());
+		ASSERT_EQ(_root->FindNodeByPath("spine/hand"), _leftHand);
+		ASSERT_EQ(_root->FindNodeInSubtree("spine"), _spine);
+	}
+
+	TEST_F(NodeTests, AddsChildrenInBulk)
+	{
+		_root->EnableIndex();
+
+		std::vector<std::shared_ptr<Node>> fingers;
+
+		for (std::size_t i = 0; i < 5; ++i)
+		{
+			fingers.push_back(std::make_shared<Node>("finger" + std::to_string(i)));
+		}
+
+		fingers.push_back(_head);
+		fingers.push_back(_head);
+
+		_leftHand->AddChildren(fingers);
+
+		ASSERT_EQ(_leftHand->GetChildren().size(), 6);
+		ASSERT_TRUE(_spine->GetChildren().find(_head) == _spine->GetChildren().cend());
+		ASSERT_EQ(_root->FindNodeByPath("hips/spine/hand/finger3"), fingers[3]);
+		ASSERT_EQ(_root->FindNodeByPath("hips/spine/hand/head"), _head);
+		ASSERT_EQ(_root->FindNodeByPath("hips/spine/head"), nullptr);
+
+		_head->SetParent(nullptr);
+		ASSERT_EQ(_root->FindNodeInSubtree("head"), nullptr);
+	}
+
+	TEST_F(NodeTests, BuildsDeepChains)
+	{
+		auto current = _head;
+
+		for (std::size_t i = 0; i < 10000; ++i)
+		{
+			const auto node = std::make_shared<Node>("chain");
+			current->AddChild(node);
+			current = node;
+		}
+
+		ASSERT_EQ(current->FindNodeInSubtree("chain"), current);
+		ASSERT_EQ(_root->FindNodeByPath("hips/spine/head/chain/chain")->GetParent()->GetParent(), _head);
+	}
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <Core/Prefab.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class PrefabTests : public testing::Test
+	{
+	protected:
+		DefaultMath _math;
+		std::shared_ptr<Node> _source;
+		std::shared_ptr<Prefab> _prefab;
+
+		inline void SetUp() override
+		{
+			testing::Test::SetUp();
+
+			_source = std::make_shared<Node>("crate");
+			const auto lid = std::make_shared<Node>("lid");
+			const auto hinge = std::make_shared<Node>("hinge");
+			const auto base = std::make_shared<Node>("base");
+
+			lid->localTransform.position = { 0.0f, 1.0f, 0.0f };
+			hinge->localTransform.position = { 0.5f, 0.0f, 0.0f };
+			_math.RotationAroundAxis(hinge->localTransform.rotation, Math::kRight, Math::ConvertDegreesToRadians(30.0f));
+			base->localTransform.scale = { 2.0f, 1.0f, 2.0f };
+
+			_source->AddChildren({ lid, base });
+			lid->AddChild(hinge);
+
+			_prefab = std::make_shared<Prefab>(_source);
+		}
+
+		inline void CheckMatrices(Prefab::Instance& instance, const std::vector<Matrix4x4>& matrices) const
+		{
+			for (std::size_t i = 0; i < _prefab->GetEntriesCount(); ++i)
+			{
+				Matrix4x4 expected {};
+				_math.CalculateLocalToWorldSpaceMatrix(expected, instance.GetNode(i));
+				ASSERT_EQ(matrices[i], expected);
+			}
+		}
+	};
+
+	TEST_F(PrefabTests, FlattensTemplate)
+	{
+		ASSERT_EQ(_prefab->GetEntriesCount(), 4);
+		ASSERT_EQ(_prefab->GetEntry(0).parent, Prefab::kNoParent);
+		ASSERT_EQ(_prefab->FindEntry(""), 0);
+		ASSERT_EQ(_prefab->GetEntry(_prefab->FindEntry("lid/hinge").value()).name, "hinge");
+		ASSERT_EQ(_prefab->GetEntry(_prefab->FindEntry("lid/hinge").value()).parent, _prefab->FindEntry("lid"));
+		ASSERT_FALSE(_prefab->FindEntry("base/hinge").has_value());
+		ASSERT_FALSE(_prefab->FindEntry("lid/unknown_prefab_node").has_value());
+	}
+
+	TEST_F(PrefabTests, InstancesShareTemplateUntilMutated)
+	{
+		const auto hinge = _prefab->FindEntry("lid/hinge").value();
+		const auto first = _prefab->Instantiate();
+		const auto second = _prefab->Instantiate();
+
+		Transform root {};
+		root.position = { 10.0f, 0.0f, -3.0f };
+		first->SetLocalTransform(0, root);
+
+		Transform open = first->GetLocalTransform(hinge);
+		_math.RotationAroundAxis(open.rotation, Math::kRight, Math::ConvertDegreesToRadians(90.0f));
+		first->SetLocalTransform(hinge, open);
+
+		ASSERT_EQ(first->GetOverridesCount(), 2);
+		ASSERT_EQ(second->GetOverridesCount(), 0);
+		ASSERT_FALSE(first->IsMaterialized());
+		ASSERT_EQ(first->GetLocalTransform(0).position, root.position);
+		ASSERT_EQ(second->GetLocalTransform(0).position, _source->localTransform.position);
+
+		std::vector<Matrix4x4> firstMatrices;
+		std::vector<Matrix4x4> secondMatrices;
+		first->CalculateLocalToWorldSpaceMatrices(firstMatrices, _math);
+		second->CalculateLocalToWorldSpaceMatrices(secondMatrices, _math);
+
+		CheckMatrices(*first, firstMatrices);
+		CheckMatrices(*second, secondMatrices);
+		ASSERT_NE(firstMatrices[hinge], secondMatrices[hinge]);
+	}
+
+	TEST_F(PrefabTests, MaterializesNodesOnDemand)
+	{
+		const auto instance = _prefab->Instantiate();
+		const auto lid = _prefab->FindEntry("lid").value();
+
+		Transform moved {};
+		moved.position = { 0.0f, 5.0f, 0.0f };
+		instance->SetLocalTransform(lid, moved);
+
+		const auto hingeNode = instance->GetNode(_prefab->FindEntry("lid/hinge").value());
+
+		ASSERT_TRUE(instance->IsMaterialized());
+		ASSERT_EQ(instance->GetOverridesCount(), 0);
+		ASSERT_EQ(hingeNode->GetParent(), instance->GetNode(lid));
+		ASSERT_EQ(hingeNode->GetParent()->localTransform.position, moved.position);
+		ASSERT_EQ(instance->GetNode(0)->FindNodeByPath("lid/hinge"), hingeNode);
+
+		const auto parent = std::make_shared<Node>();
+		parent->localTransform.position = { 1.0f, 2.0f, 3.0f };
+		parent->AddChild(instance->GetNode(0));
+
+		std::vector<Matrix4x4> matrices;
+		instance->CalculateLocalToWorldSpaceMatrices(matrices, _math);
+		CheckMatrices(*instance, matrices);
+	}
+}
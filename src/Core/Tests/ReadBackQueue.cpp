@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include <Core/ReadBackQueue.hpp>
+#include <cstring>
+#include <numeric>
+
+namespace MMPEngine::Core::Tests
+{
+	class ReadBackGlobalContext final : public Core::GlobalContext
+	{
+	public:
+		ReadBackGlobalContext() : Core::GlobalContext(Settings { false, BackendType::Vulkan }, Environment {}, std::make_unique<DefaultMath>())
+		{
+		}
+	};
+
+	class ReadBackStream final : public BaseStream
+	{
+	public:
+		ReadBackStream() : BaseStream(std::make_shared<ReadBackGlobalContext>(), std::make_shared<StreamContext>())
+		{
+		}
+	};
+
+	class ReadBackQueue final : public Core::ReadBackQueue
+	{
+	public:
+		class ReadBackBuffer final : public Core::ReadBackBuffer
+		{
+		private:
+			class ReadTask final : public ContextualTask<ReadTaskContext>
+			{
+			public:
+				ReadTask(const std::shared_ptr<ReadTaskContext>& ctx, const std::shared_ptr<ReadBackBuffer>& buffer) : ContextualTask(ctx), _buffer(buffer)
+				{
+				}
+			protected:
+				void OnScheduled(const std::shared_ptr<BaseStream>& stream) override
+				{
+					ContextualTask::OnScheduled(stream);
+					_buffer->synchronizedReadsCount += GetTaskContext()->synchronize ? 1 : 0;
+				}
+				void Run(const std::shared_ptr<BaseStream>& stream) override
+				{
+					ContextualTask::Run(stream);
+					const auto tc = GetTaskContext();
+					std::memcpy(tc->dst, _buffer->data.data() + tc->byteOffset, tc->byteLength);
+				}
+			private:
+				std::shared_ptr<ReadBackBuffer> _buffer;
+			};
+		public:
+			ReadBackBuffer(const Settings& settings) : Core::ReadBackBuffer(settings), data(settings.byteLength, 0)
+			{
+			}
+			std::shared_ptr<BaseTask> CreateCopyToBufferTask(const std::shared_ptr<Core::Buffer>&, std::size_t, std::size_t, std::size_t) const override
+			{
+				return BaseTask::kEmpty;
+			}
+			std::shared_ptr<ContextualTask<ReadTaskContext>> CreateReadTask(void* dst, std::size_t byteLength, std::size_t byteOffset) override
+			{
+				const auto ctx = std::make_shared<ReadTaskContext>();
+				ctx->dst = dst;
+				ctx->byteLength = byteLength;
+				ctx->byteOffset = byteOffset;
+				return std::make_shared<ReadTask>(ctx, std::dynamic_pointer_cast<ReadBackBuffer>(shared_from_this()));
+			}
+			std::shared_ptr<BaseTask> CreateInitializationTask() override
+			{
+				return BaseTask::kEmpty;
+			}
+
+			std::vector<std::uint8_t> data;
+			std::size_t synchronizedReadsCount = 0;
+		};
+
+		class SourceBuffer final : public Core::ResidentBuffer
+		{
+		public:
+			SourceBuffer(const Settings& settings) : Core::ResidentBuffer(settings), data(settings.byteLength)
+			{
+				std::iota(data.begin(), data.end(), static_cast<std::uint8_t>(0));
+			}
+			std::shared_ptr<BaseTask> CreateCopyToBufferTask(const std::shared_ptr<Core::Buffer>& dst, std::size_t byteLength, std::size_t srcByteOffset, std::size_t dstByteOffset) const override
+			{
+				const auto src = std::dynamic_pointer_cast<const SourceBuffer>(shared_from_this());
+				const auto dstBuffer = std::dynamic_pointer_cast<ReadBackBuffer>(dst);
+
+				return std::make_shared<FunctionalTask>(
+					FunctionalTask::Handler {},
+					[src, dstBuffer, byteLength, srcByteOffset, dstByteOffset](const auto&)
+					{
+						std::memcpy(dstBuffer->data.data() + dstByteOffset, src->data.data() + srcByteOffset, byteLength);
+					},
+					FunctionalTask::Handler {}
+				);
+			}
+			std::shared_ptr<BaseTask> CreateInitializationTask() override
+			{
+				return BaseTask::kEmpty;
+			}
+
+			std::vector<std::uint8_t> data;
+		};
+
+		ReadBackQueue(const Settings& settings) : Core::ReadBackQueue(settings)
+		{
+		}
+
+		std::vector<std::shared_ptr<ReadBackBuffer>> buffers;
+	protected:
+		std::shared_ptr<Core::ReadBackBuffer> CreateReadBackBuffer(std::size_t byteLength) override
+		{
+			buffers.push_back(std::make_shared<ReadBackBuffer>(Core::Buffer::Settings { byteLength }));
+			return buffers.back();
+		}
+	};
+
+	class ReadBackQueueTests : public testing::Test
+	{
+	protected:
+		std::shared_ptr<ReadBackStream> _stream;
+		std::shared_ptr<ReadBackQueue> _queue;
+		std::shared_ptr<ReadBackQueue::SourceBuffer> _source;
+
+		inline void SetUp() override
+		{
+			_stream = std::make_shared<ReadBackStream>();
+			_queue = std::make_shared<ReadBackQueue>(ReadBackQueue::Settings { 2, 64 });
+			_source = std::make_shared<ReadBackQueue::SourceBuffer>(Core::Buffer::Settings { 256 });
+
+			_stream->Restart();
+			_stream->Schedule(_queue->CreateInitializationTask());
+			_stream->SubmitAndWait();
+		}
+
+		inline void RunFrame(bool waitAfterSubmit = true)
+		{
+			_stream->Restart();
+			_stream->Schedule(_queue->CreateFrameTask());
+			_stream->Submit();
+
+			if (waitAfterSubmit)
+			{
+				_stream->Wait();
+			}
+		}
+	};
+
+	TEST_F(ReadBackQueueTests, DeliversResultsInLaterFrame)
+	{
+		std::vector<std::uint8_t> callbackResult;
+		_queue->Enqueue(_source, 8, 100, [&callbackResult](const void* data, std::size_t byteLength)
+		{
+			const auto bytes = static_cast<const std::uint8_t*>(data);
+			callbackResult.assign(bytes, bytes + byteLength);
+		});
+		auto future = _queue->Enqueue(_source, 4, 10);
+
+		RunFrame(false);
+
+		ASSERT_EQ(_queue->GetPendingRequestsCount(), 0);
+		ASSERT_EQ(_queue->GetFramesInFlightCount(), 1);
+		ASSERT_TRUE(callbackResult.empty());
+
+		_stream->Wait();
+		RunFrame();
+
+		ASSERT_EQ(_queue->GetFramesInFlightCount(), 0);
+		ASSERT_EQ(callbackResult, std::vector<std::uint8_t>(_source->data.begin() + 100, _source->data.begin() + 108));
+		ASSERT_EQ(future.get(), std::vector<std::uint8_t>(_source->data.begin() + 10, _source->data.begin() + 14));
+
+		for (const auto& buffer : _queue->buffers)
+		{
+			ASSERT_EQ(buffer->synchronizedReadsCount, 0);
+		}
+	}
+
+	TEST_F(ReadBackQueueTests, SpreadsRequestsAcrossRing)
+	{
+		std::vector<std::future<std::vector<std::uint8_t>>> futures;
+
+		for (std::size_t i = 0; i < 5; ++i)
+		{
+			futures.push_back(_queue->Enqueue(_source, 40, i * 40));
+		}
+
+		RunFrame();
+		ASSERT_EQ(_queue->GetPendingRequestsCount(), 4);
+
+		RunFrame();
+		ASSERT_EQ(_queue->GetPendingRequestsCount(), 3);
+		ASSERT_EQ(futures[0].wait_for(std::chrono::seconds(0)), std::future_status::ready);
+		ASSERT_NE(futures[1].wait_for(std::chrono::seconds(0)), std::future_status::ready);
+
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			RunFrame();
+		}
+
+		ASSERT_EQ(_queue->GetPendingRequestsCount(), 0);
+		ASSERT_EQ(_queue->GetFramesInFlightCount(), 0);
+
+		for (std::size_t i = 0; i < futures.size(); ++i)
+		{
+			ASSERT_EQ(futures[i].get(), std::vector<std::uint8_t>(_source->data.begin() + i * 40, _source->data.begin() + (i + 1) * 40));
+		}
+	}
+}
@@ -0,0 +1,121 @@
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <gtest/gtest.h>
+#include <Core/ThreadPool.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class ThreadPoolTests : public testing::Test
+	{
+	protected:
+		std::unique_ptr<ThreadPool> _pool;
+
+		inline void SetUp() override
+		{
+			testing::Test::SetUp();
+			_pool = std::make_unique<ThreadPool>(4);
+		}
+
+		inline void TearDown() override
+		{
+			_pool.reset();
+			testing::Test::TearDown();
+		}
+	};
+
+	TEST_F(ThreadPoolTests, SubmitReturnsResults)
+	{
+		std::vector<std::future<std::size_t>> futures;
+
+		for (std::size_t i = 0; i < 64; ++i)
+		{
+			futures.push_back(_pool->Submit([i]()
+			{
+				return i * i;
+			}));
+		}
+
+		for (std::size_t i = 0; i < futures.size(); ++i)
+		{
+			ASSERT_EQ(futures[i].get(), i * i);
+		}
+	}
+
+	TEST_F(ThreadPoolTests, ParallelForCoversRangeOnce)
+	{
+		constexpr std::size_t count = 10007;
+		std::vector<std::atomic<std::uint32_t>> visits(count);
+
+		_pool->ParallelFor(count, 64, [&visits](std::size_t from, std::size_t to)
+		{
+			for (auto i = from; i < to; ++i)
+			{
+				visits[i].fetch_add(1);
+			}
+		});
+
+		for (const auto& v : visits)
+		{
+			ASSERT_EQ(v.load(), 1U);
+		}
+	}
+
+	TEST_F(ThreadPoolTests, ParallelForFromPoolJobs)
+	{
+		constexpr std::size_t jobCount = 16;
+		constexpr std::size_t count = 4096;
+		std::vector<std::future<std::size_t>> futures;
+
+		for (std::size_t j = 0; j < jobCount; ++j)
+		{
+			futures.push_back(_pool->Submit([this]()
+			{
+				std::atomic<std::size_t> sum = 0;
+
+				_pool->ParallelFor(count, 16, [&sum](std::size_t from, std::size_t to)
+				{
+					for (auto i = from; i < to; ++i)
+					{
+						sum.fetch_add(i);
+					}
+				});
+
+				return sum.load();
+			}));
+		}
+
+		for (auto& f : futures)
+		{
+			ASSERT_EQ(f.get(), count * (count - 1) / 2);
+		}
+	}
+
+	TEST_F(ThreadPoolTests, ParallelForWaitsForBatchesBeforeRethrowing)
+	{
+		constexpr std::size_t count = 4096;
+
+		for (const auto throwingBatchStart : { std::size_t { 0 }, count - 1 })
+		{
+			std::atomic<std::size_t> visited = 0;
+
+			ASSERT_THROW(_pool->ParallelFor(count, 64, [&visited, throwingBatchStart](std::size_t from, std::size_t to)
+			{
+				if (from <= throwingBatchStart && throwingBatchStart < to)
+				{
+					throw std::runtime_error("batch failed");
+				}
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				visited.fetch_add(to - from);
+			}), std::runtime_error);
+
+			ASSERT_GT(visited.load(), 0U);
+			ASSERT_LT(visited.load(), count);
+
+			const auto settled = visited.load();
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			ASSERT_EQ(visited.load(), settled);
+		}
+	}
+}
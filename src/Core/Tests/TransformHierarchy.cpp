@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <Core/TransformHierarchy.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class TransformHierarchyTests : public testing::Test
+	{
+	protected:
+		DefaultMath _math;
+		std::unique_ptr<ThreadPool> _pool;
+		std::vector<std::shared_ptr<Node>> _nodes;
+
+		inline void SetUp() override
+		{
+			testing::Test::SetUp();
+			_pool = std::make_unique<ThreadPool>(4);
+
+			for (std::size_t i = 0; i < 2000; ++i)
+			{
+				const auto node = std::make_shared<Node>();
+				const auto f = static_cast<std::float_t>(i % 17);
+
+				node->localTransform.position = { f * 0.5f, -f, 1.0f + f * 0.25f };
+				node->localTransform.scale = { 1.0f + f * 0.01f, 1.0f, 1.0f - f * 0.01f };
+				_math.RotationAroundAxis(node->localTransform.rotation, { 1.0f, f, 2.0f }, Math::ConvertDegreesToRadians(f * 5.0f));
+
+				if (i > 0)
+				{
+					_nodes[(i - 1) / 3]->AddChild(node);
+				}
+
+				_nodes.push_back(node);
+			}
+		}
+
+		inline void TearDown() override
+		{
+			_pool.reset();
+			testing::Test::TearDown();
+		}
+
+		inline void CheckWorldMatrices(const TransformHierarchy& hierarchy) const
+		{
+			for (const auto& node : _nodes)
+			{
+				const auto index = hierarchy.GetIndex(node);
+				ASSERT_TRUE(index.has_value());
+
+				Matrix4x4 expected {};
+				_math.CalculateLocalToWorldSpaceMatrix(expected, node);
+				ASSERT_EQ(hierarchy.GetWorldMatrix(index.value()), expected);
+			}
+		}
+	};
+
+	TEST_F(TransformHierarchyTests, LevelsAreSortedByDepth)
+	{
+		const TransformHierarchy hierarchy { TransformHierarchy::Settings { 16 }, _nodes.front() };
+
+		ASSERT_EQ(hierarchy.GetNodesCount(), _nodes.size());
+		ASSERT_EQ(hierarchy.GetLevelsCount(), 8);
+		ASSERT_EQ(hierarchy.GetParents().front(), TransformHierarchy::kNoParent);
+
+		for (std::size_t i = 2; i < hierarchy.GetParents().size(); ++i)
+		{
+			ASSERT_LT(hierarchy.GetParents()[i], i);
+			ASSERT_LE(hierarchy.GetParents()[i - 1], hierarchy.GetParents()[i]);
+		}
+	}
+
+	TEST_F(TransformHierarchyTests, MatchesPerNodeWorldMatrices)
+	{
+		TransformHierarchy hierarchy { TransformHierarchy::Settings { 16 }, _nodes.front() };
+		hierarchy.Update(_math, *_pool);
+		CheckWorldMatrices(hierarchy);
+
+		_nodes[5]->localTransform.position = { 10.0f, 20.0f, 30.0f };
+		_nodes.front()->localTransform.scale = { 2.0f, 2.0f, 2.0f };
+		hierarchy.Update(_math, *_pool);
+		CheckWorldMatrices(hierarchy);
+	}
+
+	TEST_F(TransformHierarchyTests, RebuildsAfterStructureChanged)
+	{
+		TransformHierarchy hierarchy { TransformHierarchy::Settings { 16 }, _nodes.front() };
+		hierarchy.Update(_math, *_pool);
+
+		_nodes[1]->AddChild(_nodes[1500]);
+		_nodes[1999]->AddChild(_nodes[8]);
+		hierarchy.Update(_math, *_pool);
+
+		ASSERT_EQ(hierarchy.GetNodesCount(), _nodes.size());
+		CheckWorldMatrices(hierarchy);
+
+		_nodes[2]->SetParent(nullptr);
+		hierarchy.Update(_math, *_pool);
+
+		ASSERT_LT(hierarchy.GetNodesCount(), _nodes.size());
+		ASSERT_FALSE(hierarchy.GetIndex(_nodes[2]).has_value());
+	}
+}
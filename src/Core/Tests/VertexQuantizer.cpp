@@ -0,0 +1,80 @@
+#include <cmath>
+#include <gtest/gtest.h>
+#include <Core/VertexQuantizer.hpp>
+
+namespace MMPEngine::Core::Tests
+{
+	class VertexQuantizerTests : public testing::Test
+	{
+	};
+
+	TEST_F(VertexQuantizerTests, ConvertsScalars)
+	{
+		for (const auto value : { 0.0f, 1.0f, -2.5f, 0.333f, 65504.0f, 6.1035156e-05f, 5.9604645e-08f })
+		{
+			const auto restored = VertexQuantizer::HalfToFloat(VertexQuantizer::FloatToHalf(value));
+			ASSERT_LE(std::abs(restored - value), std::abs(value) * 0.0005f);
+		}
+
+		ASSERT_EQ(VertexQuantizer::FloatToHalf(1.0f), 0x3C00);
+		ASSERT_EQ(VertexQuantizer::FloatToHalf(-2.0f), 0xC000);
+		ASSERT_EQ(VertexQuantizer::FloatToHalf(100000.0f), 0x7C00);
+		ASSERT_TRUE(std::isnan(VertexQuantizer::HalfToFloat(VertexQuantizer::FloatToHalf(std::nanf("")))));
+
+		ASSERT_EQ(VertexQuantizer::FloatToSnorm<std::int8_t>(-1.0f), -127);
+		ASSERT_EQ(VertexQuantizer::FloatToSnorm<std::int16_t>(2.0f), 32767);
+		ASSERT_EQ(VertexQuantizer::SnormToFloat<std::int8_t>(-128), -1.0f);
+		ASSERT_EQ(VertexQuantizer::FloatToUnorm<std::uint8_t>(0.5f), 128);
+		ASSERT_EQ(VertexQuantizer::UnormToFloat<std::uint16_t>(65535), 1.0f);
+
+		const auto packed = VertexQuantizer::PackUnorm10_10_10_2({ 1.0f, 0.0f, 0.5f, 1.0f });
+		ASSERT_EQ(packed.value & 0x3FFu, 0x3FFu);
+		ASSERT_EQ(packed.value >> 30, 3u);
+
+		const auto unpacked = VertexQuantizer::UnpackUnorm10_10_10_2(packed);
+		ASSERT_NEAR(unpacked.z, 0.5f, 0.5f / 1023.0f);
+	}
+
+	TEST_F(VertexQuantizerTests, QuantizesPrototypeWithinBound)
+	{
+		GeometryPrototype proto;
+		auto positions = std::make_unique<VertexBufferPrototypeFloat3>(VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::Position }, {} });
+		auto normals = std::make_unique<VertexBufferPrototypeFloat3>(VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::Normal }, {} });
+		auto uvs = std::make_unique<VertexBufferPrototypeFloat2>(VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::UV }, {} });
+		auto colors = std::make_unique<VertexBufferPrototypeFloat4>(VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::Color }, {} });
+
+		for (std::uint32_t i = 0; i < 256; ++i)
+		{
+			const auto angle = static_cast<std::float_t>(i) * 0.1f;
+			positions->data.push_back({ std::cos(angle) * 10.0f, std::sin(angle) * 10.0f, static_cast<std::float_t>(i) });
+			normals->data.push_back({ std::cos(angle), std::sin(angle), 0.0f });
+			uvs->data.push_back({ static_cast<std::float_t>(i) / 255.0f, 1.0f - static_cast<std::float_t>(i) / 255.0f });
+			colors->data.push_back({ 1.0f, 0.5f, static_cast<std::float_t>(i) / 255.0f, 1.0f });
+		}
+
+		auto rejected = std::make_unique<VertexBufferPrototypeFloat4>(VertexBufferPrototype::Settings { { VertexBufferPrototype::Semantics::BlendWeight }, {} });
+		rejected->data.assign(256, { 2.0f, 0.0f, 0.0f, 0.0f });
+
+		proto.vertexBuffers.push_back(std::move(positions));
+		proto.vertexBuffers.push_back(std::move(normals));
+		proto.vertexBuffers.push_back(std::move(uvs));
+		proto.vertexBuffers.push_back(std::move(colors));
+		proto.vertexBuffers.push_back(std::move(rejected));
+
+		const VertexQuantizer::Settings settings {};
+		const auto statistics = VertexQuantizer::Quantize(proto, settings);
+
+		ASSERT_EQ(statistics.quantizedStreams, 3);
+		ASSERT_EQ(statistics.rejectedStreams, 1);
+		ASSERT_LE(statistics.maxError, settings.maxError);
+		ASSERT_LT(statistics.byteLengthAfter, statistics.byteLengthBefore);
+
+		ASSERT_EQ(proto.vertexBuffers[0]->GetFormat(), VertexBufferPrototype::Format::Float3);
+		ASSERT_EQ(proto.vertexBuffers[1]->GetFormat(), VertexBufferPrototype::Format::Snorm8x4);
+		ASSERT_EQ(proto.vertexBuffers[1]->GetStride(), 4);
+		ASSERT_EQ(proto.vertexBuffers[1]->GetVBSettings().semantics, VertexBufferPrototype::Semantics::Normal);
+		ASSERT_EQ(proto.vertexBuffers[2]->GetFormat(), VertexBufferPrototype::Format::Half2);
+		ASSERT_EQ(proto.vertexBuffers[3]->GetFormat(), VertexBufferPrototype::Format::Unorm8x4);
+		ASSERT_EQ(proto.vertexBuffers[4]->GetFormat(), VertexBufferPrototype::Format::Float4);
+	}
+}
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <Core/ThreadPool.hpp>
+
+namespace MMPEngine::Core
+{
+	ThreadPool::ThreadPool(std::size_t threadCount) : _stopping(false)
+	{
+		if (threadCount == 0)
+		{
+			threadCount = std::max<std::size_t>(1, static_cast<std::size_t>(std::thread::hardware_concurrency()) - 1);
+		}
+
+		_threads.reserve(threadCount);
+
+		for (std::size_t i = 0; i < threadCount; ++i)
+		{
+			_threads.emplace_back(&ThreadPool::WorkerLoop, this);
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+		}
+
+		_condition.notify_all();
+
+		for (auto& t : _threads)
+		{
+			t.join();
+		}
+	}
+
+	ThreadPool& ThreadPool::GetShared()
+	{
+		static ThreadPool pool {};
+		return pool;
+	}
+
+	std::size_t ThreadPool::GetThreadCount() const
+	{
+		return _threads.size();
+	}
+
+	void ThreadPool::Enqueue(std::function<void()>&& job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_jobs.push(std::move(job));
+		}
+
+		_condition.notify_one();
+	}
+
+	bool ThreadPool::TryRunPendingJob()
+	{
+		std::function<void()> job;
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			if (_jobs.empty())
+			{
+				return false;
+			}
+
+			job = std::move(_jobs.front());
+			_jobs.pop();
+		}
+
+		job();
+		return true;
+	}
+
+	void ThreadPool::WorkerLoop()
+	{
+		while (true)
+		{
+			std::function<void()> job;
+
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_condition.wait(lock, [this]()
+				{
+					return _stopping || !_jobs.empty();
+				});
+
+				if (_jobs.empty())
+				{
+					return;
+				}
+
+				job = std::move(_jobs.front());
+				_jobs.pop();
+			}
+
+			job();
+		}
+	}
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace MMPEngine::Core
+{
+	class ThreadPool final
+	{
+	public:
+		ThreadPool(std::size_t threadCount = 0);
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) noexcept = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+		~ThreadPool();
+
+		template<typename TFunc>
+		std::future<std::invoke_result_t<std::decay_t<TFunc>>> Submit(TFunc&& func);
+
+		template<typename TFunc, typename = std::enable_if_t<std::is_invocable_v<TFunc, std::size_t, std::size_t>>>
+		void ParallelFor(std::size_t count, std::size_t minBatchSize, const TFunc& func);
+
+		std::size_t GetThreadCount() const;
+		static ThreadPool& GetShared();
+	private:
+		void Enqueue(std::function<void()>&& job);
+		bool TryRunPendingJob();
+		void WorkerLoop();
+
+		std::vector<std::thread> _threads;
+		std::queue<std::function<void()>> _jobs;
+		std::mutex _mutex;
+		std::condition_variable _condition;
+		bool _stopping;
+	};
+
+	template<typename TFunc>
+	inline std::future<std::invoke_result_t<std::decay_t<TFunc>>> ThreadPool::Submit(TFunc&& func)
+	{
+		using TResult = std::invoke_result_t<std::decay_t<TFunc>>;
+
+		const auto task = std::make_shared<std::packaged_task<TResult()>>(std::forward<TFunc>(func));
+		auto future = task->get_future();
+		Enqueue([task]()
+		{
+			(*task)();
+		});
+		return future;
+	}
+
+	template<typename TFunc, typename>
+	inline void ThreadPool::ParallelFor(std::size_t count, std::size_t minBatchSize, const TFunc& func)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		const auto batchCount = std::min((count + std::max<std::size_t>(minBatchSize, 1) - 1) / std::max<std::size_t>(minBatchSize, 1), GetThreadCount() + 1);
+
+		if (batchCount <= 1)
+		{
+			func(0, count);
+			return;
+		}
+
+		const auto batchSize = (count + batchCount - 1) / batchCount;
+		std::vector<std::future<void>> futures;
+		futures.reserve(batchCount - 1);
+
+		for (std::size_t b = 1; b < batchCount; ++b)
+		{
+			const auto from = b * batchSize;
+			const auto to = std::min(from + batchSize, count);
+
+			if (from < to)
+			{
+				futures.push_back(Submit([&func, from, to]()
+				{
+					func(from, to);
+				}));
+			}
+		}
+
+		std::exception_ptr exception;
+
+		try
+		{
+			func(0, std::min(batchSize, count));
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+
+		for (auto& f : futures)
+		{
+			while (f.wait_for(std::chrono::seconds::zero()) != std::future_status::ready)
+			{
+				if (!TryRunPendingJob())
+				{
+					f.wait();
+				}
+			}
+
+			try
+			{
+				f.get();
+			}
+			catch (...)
+			{
+				if (!exception)
+				{
+					exception = std::current_exception();
+				}
+			}
+		}
+
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+	}
+}
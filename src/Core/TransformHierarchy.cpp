@@ -0,0 +1,148 @@
+#include <Core/TransformHierarchy.hpp>
+#include <atomic>
+#include <cassert>
+
+namespace MMPEngine::Core
+{
+	TransformHierarchy::TransformHierarchy(const Settings& settings, const std::shared_ptr<Node>& root) : _settings(settings), _root(root)
+	{
+		assert(_root);
+		Rebuild();
+	}
+
+	TransformHierarchy::~TransformHierarchy() = default;
+
+	void TransformHierarchy::Rebuild()
+	{
+		_nodes.clear();
+		_parents.clear();
+		_levelOffsets.clear();
+		_indices.clear();
+
+		_nodes.push_back(_root);
+		_parents.push_back(kNoParent);
+		_levelOffsets.push_back(0);
+
+		std::size_t levelBegin = 0;
+
+		while (levelBegin < _nodes.size())
+		{
+			const auto levelEnd = _nodes.size();
+
+			for (auto i = levelBegin; i < levelEnd; ++i)
+			{
+				for (const auto& child : _nodes[i]->_children)
+				{
+					_nodes.push_back(child);
+					_parents.push_back(static_cast<std::uint32_t>(i));
+				}
+			}
+
+			_levelOffsets.push_back(levelEnd);
+			levelBegin = levelEnd;
+		}
+
+		_childrenCounts.resize(_nodes.size());
+		_localMatrices.resize(_nodes.size());
+		_worldMatrices.resize(_nodes.size());
+		_indices.reserve(_nodes.size());
+
+		for (std::size_t i = 0; i < _nodes.size(); ++i)
+		{
+			_childrenCounts[i] = _nodes[i]->_children.size();
+			_indices.emplace(_nodes[i].get(), i);
+		}
+	}
+
+	bool TransformHierarchy::Gather(const Math& math, ThreadPool& threadPool)
+	{
+		std::atomic<bool> structureChanged { false };
+
+		threadPool.ParallelFor(_nodes.size(), _settings.minBatchSize, [this, &math, &structureChanged](std::size_t from, std::size_t to)
+		{
+			for (auto i = from; i < to; ++i)
+			{
+				const auto node = _nodes[i].get();
+
+				if (node->_children.size() != _childrenCounts[i] || (i > 0 && node->_parent.get() != _nodes[_parents[i]].get()))
+				{
+					structureChanged.store(true, std::memory_order_relaxed);
+					return;
+				}
+
+				math.TRS(_localMatrices[i], node->localTransform);
+			}
+		});
+
+		return !structureChanged.load(std::memory_order_relaxed);
+	}
+
+	void TransformHierarchy::Update(const Math& math, ThreadPool& threadPool)
+	{
+		if (!Gather(math, threadPool))
+		{
+			Rebuild();
+			const auto gathered = Gather(math, threadPool);
+			assert(gathered);
+		}
+
+		math.CalculateLocalToWorldSpaceMatrix(_worldMatrices.front(), _root);
+
+		for (std::size_t level = 1; level < GetLevelsCount(); ++level)
+		{
+			const auto levelBegin = _levelOffsets[level];
+			const auto levelSize = _levelOffsets[level + 1] - levelBegin;
+
+			threadPool.ParallelFor(levelSize, _settings.minBatchSize, [this, &math, levelBegin](std::size_t from, std::size_t to)
+			{
+				for (auto i = levelBegin + from; i < levelBegin + to; ++i)
+				{
+					math.Multiply(_worldMatrices[i], _worldMatrices[_parents[i]], _localMatrices[i]);
+				}
+			});
+		}
+	}
+
+	std::size_t TransformHierarchy::GetNodesCount() const
+	{
+		return _nodes.size();
+	}
+
+	std::size_t TransformHierarchy::GetLevelsCount() const
+	{
+		return _levelOffsets.size() - 1;
+	}
+
+	std::optional<std::size_t> TransformHierarchy::GetIndex(const std::shared_ptr<const Node>& node) const
+	{
+		return GetIndex(node.get());
+	}
+
+	std::optional<std::size_t> TransformHierarchy::GetIndex(const Node* node) const
+	{
+		const auto it = _indices.find(node);
+
+		if (it == _indices.cend())
+		{
+			return std::nullopt;
+		}
+
+		return it->second;
+	}
+
+	const Matrix4x4& TransformHierarchy::GetWorldMatrix(std::size_t index) const
+	{
+		assert(index < _worldMatrices.size());
+		return _worldMatrices[index];
+	}
+
+	const std::vector<Matrix4x4>& TransformHierarchy::GetWorldMatrices() const
+	{
+		return _worldMatrices;
+	}
+
+	const std::vector<std::uint32_t>& TransformHierarchy::GetParents() const
+	{
+		return _parents;
+	}
+}
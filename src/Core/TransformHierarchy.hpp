@@ -0,0 +1,52 @@
+#pragma once
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <Core/Node.hpp>
+#include <Core/Math.hpp>
+#include <Core/ThreadPool.hpp>
+
+namespace MMPEngine::Core
+{
+	class TransformHierarchy final
+	{
+	public:
+		struct Settings final
+		{
+			std::size_t minBatchSize = 1024;
+		};
+
+		static constexpr auto kNoParent = (std::numeric_limits<std::uint32_t>::max)();
+
+		TransformHierarchy(const Settings& settings, const std::shared_ptr<Node>& root);
+		TransformHierarchy(const TransformHierarchy&) = delete;
+		TransformHierarchy(TransformHierarchy&&) noexcept = delete;
+		TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+		TransformHierarchy& operator=(TransformHierarchy&&) noexcept = delete;
+		~TransformHierarchy();
+
+		void Update(const Math& math, ThreadPool& threadPool = ThreadPool::GetShared());
+		void Rebuild();
+
+		std::size_t GetNodesCount() const;
+		std::size_t GetLevelsCount() const;
+		std::optional<std::size_t> GetIndex(const Node* node) const;
+		std::optional<std::size_t> GetIndex(const std::shared_ptr<const Node>& node) const;
+		const Matrix4x4& GetWorldMatrix(std::size_t index) const;
+		const std::vector<Matrix4x4>& GetWorldMatrices() const;
+		const std::vector<std::uint32_t>& GetParents() const;
+	private:
+		bool Gather(const Math& math, ThreadPool& threadPool);
+
+		Settings _settings;
+		std::shared_ptr<Node> _root;
+		std::vector<std::shared_ptr<Node>> _nodes;
+		std::vector<std::size_t> _childrenCounts;
+		std::vector<std::uint32_t> _parents;
+		std::vector<Matrix4x4> _localMatrices;
+		std::vector<Matrix4x4> _worldMatrices;
+		std::vector<std::size_t> _levelOffsets;
+		std::unordered_map<const Node*, std::size_t> _indices;
+	};
+}
@@ -0,0 +1,330 @@
+#include <Core/VertexQuantizer.hpp>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace MMPEngine::Core
+{
+	namespace
+	{
+		template<typename TStream, typename TEncode, typename TDecode>
+		std::unique_ptr<VertexBufferPrototype> EncodeStream(const VertexBufferPrototype& source, const std::vector<Vector4Float>& values, std::size_t componentsCount, const TEncode& encode, const TDecode& decode, std::float_t& maxError)
+		{
+			auto stream = std::make_unique<TStream>(VertexBufferPrototype::Settings { source.GetVBSettings(), source.GetSettings() });
+			stream->data.reserve(values.size());
+			maxError = 0.0f;
+
+			for (const auto& value : values)
+			{
+				const auto encoded = encode(value);
+				const auto decoded = decode(encoded);
+				stream->data.push_back(encoded);
+
+				const std::float_t original[] = { value.x, value.y, value.z, value.w };
+				const std::float_t restored[] = { decoded.x, decoded.y, decoded.z, decoded.w };
+
+				for (std::size_t c = 0; c < componentsCount; ++c)
+				{
+					maxError = std::max(maxError, std::abs(original[c] - restored[c]));
+				}
+			}
+
+			return stream;
+		}
+	}
+
+	bool VertexQuantizer::IsQuantized(VertexBufferPrototype::Format format)
+	{
+		switch (format)
+		{
+		case VertexBufferPrototype::Format::Float1:
+		case VertexBufferPrototype::Format::Float2:
+		case VertexBufferPrototype::Format::Float3:
+		case VertexBufferPrototype::Format::Float4:
+		case VertexBufferPrototype::Format::Uint4:
+			return false;
+		default:
+			return true;
+		}
+	}
+
+	std::size_t VertexQuantizer::GetComponentsCount(VertexBufferPrototype::Format format)
+	{
+		switch (format)
+		{
+		case VertexBufferPrototype::Format::Float1:
+			return 1;
+		case VertexBufferPrototype::Format::Float2:
+		case VertexBufferPrototype::Format::Half2:
+		case VertexBufferPrototype::Format::Snorm16x2:
+		case VertexBufferPrototype::Format::Unorm16x2:
+			return 2;
+		case VertexBufferPrototype::Format::Float3:
+			return 3;
+		case VertexBufferPrototype::Format::Float4:
+		case VertexBufferPrototype::Format::Uint4:
+		case VertexBufferPrototype::Format::Half4:
+		case VertexBufferPrototype::Format::Snorm8x4:
+		case VertexBufferPrototype::Format::Unorm8x4:
+		case VertexBufferPrototype::Format::Snorm16x4:
+		case VertexBufferPrototype::Format::Unorm16x4:
+		case VertexBufferPrototype::Format::Unorm10_10_10_2:
+			return 4;
+		default:
+			throw UnsupportedException("unsupported vertex buffer format");
+		}
+	}
+
+	std::uint16_t VertexQuantizer::FloatToHalf(std::float_t value)
+	{
+		std::uint32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+
+		const auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+		const auto abs = bits & 0x7FFFFFFFu;
+
+		if (abs >= 0x7F800000u)
+		{
+			return static_cast<std::uint16_t>(sign | (abs > 0x7F800000u ? 0x7E00u : 0x7C00u));
+		}
+
+		if (abs >= 0x477FF000u)
+		{
+			return static_cast<std::uint16_t>(sign | 0x7C00u);
+		}
+
+		if (abs < 0x38800000u)
+		{
+			if (abs < 0x33000000u)
+			{
+				return sign;
+			}
+
+			const auto mantissa = (abs & 0x007FFFFFu) | 0x00800000u;
+			const auto shift = 126u - (abs >> 23);
+			auto result = mantissa >> shift;
+			const auto remainder = mantissa & ((1u << shift) - 1u);
+			const auto halfway = 1u << (shift - 1u);
+
+			if (remainder > halfway || (remainder == halfway && (result & 1u)))
+			{
+				++result;
+			}
+
+			return static_cast<std::uint16_t>(sign | result);
+		}
+
+		auto result = (abs - 0x38000000u) >> 13;
+		const auto remainder = abs & 0x1FFFu;
+
+		if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1u)))
+		{
+			++result;
+		}
+
+		return static_cast<std::uint16_t>(sign | result);
+	}
+
+	std::float_t VertexQuantizer::HalfToFloat(std::uint16_t value)
+	{
+		const auto sign = static_cast<std::uint32_t>(value & 0x8000u) << 16;
+		const auto exponent = (value >> 10) & 0x1Fu;
+		const auto mantissa = static_cast<std::uint32_t>(value & 0x3FFu);
+
+		if (exponent == 0)
+		{
+			const auto result = std::ldexp(static_cast<std::float_t>(mantissa), -24);
+			return sign ? -result : result;
+		}
+
+		std::uint32_t bits;
+
+		if (exponent == 0x1Fu)
+		{
+			bits = sign | 0x7F800000u | (mantissa << 13);
+		}
+		else
+		{
+			bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+		}
+
+		std::float_t result;
+		std::memcpy(&result, &bits, sizeof(result));
+		return result;
+	}
+
+	PackedUnorm10_10_10_2 VertexQuantizer::PackUnorm10_10_10_2(const Vector4Float& value)
+	{
+		const auto pack = [](std::float_t component, std::uint32_t maxValue)
+		{
+			return static_cast<std::uint32_t>(std::lround(std::clamp(component, 0.0f, 1.0f) * static_cast<std::float_t>(maxValue)));
+		};
+
+		return { pack(value.x, 0x3FFu) | (pack(value.y, 0x3FFu) << 10) | (pack(value.z, 0x3FFu) << 20) | (pack(value.w, 0x3u) << 30) };
+	}
+
+	Vector4Float VertexQuantizer::UnpackUnorm10_10_10_2(PackedUnorm10_10_10_2 value)
+	{
+		return {
+			static_cast<std::float_t>(value.value & 0x3FFu) / 1023.0f,
+			static_cast<std::float_t>((value.value >> 10) & 0x3FFu) / 1023.0f,
+			static_cast<std::float_t>((value.value >> 20) & 0x3FFu) / 1023.0f,
+			static_cast<std::float_t>((value.value >> 30) & 0x3u) / 3.0f
+		};
+	}
+
+	std::vector<Vector4Float> VertexQuantizer::ReadFloatStream(const VertexBufferPrototype& source)
+	{
+		std::vector<Vector4Float> values {};
+		values.reserve(source.GetElementsCount());
+
+		switch (source.GetFormat())
+		{
+		case VertexBufferPrototype::Format::Float1:
+			for (const auto v : dynamic_cast<const VertexBufferPrototypeFloat1&>(source).data)
+			{
+				values.push_back({ v, 0.0f, 0.0f, 0.0f });
+			}
+			break;
+		case VertexBufferPrototype::Format::Float2:
+			for (const auto& v : dynamic_cast<const VertexBufferPrototypeFloat2&>(source).data)
+			{
+				values.push_back({ v.x, v.y, 0.0f, 0.0f });
+			}
+			break;
+		case VertexBufferPrototype::Format::Float3:
+			for (const auto& v : dynamic_cast<const VertexBufferPrototypeFloat3&>(source).data)
+			{
+				values.push_back({ v.x, v.y, v.z, 0.0f });
+			}
+			break;
+		case VertexBufferPrototype::Format::Float4:
+			values = dynamic_cast<const VertexBufferPrototypeFloat4&>(source).data;
+			break;
+		default:
+			throw UnsupportedException("only float vertex streams can be quantized");
+		}
+
+		return values;
+	}
+
+	std::unique_ptr<VertexBufferPrototype> VertexQuantizer::Quantize(const VertexBufferPrototype& source, VertexBufferPrototype::Format format, std::float_t& maxError)
+	{
+		const auto values = ReadFloatStream(source);
+		const auto componentsCount = GetComponentsCount(source.GetFormat());
+
+		if (GetComponentsCount(format) < componentsCount)
+		{
+			throw UnsupportedException("quantized vertex format has fewer components than source stream");
+		}
+
+		switch (format)
+		{
+		case VertexBufferPrototype::Format::Half2:
+			return EncodeStream<VertexBufferPrototypeHalf2>(source, values, componentsCount,
+				[](const Vector4Float& v) { return Vector2Half { FloatToHalf(v.x), FloatToHalf(v.y) }; },
+				[](const Vector2Half& v) { return Vector4Float { HalfToFloat(v.x), HalfToFloat(v.y), 0.0f, 0.0f }; },
+				maxError);
+		case VertexBufferPrototype::Format::Half4:
+			return EncodeStream<VertexBufferPrototypeHalf4>(source, values, componentsCount,
+				[](const Vector4Float& v) { return Vector4Half { FloatToHalf(v.x), FloatToHalf(v.y), FloatToHalf(v.z), FloatToHalf(v.w) }; },
+				[](const Vector4Half& v) { return Vector4Float { HalfToFloat(v.x), HalfToFloat(v.y), HalfToFloat(v.z), HalfToFloat(v.w) }; },
+				maxError);
+		case VertexBufferPrototype::Format::Snorm8x4:
+			return EncodeStream<VertexBufferPrototypeSnorm8x4>(source, values, componentsCount,
+				[](const Vector4Float& v) { return Vector4Snorm8 { FloatToSnorm<std::int8_t>(v.x), FloatToSnorm<std::int8_t>(v.y), FloatToSnorm<std::int8_t>(v.z), FloatToSnorm<std::int8_t>(v.w) }; },
+				[](const Vector4Snorm8& v) { return Vector4Float { SnormToFloat(v.x), SnormToFloat(v.y), SnormToFloat(v.z), SnormToFloat(v.w) }; },
+				maxError);
+		case VertexBufferPrototype::Format::Unorm8x4:
+			return EncodeStream<VertexBufferPrototypeUnorm8x4>(source, values, componentsCount,
+				[](const Vector4Float& v) { return Vector4Unorm8 { FloatToUnorm<std::uint8_t>(v.x), FloatToUnorm<std::uint8_t>(v.y), FloatToUnorm<std::uint8_t>(v.z), FloatToUnorm<std::uint8_t>(v.w) }; },
+				[](const Vector4Unorm8& v) { return Vector4Float { UnormToFloat(v.x), UnormToFloat(v.y), UnormToFloat(v.z), UnormToFloat(v.w) }; },
+				maxError);
+		case VertexBufferPrototype::Format::Snorm16x2:
+			return EncodeStream<VertexBufferPrototypeSnorm16x2>(source, values, componentsCount,
+				[](const Vector4Float& v) { return Vector2Snorm16 { FloatToSnorm<std::int16_t>(v.x), FloatToSnorm<std::int16_t>(v.y) }; },
+				[](const Vector2Snorm16& v) { return Vector4Float { SnormToFloat(v.x), SnormToFloat(v.y), 0.0f, 0.0f }; },
+				maxError);
+		case VertexBufferPrototype::Format::Snorm16x4:
+			return EncodeStream<VertexBufferPrototypeSnorm16x4>(source, values, componentsCount,
+				[](const Vector4Float& v) { return Vector4Snorm16 { FloatToSnorm<std::int16_t>(v.x), FloatToSnorm<std::int16_t>(v.y), FloatToSnorm<std::int16_t>(v.z), FloatToSnorm<std::int16_t>(v.w) }; },
+				[](const Vector4Snorm16& v) { return Vector4Float { SnormToFloat(v.x), SnormToFloat(v.y), SnormToFloat(v.z), SnormToFloat(v.w) }; },
+				maxError);
+		case VertexBufferPrototype::Format::Unorm16x2:
+			return EncodeStream<VertexBufferPrototypeUnorm16x2>(source, values, componentsCount,
+				[](const Vector4Float& v) { return Vector2Unorm16 { FloatToUnorm<std::uint16_t>(v.x), FloatToUnorm<std::uint16_t>(v.y) }; },
+				[](const Vector2Unorm16& v) { return Vector4Float { UnormToFloat(v.x), UnormToFloat(v.y), 0.0f, 0.0f }; },
+				maxError);
+		case VertexBufferPrototype::Format::Unorm16x4:
+			return EncodeStream<VertexBufferPrototypeUnorm16x4>(source, values, componentsCount,
+				[](const Vector4Float& v) { return Vector4Unorm16 { FloatToUnorm<std::uint16_t>(v.x), FloatToUnorm<std::uint16_t>(v.y), FloatToUnorm<std::uint16_t>(v.z), FloatToUnorm<std::uint16_t>(v.w) }; },
+				[](const Vector4Unorm16& v) { return Vector4Float { UnormToFloat(v.x), UnormToFloat(v.y), UnormToFloat(v.z), UnormToFloat(v.w) }; },
+				maxError);
+		case VertexBufferPrototype::Format::Unorm10_10_10_2:
+			return EncodeStream<VertexBufferPrototypeUnorm10_10_10_2>(source, values, componentsCount,
+				[](const Vector4Float& v) { return PackUnorm10_10_10_2(v); },
+				[](const PackedUnorm10_10_10_2& v) { return UnpackUnorm10_10_10_2(v); },
+				maxError);
+		default:
+			throw UnsupportedException("unsupported quantized vertex buffer format");
+		}
+	}
+
+	VertexBufferPrototype::Format VertexQuantizer::GetTargetFormat(const Settings& settings, VertexBufferPrototype::Semantics semantics)
+	{
+		switch (semantics)
+		{
+		case VertexBufferPrototype::Semantics::Position:
+			return settings.positionFormat;
+		case VertexBufferPrototype::Semantics::Normal:
+			return settings.normalFormat;
+		case VertexBufferPrototype::Semantics::Tangent:
+			return settings.tangentFormat;
+		case VertexBufferPrototype::Semantics::BiNormal:
+			return settings.biNormalFormat;
+		case VertexBufferPrototype::Semantics::UV:
+			return settings.uvFormat;
+		case VertexBufferPrototype::Semantics::Color:
+			return settings.colorFormat;
+		case VertexBufferPrototype::Semantics::BlendWeight:
+			return settings.blendWeightFormat;
+		default:
+			return VertexBufferPrototype::Format::Uint4;
+		}
+	}
+
+	VertexQuantizer::Statistics VertexQuantizer::Quantize(GeometryPrototype& proto, const Settings& settings)
+	{
+		Statistics statistics {};
+
+		for (auto& stream : proto.vertexBuffers)
+		{
+			assert(stream);
+			statistics.byteLengthBefore += stream->GetByteLength();
+
+			const auto target = GetTargetFormat(settings, stream->GetVBSettings().semantics);
+
+			if (IsQuantized(target) && !IsQuantized(stream->GetFormat()) && stream->GetFormat() != VertexBufferPrototype::Format::Uint4
+				&& GetComponentsCount(target) >= GetComponentsCount(stream->GetFormat()))
+			{
+				std::float_t error = 0.0f;
+				auto quantized = Quantize(*stream, target, error);
+
+				if (error <= settings.maxError)
+				{
+					stream = std::move(quantized);
+					statistics.maxError = std::max(statistics.maxError, error);
+					++statistics.quantizedStreams;
+				}
+				else
+				{
+					++statistics.rejectedStreams;
+				}
+			}
+
+			statistics.byteLengthAfter += stream->GetByteLength();
+		}
+
+		return statistics;
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <Core/Geometry.hpp>
+
+namespace MMPEngine::Core
+{
+	class VertexQuantizer final
+	{
+	public:
+		struct Settings final
+		{
+			VertexBufferPrototype::Format positionFormat = VertexBufferPrototype::Format::Float3;
+			VertexBufferPrototype::Format normalFormat = VertexBufferPrototype::Format::Snorm8x4;
+			VertexBufferPrototype::Format tangentFormat = VertexBufferPrototype::Format::Snorm8x4;
+			VertexBufferPrototype::Format biNormalFormat = VertexBufferPrototype::Format::Snorm8x4;
+			VertexBufferPrototype::Format uvFormat = VertexBufferPrototype::Format::Half2;
+			VertexBufferPrototype::Format colorFormat = VertexBufferPrototype::Format::Unorm8x4;
+			VertexBufferPrototype::Format blendWeightFormat = VertexBufferPrototype::Format::Unorm8x4;
+			std::float_t maxError = 0.01f;
+		};
+
+		struct Statistics final
+		{
+			std::size_t byteLengthBefore = 0;
+			std::size_t byteLengthAfter = 0;
+			std::size_t quantizedStreams = 0;
+			std::size_t rejectedStreams = 0;
+			std::float_t maxError = 0.0f;
+		};
+
+		VertexQuantizer() = delete;
+
+		static Statistics Quantize(GeometryPrototype& proto, const Settings& settings);
+		static std::unique_ptr<VertexBufferPrototype> Quantize(const VertexBufferPrototype& source, VertexBufferPrototype::Format format, std::float_t& maxError);
+
+		static bool IsQuantized(VertexBufferPrototype::Format format);
+		static std::size_t GetComponentsCount(VertexBufferPrototype::Format format);
+
+		static std::uint16_t FloatToHalf(std::float_t value);
+		static std::float_t HalfToFloat(std::uint16_t value);
+
+		template<typename TInt>
+		static TInt FloatToSnorm(std::float_t value);
+		template<typename TInt>
+		static std::float_t SnormToFloat(TInt value);
+		template<typename TInt>
+		static TInt FloatToUnorm(std::float_t value);
+		template<typename TInt>
+		static std::float_t UnormToFloat(TInt value);
+
+		static PackedUnorm10_10_10_2 PackUnorm10_10_10_2(const Vector4Float& value);
+		static Vector4Float UnpackUnorm10_10_10_2(PackedUnorm10_10_10_2 value);
+	private:
+		static std::vector<Vector4Float> ReadFloatStream(const VertexBufferPrototype& source);
+		static VertexBufferPrototype::Format GetTargetFormat(const Settings& settings, VertexBufferPrototype::Semantics semantics);
+	};
+
+	template<typename TInt>
+	inline TInt VertexQuantizer::FloatToSnorm(std::float_t value)
+	{
+		static_assert(std::is_signed_v<TInt> && std::is_integral_v<TInt>);
+		constexpr auto scale = static_cast<std::float_t>(std::numeric_limits<TInt>::max());
+		return static_cast<TInt>(std::lround(std::clamp(value, -1.0f, 1.0f) * scale));
+	}
+
+	template<typename TInt>
+	inline std::float_t VertexQuantizer::SnormToFloat(TInt value)
+	{
+		static_assert(std::is_signed_v<TInt> && std::is_integral_v<TInt>);
+		constexpr auto scale = static_cast<std::float_t>(std::numeric_limits<TInt>::max());
+		return std::max(static_cast<std::float_t>(value) / scale, -1.0f);
+	}
+
+	template<typename TInt>
+	inline TInt VertexQuantizer::FloatToUnorm(std::float_t value)
+	{
+		static_assert(std::is_unsigned_v<TInt> && std::is_integral_v<TInt>);
+		constexpr auto scale = static_cast<std::float_t>(std::numeric_limits<TInt>::max());
+		return static_cast<TInt>(std::lround(std::clamp(value, 0.0f, 1.0f) * scale));
+	}
+
+	template<typename TInt>
+	inline std::float_t VertexQuantizer::UnormToFloat(TInt value)
+	{
+		static_assert(std::is_unsigned_v<TInt> && std::is_integral_v<TInt>);
+		constexpr auto scale = static_cast<std::float_t>(std::numeric_limits<TInt>::max());
+		return static_cast<std::float_t>(value) / scale;
+	}
+}
@@ -1,4 +1,5 @@
 #include <Feature/App.hpp>
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <Backend/Shared/Math.hpp>
@@ -235,6 +236,26 @@ namespace MMPEngine::Feature
 		return nullptr;
 	}
 
+	std::shared_ptr<Core::BaseStream> UserApp::GetComputeStream() const
+	{
+		if (const auto root = _rootApp)
+		{
+			return root->GetComputeStream();
+		}
+
+		return nullptr;
+	}
+
+	std::shared_ptr<Core::BaseStream> UserApp::GetTransferStream() const
+	{
+		if (const auto root = _rootApp)
+		{
+			return root->GetTransferStream();
+		}
+
+		return nullptr;
+	}
+
     std::shared_ptr<Feature::Input> UserApp::GetInput() const
     {
 		if (const auto root = _rootApp)
@@ -439,24 +460,47 @@ namespace MMPEngine::Feature
 			vkGetPhysicalDeviceQueueFamilyProperties(physicalDevices[selectedDeviceProps.value().first], &queueFamilyCount, queueFamilies.data());
 
 			std::optional<std::size_t> queueFamilyIndex = std::nullopt;
+			std::optional<std::size_t> computeQueueFamilyIndex = std::nullopt;
+			std::optional<std::size_t> transferQueueFamilyIndex = std::nullopt;
+
 			for(std::size_t i = 0; i < queueFamilies.size(); ++i)
 			{
+				const auto flags = queueFamilies[i].queueFlags;
+
 				constexpr auto mask = (VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_GRAPHICS_BIT);
-				if((queueFamilies[i].queueFlags & mask) == mask)
+				if((flags & mask) == mask)
 				{
 					queueFamilyIndex = i;
 				}
+
+				if ((flags & VK_QUEUE_COMPUTE_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT) && !computeQueueFamilyIndex.has_value())
+				{
+					computeQueueFamilyIndex = i;
+				}
+
+				if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) && !transferQueueFamilyIndex.has_value())
+				{
+					transferQueueFamilyIndex = i;
+				}
 			}
 
 			assert(queueFamilyIndex.has_value());
 
-			VkDeviceQueueCreateInfo queueCreateInfo{};
-			queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-			queueCreateInfo.queueFamilyIndex = static_cast<std::uint32_t>(queueFamilyIndex.value());
-			queueCreateInfo.queueCount = 1;
-
 			constexpr auto queuePriority = 1.0f;
-			queueCreateInfo.pQueuePriorities = &queuePriority;
+			std::vector<VkDeviceQueueCreateInfo> queueCreateInfos {};
+
+			for (const auto& familyIndex : { queueFamilyIndex, computeQueueFamilyIndex, transferQueueFamilyIndex })
+			{
+				if (familyIndex.has_value())
+				{
+					VkDeviceQueueCreateInfo queueCreateInfo{};
+					queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+					queueCreateInfo.queueFamilyIndex = static_cast<std::uint32_t>(familyIndex.value());
+					queueCreateInfo.queueCount = 1;
+					queueCreateInfo.pQueuePriorities = &queuePriority;
+					queueCreateInfos.push_back(queueCreateInfo);
+				}
+			}
 
 
 			VkDeviceCreateInfo createDeviceInfo{};
@@ -467,8 +511,8 @@ namespace MMPEngine::Feature
 			timelineFeatures.timelineSemaphore = VK_TRUE;
 
 			createDeviceInfo.pNext = &timelineFeatures;
-			createDeviceInfo.pQueueCreateInfos = &queueCreateInfo;
-			createDeviceInfo.queueCreateInfoCount = 1;
+			createDeviceInfo.pQueueCreateInfos = queueCreateInfos.data();
+			createDeviceInfo.queueCreateInfoCount = static_cast<std::uint32_t>(queueCreateInfos.size());
 
 			VkPhysicalDeviceFeatures deviceFeatures;
 			vkGetPhysicalDeviceFeatures(physicalDevices[selectedDeviceProps.value().first], &deviceFeatures);
@@ -476,6 +520,14 @@ namespace MMPEngine::Feature
 
 			requiredExtensions.clear();
 			requiredExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+
+			const auto memoryBudgetSupported = Backend::Vulkan::DeviceMemoryBudget::IsExtensionSupported(physicalDevices[selectedDeviceProps.value().first]);
+
+			if (memoryBudgetSupported)
+			{
+				requiredExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+			}
+
 			createDeviceInfo.enabledExtensionCount = static_cast<std::uint32_t>(requiredExtensions.size());
 			createDeviceInfo.ppEnabledExtensionNames = requiredExtensions.data();
 
@@ -483,81 +535,121 @@ namespace MMPEngine::Feature
 			const auto createDeviceRes = vkCreateDevice(physicalDevices[selectedDeviceProps.value().first], &createDeviceInfo, nullptr, &vkDevice);
 			assert(createDeviceRes == VK_SUCCESS);
 			_rootContext->device = std::make_shared<Backend::Vulkan::Wrapper::Device>(_rootContext->instance, physicalDevices[selectedDeviceProps.value().first], vkDevice);
+			_rootContext->memoryBudget = std::make_shared<Backend::Vulkan::DeviceMemoryBudget>(Backend::Vulkan::DeviceMemoryBudget::Settings {}, _rootContext->device, memoryBudgetSupported);
 
-			constexpr std::size_t growthFactor = 2;
-			constexpr std::size_t initialSize = 4096;
-
-			_rootContext->uploadBufferHeap = std::make_shared<Backend::Vulkan::DeviceMemoryHeap>(
-				Core::Heap::Settings {initialSize, growthFactor, true},
-				static_cast<VkMemoryPropertyFlagBits>(
-					VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
-					VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
-					VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-				),
-				static_cast<VkMemoryPropertyFlagBits>(0)
-			);
-
-			_rootContext->readBackBufferHeap = std::make_shared<Backend::Vulkan::DeviceMemoryHeap>(
-				Core::Heap::Settings {initialSize, growthFactor, true},
-				static_cast<VkMemoryPropertyFlagBits>(
-					VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
-					VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
-					VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-					),
-				static_cast<VkMemoryPropertyFlagBits>(0)
+			const auto createHeap = [this](std::size_t reservation, VkMemoryPropertyFlagBits includeFlags, VkMemoryPropertyFlagBits excludeFlags)
+			{
+				constexpr std::size_t growthFactor = 2;
+				constexpr std::size_t minBlockSize = 4096;
+				const auto preferredBlockSize = (std::max)(Backend::Vulkan::DeviceMemoryBlock::GetPreferredBlockSize(_rootContext->device->GetNativePhysical(), includeFlags, excludeFlags), minBlockSize);
+
+				Core::Heap::Settings settings {};
+				settings.initialSize = reservation > 0 ? reservation : (std::max)(preferredBlockSize / 8, minBlockSize);
+				settings.growthFactor = growthFactor;
+				settings.removeEmptyBlocks = true;
+				settings.maxBlockSize = (std::max)(preferredBlockSize, settings.initialSize);
+				settings.dedicatedThreshold = preferredBlockSize / 2;
+
+				return std::make_shared<Backend::Vulkan::DeviceMemoryHeap>(settings, includeFlags, excludeFlags);
+			};
+
+			const auto& heapReservations = _rootContext->settings.heapReservations;
+			const auto hostVisibleFlags = static_cast<VkMemoryPropertyFlagBits>(
+				VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+				VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
+				VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
 			);
 
-			_rootContext->residentBufferHeap = std::make_shared<Backend::Vulkan::DeviceMemoryHeap>(
-				Core::Heap::Settings {initialSize, growthFactor, true},
+			_rootContext->uploadBufferHeap = createHeap(heapReservations.upload, hostVisibleFlags, static_cast<VkMemoryPropertyFlagBits>(0));
+			_rootContext->readBackBufferHeap = createHeap(heapReservations.readBack, hostVisibleFlags, static_cast<VkMemoryPropertyFlagBits>(0));
+			_rootContext->residentBufferHeap = createHeap(
+				heapReservations.resident,
 				static_cast<VkMemoryPropertyFlagBits>(VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
 				static_cast<VkMemoryPropertyFlagBits>(VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
 			);
+			_rootContext->uniformBufferHeap = createHeap(heapReservations.uniform, hostVisibleFlags, static_cast<VkMemoryPropertyFlagBits>(0));
 
-			_rootContext->uniformBufferHeap = std::make_shared<Backend::Vulkan::DeviceMemoryHeap>(
-				Core::Heap::Settings {initialSize, growthFactor, true},
-				static_cast<VkMemoryPropertyFlagBits>(
-					VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
-					VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
-					VkMemoryPropertyFlagBits::VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-					),
-				static_cast<VkMemoryPropertyFlagBits>(0)
-			);
+			const auto createQueue = [vkDevice](std::size_t familyIndex)
+			{
+				VkQueue queue;
+				vkGetDeviceQueue(vkDevice, static_cast<std::uint32_t>(familyIndex), 0, &queue);
+				assert(queue != nullptr);
+				return std::make_shared<Backend::Vulkan::Wrapper::Queue>(queue, static_cast<std::uint32_t>(familyIndex));
+			};
+
+			const auto createStream = [this, vkDevice](const std::shared_ptr<Backend::Vulkan::Wrapper::Queue>& queueWrapper)
+			{
+				VkCommandPoolCreateInfo poolInfo{};
+				poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+				poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+				poolInfo.queueFamilyIndex = queueWrapper->GetFamilyIndex();
+				VkCommandPool commandPool;
+				vkCreateCommandPool(vkDevice, &poolInfo, nullptr, &commandPool);
+				const auto commandAllocatorWrapper = std::make_shared<Backend::Vulkan::Wrapper::CommandAllocator>(_rootContext->device, commandPool);
+
+				VkCommandBufferAllocateInfo allocInfo{};
+				allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+				allocInfo.commandPool = commandPool;
+				allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+				allocInfo.commandBufferCount = 1;
+
+				VkCommandBuffer vkCommandBuffer;
+				vkAllocateCommandBuffers(vkDevice, &allocInfo, &vkCommandBuffer);
+				const auto commandBufferWrapper = std::make_shared<Backend::Vulkan::Wrapper::CommandBuffer>(_rootContext->device, commandAllocatorWrapper, vkCommandBuffer);
+
+				VkFenceCreateInfo vkCreateFenceInfo;
+				vkCreateFenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+				vkCreateFenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+				vkCreateFenceInfo.pNext = nullptr;
+
+				VkFence vkFence;
+				vkCreateFence(vkDevice, &vkCreateFenceInfo, nullptr, &vkFence);
+				assert(vkGetFenceStatus(vkDevice, vkFence) == VK_SUCCESS);
+				const auto fenceWrapper =  std::make_shared<Backend::Vulkan::Wrapper::Fence>(_rootContext->device, vkFence);
+
+				VkSemaphoreTypeCreateInfo vkSemaphoreTypeInfo;
+				vkSemaphoreTypeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+				vkSemaphoreTypeInfo.pNext = nullptr;
+				vkSemaphoreTypeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+				vkSemaphoreTypeInfo.initialValue = 0;
+
+				VkSemaphoreCreateInfo vkCreateSemaphoreInfo;
+				vkCreateSemaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+				vkCreateSemaphoreInfo.pNext = &vkSemaphoreTypeInfo;
+				vkCreateSemaphoreInfo.flags = 0;
+
+				VkSemaphore vkSemaphore;
+				const auto createSemaphoreRes = vkCreateSemaphore(vkDevice, &vkCreateSemaphoreInfo, nullptr, &vkSemaphore);
+				assert(createSemaphoreRes == VK_SUCCESS);
+				const auto semaphoreWrapper = std::make_shared<Backend::Vulkan::Wrapper::Semaphore>(_rootContext->device, vkSemaphore);
+
+				VkCommandPoolCreateInfo releasePoolInfo{};
+				releasePoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+				releasePoolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+				releasePoolInfo.queueFamilyIndex = queueWrapper->GetFamilyIndex();
+				VkCommandPool releaseCommandPool;
+				vkCreateCommandPool(vkDevice, &releasePoolInfo, nullptr, &releaseCommandPool);
+				const auto releaseAllocatorWrapper = std::make_shared<Backend::Vulkan::Wrapper::CommandAllocator>(_rootContext->device, releaseCommandPool);
+
+				const auto streamContext = std::make_shared<Backend::Vulkan::StreamContext>(queueWrapper, commandAllocatorWrapper, commandBufferWrapper, fenceWrapper, semaphoreWrapper, releaseAllocatorWrapper);
+				return std::make_shared<Backend::Vulkan::Stream>(_rootContext, streamContext);
+			};
+
+			_rootContext->graphicsQueue = createQueue(queueFamilyIndex.value());
+			_rootContext->computeQueue = computeQueueFamilyIndex.has_value() ? createQueue(computeQueueFamilyIndex.value()) : _rootContext->graphicsQueue;
+			_rootContext->transferQueue = transferQueueFamilyIndex.has_value() ? createQueue(transferQueueFamilyIndex.value()) : _rootContext->computeQueue;
+
+			_defaultStream = createStream(_rootContext->graphicsQueue);
+
+			if (_rootContext->computeQueue != _rootContext->graphicsQueue)
+			{
+				_computeStream = createStream(_rootContext->computeQueue);
+			}
 
-			VkQueue queue;
-			vkGetDeviceQueue(vkDevice, static_cast<std::uint32_t>(queueFamilyIndex.value()), 0, &queue);
-			assert(queue != nullptr);
-			const auto queueWrapper = std::make_shared<Backend::Vulkan::Wrapper::Queue>(queue, static_cast<std::uint32_t>(queueFamilyIndex.value()));
-
-			VkCommandPoolCreateInfo poolInfo{};
-			poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-			poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-			poolInfo.queueFamilyIndex = static_cast<std::uint32_t>(queueFamilyIndex.value());
-			VkCommandPool commandPool;
-			vkCreateCommandPool(vkDevice, &poolInfo, nullptr, &commandPool);
-			const auto commandAllocatorWrapper = std::make_shared<Backend::Vulkan::Wrapper::CommandAllocator>(_rootContext->device, commandPool);
-
-			VkCommandBufferAllocateInfo allocInfo{};
-			allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-			allocInfo.commandPool = commandPool;
-			allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-			allocInfo.commandBufferCount = 1;
-
-			VkCommandBuffer vkCommandBuffer;
-			vkAllocateCommandBuffers(vkDevice, &allocInfo, &vkCommandBuffer);
-			const auto commandBufferWrapper = std::make_shared<Backend::Vulkan::Wrapper::CommandBuffer>(_rootContext->device, commandAllocatorWrapper, vkCommandBuffer);
-
-			VkFenceCreateInfo vkCreateFenceInfo;
-			vkCreateFenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-			vkCreateFenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-			vkCreateFenceInfo.pNext = nullptr;
-			
-			VkFence vkFence;
-			vkCreateFence(vkDevice, &vkCreateFenceInfo, nullptr, &vkFence);
-			assert(vkGetFenceStatus(vkDevice, vkFence) == VK_SUCCESS);
-			const auto fenceWrapper =  std::make_shared<Backend::Vulkan::Wrapper::Fence>(_rootContext->device, vkFence);
-
-			const auto streamContext = std::make_shared<Backend::Vulkan::StreamContext>(queueWrapper, commandAllocatorWrapper, commandBufferWrapper, fenceWrapper);
-			_defaultStream = std::make_shared<Backend::Vulkan::Stream>(_rootContext, streamContext);
+			if (_rootContext->transferQueue != _rootContext->computeQueue)
+			{
+				_transferStream = createStream(_rootContext->transferQueue);
+			}
 
 			_rootContext->descriptorPool = std::make_shared<MMPEngine::Backend::Vulkan::DescriptorPool>(
 				MMPEngine::Backend::Vulkan::DescriptorPool::Settings {
@@ -576,6 +668,12 @@ namespace MMPEngine::Feature
 
 			Feature::RootApp<Backend::Vulkan::GlobalContext>::Initialize();
 		}
+
+		void RootApp::OnUpdate(std::float_t dt)
+		{
+			_rootContext->memoryBudget->Update();
+			Feature::RootApp<Backend::Vulkan::GlobalContext>::OnUpdate(dt);
+		}
 	}
 #endif
 
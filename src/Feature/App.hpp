@@ -43,6 +43,8 @@ namespace MMPEngine::Feature
 		virtual std::shared_ptr<Core::GlobalContext> GetContext() const = 0;
 		virtual std::shared_ptr<Feature::Input> GetInput() const = 0;
 		virtual std::shared_ptr<Core::BaseStream> GetDefaultStream() const = 0;
+		virtual std::shared_ptr<Core::BaseStream> GetComputeStream() const = 0;
+		virtual std::shared_ptr<Core::BaseStream> GetTransferStream() const = 0;
 
 		static std::unique_ptr<BaseRootApp> BuildRootApp(
 			const Core::GlobalContext::Settings& globalContextSettings, 
@@ -87,6 +89,8 @@ namespace MMPEngine::Feature
 		UserApp(const std::shared_ptr<BaseLogger>& logger);
 		std::shared_ptr<Core::GlobalContext> GetContext() const override;
 		std::shared_ptr<Core::BaseStream> GetDefaultStream() const override;
+		std::shared_ptr<Core::BaseStream> GetComputeStream() const override;
+		std::shared_ptr<Core::BaseStream> GetTransferStream() const override;
 		std::shared_ptr<Feature::Input> GetInput() const override;
 	private:
 		void JoinToRootApp(const BaseRootApp* root);
@@ -111,9 +115,13 @@ namespace MMPEngine::Feature
 	public:
 		std::shared_ptr<Core::GlobalContext> GetContext() const override;
 		std::shared_ptr<Core::BaseStream> GetDefaultStream() const override;
+		std::shared_ptr<Core::BaseStream> GetComputeStream() const override;
+		std::shared_ptr<Core::BaseStream> GetTransferStream() const override;
 	protected:
 		std::shared_ptr<TRootContext> _rootContext;
 		std::shared_ptr<Core::BaseStream> _defaultStream;
+		std::shared_ptr<Core::BaseStream> _computeStream;
+		std::shared_ptr<Core::BaseStream> _transferStream;
 	};
 
 #ifdef MMPENGINE_BACKEND_DX12
@@ -136,6 +144,7 @@ namespace MMPEngine::Feature
 		public:
 			RootApp(const std::shared_ptr<Backend::Vulkan::GlobalContext>& context, const std::shared_ptr<BaseLogger>& logger);
 			void Initialize() override;
+			void OnUpdate(std::float_t dt) override;
 		};
 	}
 #endif
@@ -167,12 +176,33 @@ namespace MMPEngine::Feature
 	inline void RootApp<TRootContext>::Initialize()
 	{
 		_defaultStream->Restart();
+
+		if (_computeStream)
+		{
+			_computeStream->Restart();
+		}
+
+		if (_transferStream)
+		{
+			_transferStream->Restart();
+		}
+
 		BaseRootApp::Initialize();
 	}
 
 	template<typename TRootContext>
 	inline RootApp<TRootContext>::~RootApp()
 	{
+		if (_transferStream)
+		{
+			_transferStream->SubmitAndWait();
+		}
+
+		if (_computeStream)
+		{
+			_computeStream->SubmitAndWait();
+		}
+
 		_defaultStream->SubmitAndWait();
 	}
 
@@ -181,4 +211,16 @@ namespace MMPEngine::Feature
 	{
 		return _defaultStream;
 	}
+
+	template<typename TRootContext>
+	inline std::shared_ptr<Core::BaseStream> RootApp<TRootContext>::GetComputeStream() const
+	{
+		return _computeStream ? _computeStream : _defaultStream;
+	}
+
+	template<typename TRootContext>
+	inline std::shared_ptr<Core::BaseStream> RootApp<TRootContext>::GetTransferStream() const
+	{
+		return _transferStream ? _transferStream : GetComputeStream();
+	}
 }
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <array>
 #include <thread>
 #include <numeric>
 #include <Feature/AppContainer.hpp>
@@ -41,8 +43,10 @@ namespace MMPEngine::Feature
 		_app->GetInput()->SetButtonPressedStatus(btn, status);
 	}
 
-	AppContainer::AppContainer(Settings&& settings, std::unique_ptr<Feature::BaseRootApp>&& app) : _settings(std::move(settings)), _app(std::move(app))
+	AppContainer::AppContainer(Settings&& settings, std::unique_ptr<Feature::BaseRootApp>&& app) : _settings(std::move(settings)), _framePacer(_settings.pacer), _frameStatistics(_settings.statistics), _app(std::move(app))
 	{
+		UpdateFrameInterval();
+
 		if (_settings.showBackendType)
 		{
 			_settings.windowCaption += " | Backend: " + Core::Text::ToString(_app->GetContext()->settings.backend);
@@ -60,12 +64,82 @@ namespace MMPEngine::Feature
 		appContext->screenRefreshRate = GetCurrentScreenRefreshRate();
 		appContext->windowSize = GetCurrentWindowSize();
 
+		UpdateFrameInterval();
 		_app->OnNativeWindowUpdated();
 	}
 
-	std::chrono::milliseconds AppContainer::NowMs()
+	void AppContainer::UpdateFrameInterval()
+	{
+		std::int32_t framesPerSecond = _settings.targetFps;
+
+		if (_settings.paceToScreenRefreshRate && _state.appInitialized)
+		{
+			if (const auto refreshRate = _app->GetContext()->screenRefreshRate; refreshRate > 0)
+			{
+				framesPerSecond = static_cast<std::int32_t>(refreshRate);
+			}
+		}
+
+		_framePacer.SetFrameInterval(framesPerSecond > 0 ? std::chrono::nanoseconds { 1'000'000'000LL / framesPerSecond } : std::chrono::nanoseconds::zero());
+	}
+
+	std::float_t AppContainer::BeginFrame()
+	{
+		const auto now = FramePacer::Now();
+		const auto prev = _state.previousFrameTime.value_or(now);
+		_state.previousFrameTime.emplace(now);
+
+		if (now != prev)
+		{
+			_frameStatistics.Record(FrameStatistics::Metric::FrameTime, now - prev);
+		}
+
+		const auto dt = std::chrono::duration<std::float_t>(now - prev).count();
+		AddFPSData(dt);
+		return dt;
+	}
+
+	void AppContainer::RunFrame(std::float_t dt)
 	{
-		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch());
+		ConsumeStreamSubmitTime();
+
+		const auto updateStart = FramePacer::Now();
+		_app->OnUpdate(dt);
+		ClearInstantInputEvents();
+		const auto updateSubmitTime = ConsumeStreamSubmitTime();
+
+		const auto renderStart = FramePacer::Now();
+		_app->OnRender();
+		const auto renderSubmitTime = ConsumeStreamSubmitTime();
+
+		const auto renderEnd = FramePacer::Now();
+		const auto frameEnd = _framePacer.Wait();
+
+		_frameStatistics.Record(FrameStatistics::Metric::CpuUpdate, renderStart - updateStart - updateSubmitTime);
+		_frameStatistics.Record(FrameStatistics::Metric::CpuRender, renderEnd - renderStart - renderSubmitTime);
+		_frameStatistics.Record(FrameStatistics::Metric::StreamSubmit, updateSubmitTime + renderSubmitTime);
+		_frameStatistics.Record(FrameStatistics::Metric::PacerWait, frameEnd - renderEnd);
+	}
+
+	std::chrono::nanoseconds AppContainer::ConsumeStreamSubmitTime() const
+	{
+		std::chrono::nanoseconds result {};
+		const std::array streams { _app->GetDefaultStream(), _app->GetComputeStream(), _app->GetTransferStream() };
+
+		for (std::size_t i = 0; i < streams.size(); ++i)
+		{
+			if (streams[i] && std::find(streams.begin(), streams.begin() + i, streams[i]) == streams.begin() + i)
+			{
+				result += streams[i]->ConsumeSubmitAndWaitTime();
+			}
+		}
+
+		return result;
+	}
+
+	const FrameStatistics& AppContainer::GetFrameStatistics() const
+	{
+		return _frameStatistics;
 	}
 
 	void AppContainer::ClearFPSData()
@@ -108,7 +182,14 @@ namespace MMPEngine::Feature
 		_app->Initialize();
 		_state.appInitialized = true;
 		OnWindowChanged();
-		return RunInternal();
+		const auto exitCode = RunInternal();
+
+		if (!_settings.statisticsDumpPath.empty())
+		{
+			_frameStatistics.Dump(_settings.statisticsDumpPath);
+		}
+
+		return exitCode;
 	}
 
 	namespace Shared
@@ -206,12 +287,8 @@ namespace MMPEngine::Feature
 		std::int32_t AppContainer::RunInternal()
 		{
 			const auto globalContext = _app->GetContext();
-			_state.previousFrameMs.reset();
-
-			const auto targetFrameMilliseconds = std::chrono::milliseconds(
-				static_cast<std::uint64_t>(floor((1000.0 / static_cast<double_t>(_settings.targetFps))))
-			);
-
+			_state.previousFrameTime.reset();
+			_framePacer.Reset();
 
 			while (!glfwWindowShouldClose(_window))
 			{
@@ -233,19 +310,14 @@ namespace MMPEngine::Feature
 					}
 
 					ClearFPSData();
+					_framePacer.Reset();
 				}
 
 				_state.prevPaused = _state.paused;
 
 				if (!_state.paused)
 				{
-					const auto beforeFrameMs = NowMs();
-					const auto prevMs = _state.previousFrameMs.value_or(beforeFrameMs);
-					_state.previousFrameMs.emplace(beforeFrameMs);
-
-					const auto frameDiff = beforeFrameMs - prevMs;
-					const auto dt = static_cast<float_t>(frameDiff.count()) * 0.001f;
-					AddFPSData(dt);
+					const auto dt = BeginFrame();
 
 					if (_settings.fps.show && _state.fpsUpdateTimer <= 0.0f && _state.deltaTimeFrames.size() == _settings.fps.frameCount)
 					{
@@ -271,25 +343,7 @@ namespace MMPEngine::Feature
 						std::clamp(static_cast<std::float_t>(y) / static_cast<std::float_t>(globalContext->windowSize.y), 0.0f, 1.0f)
 					});
 
-					_app->OnUpdate(dt);
-					ClearInstantInputEvents();
-					_app->OnRender();
-
-					const auto afterFrame = NowMs();
-					const auto diffMs = afterFrame - beforeFrameMs;
-
-					if (diffMs >= targetFrameMilliseconds)
-					{
-						std::this_thread::yield();
-					}
-					else
-					{
-						const auto sleepTimeout = targetFrameMilliseconds - diffMs;
-						while (NowMs() - _state.previousFrameMs.value() < sleepTimeout)
-						{
-							std::this_thread::yield();
-						}
-					}
+					RunFrame(dt);
 
 					if (_app->IsReadyToFinish())
 					{
@@ -334,12 +388,8 @@ namespace MMPEngine::Feature
 		{
 			MSG msg = {};
 			const auto globalContext = _app->GetContext();
-			_state.previousFrameMs.reset();
-
-			const auto targetFrameMilliseconds = std::chrono::milliseconds(
-				static_cast<std::uint64_t>(floor((1000.0 / static_cast<double_t>(_settings.targetFps))))
-			);
-
+			_state.previousFrameTime.reset();
+			_framePacer.Reset();
 			while (msg.message != WM_QUIT)
 			{
 				if (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
@@ -367,19 +417,14 @@ namespace MMPEngine::Feature
 						}
 
 						ClearFPSData();
+						_framePacer.Reset();
 					}
 
 					_state.prevPaused = _state.paused;
 
 					if (!_state.paused)
 					{
-						const auto beforeFrameMs = NowMs();
-						const auto prevMs = _state.previousFrameMs.value_or(beforeFrameMs);
-						_state.previousFrameMs.emplace(beforeFrameMs);
-
-						const auto frameDiff = beforeFrameMs - prevMs;
-						const auto dt = static_cast<float_t>(frameDiff.count()) * 0.001f;
-						AddFPSData(dt);
+						const auto dt = BeginFrame();
 
 						if (_settings.fps.show && _state.fpsUpdateTimer <= 0.0f && _state.deltaTimeFrames.size() == _settings.fps.frameCount)
 						{
@@ -387,25 +432,7 @@ namespace MMPEngine::Feature
 							_state.fpsUpdateTimer = _settings.fps.updateFpsSec;
 						}
 
-						_app->OnUpdate(dt);
-						ClearInstantInputEvents();
-						_app->OnRender();
-
-						const auto afterFrame = NowMs();
-						const auto diffMs = afterFrame - beforeFrameMs;
-
-						if (diffMs >= targetFrameMilliseconds)
-						{
-							std::this_thread::yield();
-						}
-						else
-						{
-							const auto sleepTimeout = targetFrameMilliseconds - diffMs;
-							while (NowMs() - _state.previousFrameMs.value() < sleepTimeout)
-							{
-								std::this_thread::yield();
-							}
-						}
+						RunFrame(dt);
 
 						if (_app->IsReadyToFinish())
 						{
@@ -529,7 +556,7 @@ namespace MMPEngine::Feature
 				}
 				else
 				{
-					container->_state.previousFrameMs.reset();
+					container->_state.previousFrameTime.reset();
 					container->_state.paused = false;
 				}
 			}
@@ -544,7 +571,7 @@ namespace MMPEngine::Feature
 			{
 				container->_state.resizeInProgress = false;
 				container->_state.paused = false;
-				container->_state.previousFrameMs.reset();
+				container->_state.previousFrameTime.reset();
 				container->OnWindowChanged();
 			}
 			return 0;
@@ -564,7 +591,7 @@ namespace MMPEngine::Feature
 					container->_state.paused = false;
 					container->_state.minimized = false;
 					container->_state.maximized = true;
-					container->_state.previousFrameMs.reset();
+					container->_state.previousFrameTime.reset();
 					container->OnWindowChanged();
 				}
 				else if (wParam == SIZE_RESTORED)
@@ -573,14 +600,14 @@ namespace MMPEngine::Feature
 					{
 						container->_state.paused = false;
 						container->_state.minimized = false;
-						container->_state.previousFrameMs.reset();
+						container->_state.previousFrameTime.reset();
 						container->OnWindowChanged();
 					}
 					else if (container->_state.maximized)
 					{
 						container->_state.paused = false;
 						container->_state.maximized = false;
-						container->_state.previousFrameMs.reset();
+						container->_state.previousFrameTime.reset();
 						container->OnWindowChanged();
 					}
 					else if (!container->_state.resizeInProgress)
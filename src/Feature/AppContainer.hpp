@@ -6,6 +6,8 @@
 #include <list>
 #include <Feature/App.hpp>
 #include <Feature/Input.hpp>
+#include <Feature/FramePacer.hpp>
+#include <Feature/FrameStatistics.hpp>
 
 #ifdef MMPENGINE_WIN
 #include <Windows.h>
@@ -34,7 +36,11 @@ namespace MMPEngine::Feature
 			std::int32_t targetFps = 60;
 			std::int32_t pausedSleepTimeoutMs = 42;
 			bool showBackendType = true;
+			bool paceToScreenRefreshRate = false;
 			FPS fps{};
+			FramePacer::Settings pacer{};
+			FrameStatistics::Settings statistics{};
+			std::filesystem::path statisticsDumpPath{};
 		};
 	protected:
 		struct State final
@@ -45,7 +51,7 @@ namespace MMPEngine::Feature
 			bool maximized = false;
 			bool minimized = false;
 			bool resizeInProgress = false;
-			std::optional<std::chrono::milliseconds> previousFrameMs = std::nullopt;
+			std::optional<FramePacer::Clock::time_point> previousFrameTime = std::nullopt;
 			std::list<std::float_t> deltaTimeFrames;
 			std::float_t fpsUpdateTimer = 0.0f;
 		};
@@ -56,7 +62,10 @@ namespace MMPEngine::Feature
 		virtual std::uint32_t GetCurrentScreenRefreshRate() const = 0;
 		virtual Core::Vector2Uint GetCurrentWindowSize() const = 0;
 		virtual std::int32_t RunInternal() = 0;
-		static std::chrono::milliseconds NowMs();
+		void UpdateFrameInterval();
+		std::float_t BeginFrame();
+		void RunFrame(std::float_t dt);
+		std::chrono::nanoseconds ConsumeStreamSubmitTime() const;
 
 		void ClearFPSData();
 		void AddFPSData(std::float_t dt);
@@ -75,9 +84,12 @@ namespace MMPEngine::Feature
 		virtual ~AppContainer();
 
 		std::int32_t Run();
+		const FrameStatistics& GetFrameStatistics() const;
 	protected:
 		Settings _settings;
 		State _state;
+		FramePacer _framePacer;
+		FrameStatistics _frameStatistics;
 		std::unique_ptr<Feature::App> _app;
 	};
 
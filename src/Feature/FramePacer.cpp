@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <cassert>
+#include <thread>
+#include <Feature/FramePacer.hpp>
+
+#if !defined(MMPENGINE_WIN) && defined(__linux__)
+#include <cerrno>
+#include <ctime>
+#endif
+
+namespace MMPEngine::Feature
+{
+	FramePacer::FramePacer(const Settings& settings) : _settings(settings), _frameInterval(0), _spinThreshold(settings.minSpin)
+	{
+#ifdef MMPENGINE_WIN
+		_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+		if (!_timer)
+		{
+			_timer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+		}
+#endif
+	}
+
+	FramePacer::~FramePacer()
+	{
+#ifdef MMPENGINE_WIN
+		if (_timer)
+		{
+			CloseHandle(_timer);
+		}
+#endif
+	}
+
+	FramePacer::Clock::time_point FramePacer::Now()
+	{
+		return Clock::now();
+	}
+
+	void FramePacer::SetFrameInterval(std::chrono::nanoseconds interval)
+	{
+		if (interval != _frameInterval)
+		{
+			_frameInterval = interval;
+			Reset();
+		}
+	}
+
+	std::chrono::nanoseconds FramePacer::GetFrameInterval() const
+	{
+		return _frameInterval;
+	}
+
+	std::chrono::nanoseconds FramePacer::GetSpinThreshold() const
+	{
+		return _spinThreshold;
+	}
+
+	void FramePacer::AlignToPresent(Clock::time_point presentTime)
+	{
+		if (_frameInterval.count() <= 0)
+		{
+			return;
+		}
+
+		_nextDeadline = AlignDeadline(Now(), presentTime, _frameInterval);
+	}
+
+	void FramePacer::Reset()
+	{
+		_nextDeadline.reset();
+	}
+
+	FramePacer::Clock::time_point FramePacer::Wait()
+	{
+		const auto now = Now();
+		const auto plan = PlanWait(now, _nextDeadline, _frameInterval, _spinThreshold);
+
+		_nextDeadline = plan.nextDeadline;
+
+		if (!plan.spinUntil.has_value())
+		{
+			return now;
+		}
+
+		if (plan.sleepUntil.has_value())
+		{
+			SleepUntil(plan.sleepUntil.value());
+			_spinThreshold = CalibrateSpinThreshold(_settings, _spinThreshold, std::chrono::duration_cast<std::chrono::nanoseconds>(Now() - plan.sleepUntil.value()));
+		}
+
+		SpinUntil(plan.spinUntil.value());
+		return Now();
+	}
+
+	FramePacer::WaitPlan FramePacer::PlanWait(Clock::time_point now, std::optional<Clock::time_point> nextDeadline, std::chrono::nanoseconds frameInterval, std::chrono::nanoseconds spinThreshold)
+	{
+		if (frameInterval.count() <= 0)
+		{
+			return { nextDeadline, std::nullopt, std::nullopt };
+		}
+
+		if (!nextDeadline.has_value() || now >= nextDeadline.value())
+		{
+			return { now + frameInterval, std::nullopt, std::nullopt };
+		}
+
+		const auto deadline = nextDeadline.value();
+		const auto wakeUp = deadline - spinThreshold;
+
+		return {
+			deadline + frameInterval,
+			now < wakeUp ? std::optional { wakeUp } : std::nullopt,
+			deadline
+		};
+	}
+
+	FramePacer::Clock::time_point FramePacer::AlignDeadline(Clock::time_point now, Clock::time_point presentTime, std::chrono::nanoseconds frameInterval)
+	{
+		assert(frameInterval.count() > 0);
+
+		auto next = presentTime + frameInterval;
+
+		if (next < now)
+		{
+			next += ((now - next) / frameInterval + 1) * frameInterval;
+		}
+
+		return next;
+	}
+
+	std::chrono::nanoseconds FramePacer::CalibrateSpinThreshold(const Settings& settings, std::chrono::nanoseconds spinThreshold, std::chrono::nanoseconds overshoot)
+	{
+		overshoot = std::max(std::chrono::nanoseconds::zero(), overshoot);
+
+		const auto target = static_cast<std::float_t>((overshoot + settings.minSpin).count());
+		const auto current = static_cast<std::float_t>(spinThreshold.count());
+		const auto calibrated = std::chrono::nanoseconds { static_cast<std::int64_t>(current + (target - current) * settings.spinCalibrationFactor) };
+		return std::clamp(std::max(calibrated, overshoot), settings.minSpin, settings.maxSpin);
+	}
+
+	void FramePacer::SleepUntil(Clock::time_point deadline)
+	{
+#if defined(MMPENGINE_WIN)
+		const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Now());
+
+		if (!_timer || remaining.count() <= 0)
+		{
+			return;
+		}
+
+		LARGE_INTEGER dueTime {};
+		dueTime.QuadPart = -static_cast<LONGLONG>(remaining.count() / 100);
+
+		if (SetWaitableTimerEx(_timer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+		{
+			WaitForSingleObject(_timer, INFINITE);
+		}
+#elif defined(__linux__)
+		const auto sinceEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch());
+		timespec ts {};
+		ts.tv_sec = static_cast<std::time_t>(sinceEpoch.count() / 1'000'000'000);
+		ts.tv_nsec = static_cast<long>(sinceEpoch.count() % 1'000'000'000);
+
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+		{
+		}
+#else
+		std::this_thread::sleep_until(deadline);
+#endif
+	}
+
+	void FramePacer::SpinUntil(Clock::time_point deadline)
+	{
+		while (Now() < deadline)
+		{
+			std::this_thread::yield();
+		}
+	}
+}
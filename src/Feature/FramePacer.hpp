@@ -0,0 +1,62 @@
+#pragma once
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+
+#ifdef MMPENGINE_WIN
+#include <Windows.h>
+#endif
+
+namespace MMPEngine::Feature
+{
+	class FramePacer final
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		struct Settings final
+		{
+			std::chrono::nanoseconds minSpin = std::chrono::microseconds { 200 };
+			std::chrono::nanoseconds maxSpin = std::chrono::milliseconds { 2 };
+			std::float_t spinCalibrationFactor = 0.1f;
+		};
+
+		struct WaitPlan final
+		{
+			std::optional<Clock::time_point> nextDeadline;
+			std::optional<Clock::time_point> sleepUntil;
+			std::optional<Clock::time_point> spinUntil;
+		};
+
+		FramePacer(const Settings& settings);
+		FramePacer(const FramePacer&) = delete;
+		FramePacer(FramePacer&&) noexcept = delete;
+		FramePacer& operator=(const FramePacer&) = delete;
+		FramePacer& operator=(FramePacer&&) noexcept = delete;
+		~FramePacer();
+
+		void SetFrameInterval(std::chrono::nanoseconds interval);
+		std::chrono::nanoseconds GetFrameInterval() const;
+		void AlignToPresent(Clock::time_point presentTime);
+		void Reset();
+		Clock::time_point Wait();
+		std::chrono::nanoseconds GetSpinThreshold() const;
+
+		static Clock::time_point Now();
+		static WaitPlan PlanWait(Clock::time_point now, std::optional<Clock::time_point> nextDeadline, std::chrono::nanoseconds frameInterval, std::chrono::nanoseconds spinThreshold);
+		static Clock::time_point AlignDeadline(Clock::time_point now, Clock::time_point presentTime, std::chrono::nanoseconds frameInterval);
+		static std::chrono::nanoseconds CalibrateSpinThreshold(const Settings& settings, std::chrono::nanoseconds spinThreshold, std::chrono::nanoseconds overshoot);
+	private:
+		void SleepUntil(Clock::time_point deadline);
+		static void SpinUntil(Clock::time_point deadline);
+
+		Settings _settings;
+		std::chrono::nanoseconds _frameInterval;
+		std::chrono::nanoseconds _spinThreshold;
+		std::optional<Clock::time_point> _nextDeadline;
+#ifdef MMPENGINE_WIN
+		HANDLE _timer;
+#endif
+	};
+}
@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <Feature/FrameStatistics.hpp>
+
+namespace MMPEngine::Feature
+{
+	FrameStatistics::Histogram::Histogram() : _counts(kBucketCount, 0), _totalCount(0), _max(0)
+	{
+	}
+
+	std::size_t FrameStatistics::Histogram::GetBucketIndex(std::uint64_t value)
+	{
+		if (value < kSubBucketCount)
+		{
+			return static_cast<std::size_t>(value);
+		}
+
+		std::uint32_t msb = 0;
+		for (auto v = value; v > 1; v >>= 1)
+		{
+			++msb;
+		}
+
+		const auto shift = msb - kSubBucketBits;
+		const auto top = value >> shift;
+		return static_cast<std::size_t>(kSubBucketCount + shift * kSubBucketCount + (top - kSubBucketCount));
+	}
+
+	std::uint64_t FrameStatistics::Histogram::GetBucketUpperBound(std::size_t index)
+	{
+		if (index < kSubBucketCount)
+		{
+			return static_cast<std::uint64_t>(index);
+		}
+
+		const auto shift = static_cast<std::uint32_t>((index - kSubBucketCount) / kSubBucketCount);
+		const auto top = static_cast<std::uint64_t>((index - kSubBucketCount) % kSubBucketCount + kSubBucketCount);
+		return ((top + 1) << shift) - 1;
+	}
+
+	void FrameStatistics::Histogram::Record(std::uint64_t value)
+	{
+		value = std::min(value, (std::uint64_t { 1 } << kMaxValueBits) - 1);
+		++_counts[GetBucketIndex(value)];
+		++_totalCount;
+		_max = std::max(_max, value);
+	}
+
+	void FrameStatistics::Histogram::Clear()
+	{
+		std::fill(_counts.begin(), _counts.end(), 0);
+		_totalCount = 0;
+		_max = 0;
+	}
+
+	std::uint64_t FrameStatistics::Histogram::GetTotalCount() const
+	{
+		return _totalCount;
+	}
+
+	std::uint64_t FrameStatistics::Histogram::GetMax() const
+	{
+		return _max;
+	}
+
+	std::uint64_t FrameStatistics::Histogram::GetValueAtPercentile(std::float_t percentile) const
+	{
+		if (_totalCount == 0)
+		{
+			return 0;
+		}
+
+		const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(static_cast<std::double_t>(std::clamp(percentile, 0.0f, 100.0f)) * 0.01 * static_cast<std::double_t>(_totalCount))));
+		std::uint64_t accumulated = 0;
+
+		for (std::size_t i = 0; i < _counts.size(); ++i)
+		{
+			accumulated += _counts[i];
+
+			if (accumulated >= rank)
+			{
+				return std::min(GetBucketUpperBound(i), _max);
+			}
+		}
+
+		return _max;
+	}
+
+	FrameStatistics::FrameStatistics(const Settings& settings) : _settings(settings)
+	{
+		assert(_settings.windowFrames > 0);
+
+		for (auto& channel : _channels)
+		{
+			channel.window.resize(_settings.windowFrames);
+		}
+	}
+
+	FrameStatistics::~FrameStatistics() = default;
+
+	std::string_view FrameStatistics::GetMetricName(Metric metric)
+	{
+		switch (metric)
+		{
+		case Metric::FrameTime:
+			return "frame_time";
+		case Metric::CpuUpdate:
+			return "cpu_update";
+		case Metric::CpuRender:
+			return "cpu_render";
+		case Metric::StreamSubmit:
+			return "stream_submit";
+		case Metric::PacerWait:
+			return "pacer_wait";
+		default:
+			return "unknown";
+		}
+	}
+
+	void FrameStatistics::Record(Metric metric, std::chrono::nanoseconds value)
+	{
+		assert(metric < Metric::Count);
+		auto& channel = _channels[static_cast<std::size_t>(metric)];
+
+		channel.window[channel.head] = value;
+		channel.head = (channel.head + 1) % channel.window.size();
+		channel.size = std::min(channel.size + 1, channel.window.size());
+		channel.histogram.Record(static_cast<std::uint64_t>(std::max<std::int64_t>(0, value.count())));
+	}
+
+	void FrameStatistics::Clear()
+	{
+		for (auto& channel : _channels)
+		{
+			channel.head = 0;
+			channel.size = 0;
+			channel.histogram.Clear();
+		}
+	}
+
+	FrameStatistics::Summary FrameStatistics::GetWindowSummary(Metric metric) const
+	{
+		assert(metric < Metric::Count);
+		const auto& channel = _channels[static_cast<std::size_t>(metric)];
+
+		Summary summary {};
+		summary.count = channel.size;
+
+		if (channel.size == 0)
+		{
+			return summary;
+		}
+
+		std::vector<std::chrono::nanoseconds> sorted(channel.window.cbegin(), channel.window.cbegin() + static_cast<std::ptrdiff_t>(channel.size));
+		std::sort(sorted.begin(), sorted.end());
+
+		const auto at = [&sorted](std::double_t percentile)
+		{
+			const auto rank = static_cast<std::size_t>(std::ceil(percentile * 0.01 * static_cast<std::double_t>(sorted.size())));
+			return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+		};
+
+		summary.mean = std::accumulate(sorted.cbegin(), sorted.cend(), std::chrono::nanoseconds::zero()) / static_cast<std::int64_t>(sorted.size());
+		summary.p50 = at(50.0);
+		summary.p95 = at(95.0);
+		summary.p99 = at(99.0);
+		summary.max = sorted.back();
+
+		return summary;
+	}
+
+	const FrameStatistics::Histogram& FrameStatistics::GetHistogram(Metric metric) const
+	{
+		assert(metric < Metric::Count);
+		return _channels[static_cast<std::size_t>(metric)].histogram;
+	}
+
+	void FrameStatistics::WriteCsv(std::ostream& stream) const
+	{
+		stream << "metric,window_count,window_mean_ms,window_p50_ms,window_p95_ms,window_p99_ms,window_max_ms,total_count,total_p50_ms,total_p95_ms,total_p99_ms,total_max_ms\n";
+
+		const auto ms = [](auto ns)
+		{
+			return static_cast<std::double_t>(ns) * 1e-6;
+		};
+
+		for (std::size_t i = 0; i < kMetricCount; ++i)
+		{
+			const auto metric = static_cast<Metric>(i);
+			const auto summary = GetWindowSummary(metric);
+			const auto& histogram = _channels[i].histogram;
+
+			stream << GetMetricName(metric) << ','
+				<< summary.count << ','
+				<< ms(summary.mean.count()) << ','
+				<< ms(summary.p50.count()) << ','
+				<< ms(summary.p95.count()) << ','
+				<< ms(summary.p99.count()) << ','
+				<< ms(summary.max.count()) << ','
+				<< histogram.GetTotalCount() << ','
+				<< ms(histogram.GetValueAtPercentile(50.0f)) << ','
+				<< ms(histogram.GetValueAtPercentile(95.0f)) << ','
+				<< ms(histogram.GetValueAtPercentile(99.0f)) << ','
+				<< ms(histogram.GetMax()) << '\n';
+		}
+	}
+
+	void FrameStatistics::WriteJson(std::ostream& stream) const
+	{
+		const auto ms = [](auto ns)
+		{
+			return static_cast<std::double_t>(ns) * 1e-6;
+		};
+
+		stream << "{\n";
+
+		for (std::size_t i = 0; i < kMetricCount; ++i)
+		{
+			const auto metric = static_cast<Metric>(i);
+			const auto summary = GetWindowSummary(metric);
+			const auto& histogram = _channels[i].histogram;
+
+			stream << "\t\"" << GetMetricName(metric) << "\": {\n"
+				<< "\t\t\"window\": { \"count\": " << summary.count
+				<< ", \"mean_ms\": " << ms(summary.mean.count())
+				<< ", \"p50_ms\": " << ms(summary.p50.count())
+				<< ", \"p95_ms\": " << ms(summary.p95.count())
+				<< ", \"p99_ms\": " << ms(summary.p99.count())
+				<< ", \"max_ms\": " << ms(summary.max.count()) << " },\n"
+				<< "\t\t\"total\": { \"count\": " << histogram.GetTotalCount()
+				<< ", \"p50_ms\": " << ms(histogram.GetValueAtPercentile(50.0f))
+				<< ", \"p95_ms\": " << ms(histogram.GetValueAtPercentile(95.0f))
+				<< ", \"p99_ms\": " << ms(histogram.GetValueAtPercentile(99.0f))
+				<< ", \"max_ms\": " << ms(histogram.GetMax()) << " }\n"
+				<< "\t}" << (i + 1 < kMetricCount ? "," : "") << '\n';
+		}
+
+		stream << "}\n";
+	}
+
+	bool FrameStatistics::Dump(const std::filesystem::path& path) const
+	{
+		std::ofstream file { path, std::ios::out | std::ios::trunc };
+
+		if (!file.is_open())
+		{
+			return false;
+		}
+
+		if (path.extension() == ".json")
+		{
+			WriteJson(file);
+		}
+		else
+		{
+			WriteCsv(file);
+		}
+
+		return file.good();
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace MMPEngine::Feature
+{
+	class FrameStatistics final
+	{
+	public:
+		enum class Metric : std::uint8_t
+		{
+			FrameTime,
+			CpuUpdate,
+			CpuRender,
+			StreamSubmit,
+			PacerWait,
+			Count
+		};
+
+		struct Settings final
+		{
+			std::size_t windowFrames = 600;
+		};
+
+		struct Summary final
+		{
+			std::size_t count = 0;
+			std::chrono::nanoseconds mean {};
+			std::chrono::nanoseconds p50 {};
+			std::chrono::nanoseconds p95 {};
+			std::chrono::nanoseconds p99 {};
+			std::chrono::nanoseconds max {};
+		};
+
+		class Histogram final
+		{
+		public:
+			static constexpr std::uint32_t kSubBucketBits = 5;
+			static constexpr std::uint32_t kSubBucketCount = 1U << kSubBucketBits;
+			static constexpr std::uint32_t kMaxValueBits = 40;
+			static constexpr std::uint32_t kBucketCount = kSubBucketCount * (kMaxValueBits - kSubBucketBits + 1);
+
+			Histogram();
+			void Record(std::uint64_t value);
+			void Clear();
+			std::uint64_t GetTotalCount() const;
+			std::uint64_t GetMax() const;
+			std::uint64_t GetValueAtPercentile(std::float_t percentile) const;
+
+			static std::size_t GetBucketIndex(std::uint64_t value);
+			static std::uint64_t GetBucketUpperBound(std::size_t index);
+		private:
+
+			std::vector<std::uint64_t> _counts;
+			std::uint64_t _totalCount;
+			std::uint64_t _max;
+		};
+
+		FrameStatistics(const Settings& settings);
+		FrameStatistics(const FrameStatistics&) = delete;
+		FrameStatistics(FrameStatistics&&) noexcept = delete;
+		FrameStatistics& operator=(const FrameStatistics&) = delete;
+		FrameStatistics& operator=(FrameStatistics&&) noexcept = delete;
+		~FrameStatistics();
+
+		void Record(Metric metric, std::chrono::nanoseconds value);
+		void Clear();
+		Summary GetWindowSummary(Metric metric) const;
+		const Histogram& GetHistogram(Metric metric) const;
+
+		void WriteCsv(std::ostream& stream) const;
+		void WriteJson(std::ostream& stream) const;
+		bool Dump(const std::filesystem::path& path) const;
+
+		static std::string_view GetMetricName(Metric metric);
+	private:
+		struct Channel final
+		{
+			std::vector<std::chrono::nanoseconds> window;
+			std::size_t head = 0;
+			std::size_t size = 0;
+			Histogram histogram;
+		};
+
+		static constexpr auto kMetricCount = static_cast<std::size_t>(Metric::Count);
+
+		Settings _settings;
+		std::array<Channel, kMetricCount> _channels;
+	};
+}
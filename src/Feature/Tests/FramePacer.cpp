@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <Feature/FramePacer.hpp>
+
+namespace MMPEngine::Feature::Tests
+{
+	class FramePacerTests : public testing::Test
+	{
+	protected:
+		using Clock = FramePacer::Clock;
+
+		static constexpr std::chrono::nanoseconds kInterval = std::chrono::microseconds { 16'667 };
+		static constexpr std::chrono::nanoseconds kSpin = std::chrono::microseconds { 500 };
+
+		Clock::time_point _start = Clock::time_point {} + std::chrono::seconds { 100 };
+		FramePacer::Settings _settings {};
+	};
+
+	TEST_F(FramePacerTests, StartsScheduleWithoutWaiting)
+	{
+		const auto plan = FramePacer::PlanWait(_start, std::nullopt, kInterval, kSpin);
+
+		ASSERT_EQ(plan.nextDeadline, _start + kInterval);
+		ASSERT_FALSE(plan.sleepUntil.has_value());
+		ASSERT_FALSE(plan.spinUntil.has_value());
+	}
+
+	TEST_F(FramePacerTests, DisabledPacingKeepsDeadline)
+	{
+		const auto plan = FramePacer::PlanWait(_start, _start + kInterval, std::chrono::nanoseconds::zero(), kSpin);
+
+		ASSERT_EQ(plan.nextDeadline, _start + kInterval);
+		ASSERT_FALSE(plan.spinUntil.has_value());
+	}
+
+	TEST_F(FramePacerTests, SleepsThenSpinsToDeadline)
+	{
+		const auto deadline = _start + kInterval;
+		const auto plan = FramePacer::PlanWait(_start + std::chrono::milliseconds { 4 }, deadline, kInterval, kSpin);
+
+		ASSERT_EQ(plan.sleepUntil, deadline - kSpin);
+		ASSERT_EQ(plan.spinUntil, deadline);
+		ASSERT_EQ(plan.nextDeadline, deadline + kInterval);
+	}
+
+	TEST_F(FramePacerTests, OnlySpinsInsideSpinWindow)
+	{
+		const auto deadline = _start + kInterval;
+		const auto plan = FramePacer::PlanWait(deadline - kSpin / 2, deadline, kInterval, kSpin);
+
+		ASSERT_FALSE(plan.sleepUntil.has_value());
+		ASSERT_EQ(plan.spinUntil, deadline);
+		ASSERT_EQ(plan.nextDeadline, deadline + kInterval);
+	}
+
+	TEST_F(FramePacerTests, RestartsScheduleAfterMissedDeadline)
+	{
+		const auto deadline = _start + kInterval;
+		const auto now = deadline + std::chrono::milliseconds { 3 };
+		const auto plan = FramePacer::PlanWait(now, deadline, kInterval, kSpin);
+
+		ASSERT_FALSE(plan.spinUntil.has_value());
+		ASSERT_EQ(plan.nextDeadline, now + kInterval);
+	}
+
+	TEST_F(FramePacerTests, AlignsDeadlineToPresent)
+	{
+		ASSERT_EQ(FramePacer::AlignDeadline(_start, _start - std::chrono::milliseconds { 1 }, kInterval), _start - std::chrono::milliseconds { 1 } + kInterval);
+
+		const auto present = _start - kInterval * 3 - std::chrono::milliseconds { 1 };
+		const auto aligned = FramePacer::AlignDeadline(_start, present, kInterval);
+
+		ASSERT_GE(aligned, _start);
+		ASSERT_LT(aligned, _start + kInterval);
+		ASSERT_EQ((aligned - present) % kInterval, std::chrono::nanoseconds::zero());
+	}
+
+	TEST_F(FramePacerTests, CalibratesSpinThreshold)
+	{
+		ASSERT_EQ(FramePacer::CalibrateSpinThreshold(_settings, _settings.minSpin, std::chrono::nanoseconds { -50 }), _settings.minSpin);
+
+		const auto overshoot = std::chrono::microseconds { 700 };
+		ASSERT_EQ(FramePacer::CalibrateSpinThreshold(_settings, _settings.minSpin, overshoot), overshoot);
+
+		const auto decayed = FramePacer::CalibrateSpinThreshold(_settings, std::chrono::microseconds { 1'500 }, std::chrono::microseconds { 100 });
+		ASSERT_LT(decayed, std::chrono::microseconds { 1'500 });
+		ASSERT_GT(decayed, std::chrono::microseconds { 300 });
+
+		ASSERT_EQ(FramePacer::CalibrateSpinThreshold(_settings, _settings.minSpin, std::chrono::milliseconds { 10 }), _settings.maxSpin);
+	}
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include <Feature/FrameStatistics.hpp>
+
+namespace MMPEngine::Feature::Tests
+{
+	class FrameStatisticsTests : public testing::Test
+	{
+	protected:
+		using Histogram = FrameStatistics::Histogram;
+		using Metric = FrameStatistics::Metric;
+
+		static constexpr std::uint64_t kMaxValue = (std::uint64_t { 1 } << Histogram::kMaxValueBits) - 1;
+	};
+
+	TEST_F(FrameStatisticsTests, SmallValuesUseExactBuckets)
+	{
+		for (std::uint64_t value = 0; value < Histogram::kSubBucketCount; ++value)
+		{
+			const auto index = Histogram::GetBucketIndex(value);
+			ASSERT_EQ(index, static_cast<std::size_t>(value));
+			ASSERT_EQ(Histogram::GetBucketUpperBound(index), value);
+		}
+	}
+
+	TEST_F(FrameStatisticsTests, PowerOfTwoStartsNewBucketRow)
+	{
+		for (std::uint32_t bit = Histogram::kSubBucketBits; bit < Histogram::kMaxValueBits; ++bit)
+		{
+			const auto value = std::uint64_t { 1 } << bit;
+			const auto shift = bit - Histogram::kSubBucketBits;
+			const auto index = Histogram::GetBucketIndex(value);
+
+			ASSERT_EQ(index, static_cast<std::size_t>(Histogram::kSubBucketCount * (shift + 1)));
+			ASSERT_EQ(Histogram::GetBucketIndex(value - 1), index - 1);
+			ASSERT_EQ(Histogram::GetBucketUpperBound(index), ((std::uint64_t { Histogram::kSubBucketCount } + 1) << shift) - 1);
+			ASSERT_EQ(Histogram::GetBucketIndex(Histogram::GetBucketUpperBound(index)), index);
+			ASSERT_EQ(Histogram::GetBucketIndex(Histogram::GetBucketUpperBound(index) + 1), index + 1);
+		}
+	}
+
+	TEST_F(FrameStatisticsTests, LargestValueUsesLastBucket)
+	{
+		ASSERT_EQ(Histogram::GetBucketIndex(kMaxValue), static_cast<std::size_t>(Histogram::kBucketCount - 1));
+		ASSERT_EQ(Histogram::GetBucketUpperBound(Histogram::kBucketCount - 1), kMaxValue);
+	}
+
+	TEST_F(FrameStatisticsTests, HistogramClampsOutOfRangeValues)
+	{
+		Histogram histogram;
+		histogram.Record(kMaxValue + 1);
+		histogram.Record(std::numeric_limits<std::uint64_t>::max());
+
+		ASSERT_EQ(histogram.GetTotalCount(), 2);
+		ASSERT_EQ(histogram.GetMax(), kMaxValue);
+		ASSERT_EQ(histogram.GetValueAtPercentile(50.0f), kMaxValue);
+		ASSERT_EQ(histogram.GetValueAtPercentile(100.0f), kMaxValue);
+	}
+
+	TEST_F(FrameStatisticsTests, HistogramPercentiles)
+	{
+		Histogram histogram;
+		ASSERT_EQ(histogram.GetValueAtPercentile(50.0f), 0);
+
+		for (std::uint64_t value = 1; value <= 100; ++value)
+		{
+			histogram.Record(value);
+		}
+
+		ASSERT_EQ(histogram.GetTotalCount(), 100);
+		ASSERT_EQ(histogram.GetMax(), 100);
+		ASSERT_EQ(histogram.GetValueAtPercentile(0.0f), 1);
+		ASSERT_EQ(histogram.GetValueAtPercentile(10.0f), 10);
+		ASSERT_EQ(histogram.GetValueAtPercentile(50.0f), 50);
+		ASSERT_EQ(histogram.GetValueAtPercentile(95.0f), 95);
+		ASSERT_EQ(histogram.GetValueAtPercentile(99.0f), 99);
+		ASSERT_EQ(histogram.GetValueAtPercentile(100.0f), 100);
+
+		histogram.Clear();
+		ASSERT_EQ(histogram.GetTotalCount(), 0);
+		ASSERT_EQ(histogram.GetMax(), 0);
+	}
+
+	TEST_F(FrameStatisticsTests, WindowPercentiles)
+	{
+		FrameStatistics statistics { FrameStatistics::Settings { 100 } };
+
+		for (std::int64_t value = 100; value >= 1; --value)
+		{
+			statistics.Record(Metric::CpuRender, std::chrono::nanoseconds { value });
+		}
+
+		const auto summary = statistics.GetWindowSummary(Metric::CpuRender);
+		ASSERT_EQ(summary.count, 100);
+		ASSERT_EQ(summary.mean, std::chrono::nanoseconds { 50 });
+		ASSERT_EQ(summary.p50, std::chrono::nanoseconds { 50 });
+		ASSERT_EQ(summary.p95, std::chrono::nanoseconds { 95 });
+		ASSERT_EQ(summary.p99, std::chrono::nanoseconds { 99 });
+		ASSERT_EQ(summary.max, std::chrono::nanoseconds { 100 });
+		ASSERT_EQ(statistics.GetWindowSummary(Metric::StreamSubmit).count, 0);
+	}
+
+	TEST_F(FrameStatisticsTests, WindowKeepsLatestFrames)
+	{
+		FrameStatistics statistics { FrameStatistics::Settings { 4 } };
+
+		for (std::int64_t value = 1; value <= 10; ++value)
+		{
+			statistics.Record(Metric::FrameTime, std::chrono::nanoseconds { value * 10 });
+		}
+
+		const auto summary = statistics.GetWindowSummary(Metric::FrameTime);
+		ASSERT_EQ(summary.count, 4);
+		ASSERT_EQ(summary.mean, std::chrono::nanoseconds { 85 });
+		ASSERT_EQ(summary.p50, std::chrono::nanoseconds { 80 });
+		ASSERT_EQ(summary.max, std::chrono::nanoseconds { 100 });
+		ASSERT_EQ(statistics.GetHistogram(Metric::FrameTime).GetTotalCount(), 10);
+
+		statistics.Clear();
+		ASSERT_EQ(statistics.GetWindowSummary(Metric::FrameTime).count, 0);
+		ASSERT_EQ(statistics.GetHistogram(Metric::FrameTime).GetTotalCount(), 0);
+	}
+}
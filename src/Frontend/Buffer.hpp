@@ -1,6 +1,7 @@
 #pragma once
 #include <Core/Buffer.hpp>
 #include <Core/Context.hpp>
+#include <cassert>
 
 #ifdef MMPENGINE_BACKEND_DX12
 #include <Backend/Dx12/Buffer.hpp>
@@ -87,6 +88,11 @@ namespace MMPEngine::Frontend
 			std::size_t itemsCount = 0;
 			std::string name = {};
 		};
+		struct Range final
+		{
+			std::size_t first = 0;
+			std::size_t count = 0;
+		};
 	};
 
 	template<typename TStruct>
@@ -103,6 +109,10 @@ namespace MMPEngine::Frontend
 	public:
 		StructuredUploadBuffer(const std::shared_ptr<Core::GlobalContext>& globalContext, const BaseStructuredBuffer::Settings& settings);
 		std::shared_ptr<Core::ContextualTask<Core::UploadBuffer::WriteTaskContext>> CreateWriteStructTask(const TStruct& item, std::size_t index);
+		std::shared_ptr<Core::ContextualTask<Core::UploadBuffer::WriteTaskContext>> CreateWriteStructsTask(const TStruct* items, std::size_t count, std::size_t firstIndex, bool nonTemporal = false);
+		std::shared_ptr<Core::ContextualTask<Core::UploadBuffer::WriteTaskContext>> CreateWriteStridedStructsTask(const void* items, std::size_t itemsStride, std::size_t count, std::size_t firstIndex, bool nonTemporal = false);
+		std::shared_ptr<Core::ContextualTask<Core::UploadBuffer::WriteTaskContext>> CreateWriteDirtyStructsTask(const TStruct* items, const std::vector<BaseStructuredBuffer::Range>& dirtyRanges, bool nonTemporal = false);
+		std::shared_ptr<Core::BaseTask> CreateCopyDirtyStructsTask(const std::shared_ptr<Core::Buffer>& dst, const std::vector<BaseStructuredBuffer::Range>& dirtyRanges) const;
         std::optional<std::size_t> GetStride() const override;
 	};
 
@@ -293,6 +303,56 @@ namespace MMPEngine::Frontend
 		return this->CreateWriteTask(std::addressof(item), sizeof(TStruct), sizeof(TStruct) * index);
 	}
 
+	template<typename TStruct>
+	std::shared_ptr<Core::ContextualTask<Core::UploadBuffer::WriteTaskContext>> StructuredUploadBuffer<TStruct>::CreateWriteStructsTask(const TStruct* items, std::size_t count, std::size_t firstIndex, bool nonTemporal)
+	{
+		return this->CreateBatchWriteTask({ Core::UploadBuffer::WriteRegion { items, sizeof(TStruct) * count, sizeof(TStruct) * firstIndex } }, nonTemporal);
+	}
+
+	template<typename TStruct>
+	std::shared_ptr<Core::ContextualTask<Core::UploadBuffer::WriteTaskContext>> StructuredUploadBuffer<TStruct>::CreateWriteStridedStructsTask(const void* items, std::size_t itemsStride, std::size_t count, std::size_t firstIndex, bool nonTemporal)
+	{
+		assert(itemsStride >= sizeof(TStruct));
+
+		std::vector<Core::UploadBuffer::WriteRegion> regions;
+		regions.reserve(count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			regions.push_back({ static_cast<const char*>(items) + itemsStride * i, sizeof(TStruct), sizeof(TStruct) * (firstIndex + i) });
+		}
+
+		return this->CreateBatchWriteTask(std::move(regions), nonTemporal);
+	}
+
+	template<typename TStruct>
+	std::shared_ptr<Core::ContextualTask<Core::UploadBuffer::WriteTaskContext>> StructuredUploadBuffer<TStruct>::CreateWriteDirtyStructsTask(const TStruct* items, const std::vector<BaseStructuredBuffer::Range>& dirtyRanges, bool nonTemporal)
+	{
+		std::vector<Core::UploadBuffer::WriteRegion> regions;
+		regions.reserve(dirtyRanges.size());
+
+		for (const auto& range : dirtyRanges)
+		{
+			regions.push_back({ items + range.first, sizeof(TStruct) * range.count, sizeof(TStruct) * range.first });
+		}
+
+		return this->CreateBatchWriteTask(std::move(regions), nonTemporal);
+	}
+
+	template<typename TStruct>
+	std::shared_ptr<Core::BaseTask> StructuredUploadBuffer<TStruct>::CreateCopyDirtyStructsTask(const std::shared_ptr<Core::Buffer>& dst, const std::vector<BaseStructuredBuffer::Range>& dirtyRanges) const
+	{
+		std::vector<Core::Buffer::CopyRegion> regions;
+		regions.reserve(dirtyRanges.size());
+
+		for (const auto& range : dirtyRanges)
+		{
+			regions.push_back({ sizeof(TStruct) * range.count, sizeof(TStruct) * range.first, sizeof(TStruct) * range.first });
+		}
+
+		return this->CopyRegionsToBuffer(dst, std::move(regions));
+	}
+
 	template <typename TStruct>
 	StructuredReadBackBuffer<TStruct>::StructuredReadBackBuffer(const std::shared_ptr<Core::GlobalContext>& globalContext, const BaseStructuredBuffer::Settings& settings)
 		: ReadBackBuffer(globalContext, Core::Buffer::Settings{sizeof(TStruct)* settings.itemsCount, settings.name})
@@ -0,0 +1,225 @@
+#include <Frontend/ComputePrimitives.hpp>
+#include <Frontend/Buffer.hpp>
+#include <Frontend/Material.hpp>
+#include <Frontend/Compute.hpp>
+#include <unordered_map>
+#include <cassert>
+
+namespace MMPEngine::Frontend
+{
+	ComputePrimitive::ComputePrimitive(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack)
+		: _globalContext(globalContext), _shaderPack(shaderPack)
+	{
+		assert(_shaderPack);
+		_emptyBuffer = CreateWorkBuffer(1);
+	}
+
+	ComputePrimitive::~ComputePrimitive() = default;
+
+	ComputePrimitive::BufferPtr ComputePrimitive::CreateWorkBuffer(std::size_t elementsCount)
+	{
+		_workBuffers.push_back(std::make_shared<UnorderedAccessBuffer>(_globalContext, Core::BaseUnorderedAccessBuffer::Settings { sizeof(std::uint32_t), elementsCount, "compute_primitive_work" }));
+		return _workBuffers.back();
+	}
+
+	std::vector<ComputePrimitive::BufferPtr> ComputePrimitive::CreateScanBuffers(std::uint32_t count)
+	{
+		const auto levels = Core::ComputePrimitives::GetScanLevels(count);
+		std::vector<BufferPtr> scanBuffers;
+
+		for (std::size_t i = 1; i < levels.size(); ++i)
+		{
+			scanBuffers.push_back(CreateWorkBuffer(levels[i]));
+		}
+
+		return scanBuffers;
+	}
+
+	void ComputePrimitive::AddPass(Pass&& pass)
+	{
+		for (auto buffer : { &pass.input, &pass.inputPayload, &pass.output, &pass.outputPayload, &pass.auxiliary })
+		{
+			if (!*buffer)
+			{
+				*buffer = _emptyBuffer;
+			}
+		}
+
+		_passes.push_back({ std::move(pass), nullptr, nullptr, nullptr });
+	}
+
+	void ComputePrimitive::AddScanPasses(const BufferPtr& input, const BufferPtr& output, std::uint32_t count, bool inclusive, const std::vector<BufferPtr>& scanBuffers)
+	{
+		const auto levels = Core::ComputePrimitives::GetScanLevels(count);
+		assert(scanBuffers.size() + 1 == levels.size());
+
+		for (std::size_t i = 0; i < levels.size(); ++i)
+		{
+			const auto hasBlockSums = i + 1 < levels.size();
+
+			std::uint32_t flags = 0;
+			flags |= (i == 0 && inclusive) ? Data::kInclusive : 0;
+			flags |= hasBlockSums ? Data::kWriteBlockSums : 0;
+
+			AddPass({
+				Kernel::ScanBlocks,
+				Data { levels[i], 0, flags, 0 },
+				Core::ComputePrimitives::GetGroupsCount(levels[i]),
+				i == 0 ? input : scanBuffers[i - 1],
+				nullptr,
+				i == 0 ? output : scanBuffers[i - 1],
+				nullptr,
+				hasBlockSums ? scanBuffers[i] : nullptr
+			});
+		}
+
+		for (auto i = levels.size() - 1; i > 0; --i)
+		{
+			AddPass({
+				Kernel::AddBlockOffsets,
+				Data { levels[i - 1], 0, 0, 0 },
+				Core::ComputePrimitives::GetGroupsCount(levels[i - 1]),
+				nullptr,
+				nullptr,
+				i == 1 ? output : scanBuffers[i - 2],
+				nullptr,
+				scanBuffers[i - 1]
+			});
+		}
+	}
+
+	std::shared_ptr<Core::BaseTask> ComputePrimitive::CreateInitializationTask()
+	{
+		std::vector<std::shared_ptr<Core::BaseTask>> tasks;
+		std::unordered_map<Kernel, std::shared_ptr<Core::Shader>> shaders;
+
+		for (const auto& buffer : _workBuffers)
+		{
+			tasks.push_back(buffer->CreateInitializationTask());
+		}
+
+		for (auto& state : _passes)
+		{
+			auto& shader = shaders[state.pass.kernel];
+
+			if (!shader)
+			{
+				shader = _shaderPack->Unpack(Core::ComputePrimitives::GetShaderId(state.pass.kernel));
+				tasks.push_back(shader->CreateInitializationTask());
+			}
+
+			const auto& pass = state.pass;
+			state.dataBuffer = std::make_shared<UniformBuffer<Data>>(_globalContext, "compute_primitive_data");
+
+			Core::BaseMaterial::Parameters params {
+				std::vector {
+					Core::BaseMaterial::Parameters::Entry { "primitiveData", state.dataBuffer, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::Uniform } },
+					Core::BaseMaterial::Parameters::Entry { "primitiveInput", pass.input, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::UnorderedAccess } },
+					Core::BaseMaterial::Parameters::Entry { "primitiveInputPayload", pass.inputPayload, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::UnorderedAccess } },
+					Core::BaseMaterial::Parameters::Entry { "primitiveOutput", pass.output, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::UnorderedAccess } },
+					Core::BaseMaterial::Parameters::Entry { "primitiveOutputPayload", pass.outputPayload, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::UnorderedAccess } },
+					Core::BaseMaterial::Parameters::Entry { "primitiveAuxiliary", pass.auxiliary, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::UnorderedAccess } }
+				},
+				Core::BaseMaterial::Parameters::Bindings {}
+			};
+
+			state.material = std::make_shared<ComputeMaterial>(_globalContext, std::move(params), shader);
+			state.job = std::make_shared<DirectComputeJob>(_globalContext, state.material);
+
+			tasks.push_back(state.dataBuffer->CreateInitializationTask());
+			tasks.push_back(state.dataBuffer->CreateWriteAsyncTask(pass.data));
+			tasks.push_back(state.material->CreateInitializationTask());
+			tasks.push_back(state.job->CreateInitializationTask());
+		}
+
+		const auto primitive = shared_from_this();
+
+		tasks.push_back(std::make_shared<Core::FunctionalTask>(
+			Core::FunctionalTask::Handler {},
+			Core::FunctionalTask::Handler {},
+			[primitive](const auto&)
+			{
+				std::vector<std::shared_ptr<Core::BaseTask>> executionTasks;
+
+				for (const auto& state : primitive->_passes)
+				{
+					const auto dispatchTask = state.job->CreateExecutionTask();
+					dispatchTask->GetTaskContext()->groups = { state.pass.groupsCount, 1, 1 };
+					dispatchTask->GetTaskContext()->threadsPerGroup = { Core::ComputePrimitives::kGroupSize, 1, 1 };
+					executionTasks.push_back(dispatchTask);
+				}
+
+				primitive->_executionTask = std::make_shared<Core::StaticBatchTask>(std::move(executionTasks));
+			}
+		));
+
+		return std::make_shared<Core::StaticBatchTask>(std::move(tasks));
+	}
+
+	std::shared_ptr<Core::BaseTask> ComputePrimitive::CreateExecutionTask() const
+	{
+		assert(_executionTask);
+		return _executionTask;
+	}
+
+	PrefixScan::PrefixScan(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& input, const BufferPtr& output, std::uint32_t count, bool inclusive)
+		: ComputePrimitive(globalContext, shaderPack)
+	{
+		AddScanPasses(input, output, count, inclusive, CreateScanBuffers(count));
+	}
+
+	StreamCompaction::StreamCompaction(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& values, const BufferPtr& flags, const BufferPtr& output, std::uint32_t count)
+		: ComputePrimitive(globalContext, shaderPack)
+	{
+		const auto scannedFlags = CreateWorkBuffer(count);
+		_countBuffer = CreateWorkBuffer(1);
+
+		AddScanPasses(flags, scannedFlags, count, false, CreateScanBuffers(count));
+		AddPass({ Kernel::CompactScatter, Data { count, 0, 0, 0 }, Core::ComputePrimitives::GetGroupsCount(count), values, flags, output, _countBuffer, scannedFlags });
+	}
+
+	StreamCompaction::BufferPtr StreamCompaction::GetCountBuffer() const
+	{
+		return _countBuffer;
+	}
+
+	RadixSort::RadixSort(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& keys, const BufferPtr& payload, std::uint32_t count)
+		: ComputePrimitive(globalContext, shaderPack)
+	{
+		const auto groupsCount = Core::ComputePrimitives::GetGroupsCount(count);
+		const auto digitsCount = groupsCount * Core::ComputePrimitives::kRadixSize;
+		const auto digitOffsets = CreateWorkBuffer(digitsCount);
+		const auto scanBuffers = CreateScanBuffers(digitsCount);
+		const auto flags = payload ? Data::kPayload : 0u;
+
+		BufferPtr srcKeys = keys;
+		BufferPtr srcPayload = payload;
+		BufferPtr dstKeys = CreateWorkBuffer(count);
+		BufferPtr dstPayload = payload ? CreateWorkBuffer(count) : nullptr;
+
+		for (std::uint32_t shift = 0; shift < 32; shift += Core::ComputePrimitives::kRadixBits)
+		{
+			AddPass({ Kernel::RadixCount, Data { count, shift, 0, 0 }, groupsCount, srcKeys, nullptr, nullptr, nullptr, digitOffsets });
+			AddScanPasses(digitOffsets, digitOffsets, digitsCount, false, scanBuffers);
+			AddPass({ Kernel::RadixScatter, Data { count, shift, flags, 0 }, groupsCount, srcKeys, srcPayload, dstKeys, dstPayload, digitOffsets });
+
+			std::swap(srcKeys, dstKeys);
+			std::swap(srcPayload, dstPayload);
+		}
+	}
+
+	SegmentedReduction::SegmentedReduction(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& values, const BufferPtr& segmentOffsets, const BufferPtr& output, std::uint32_t segmentsCount)
+		: ComputePrimitive(globalContext, shaderPack)
+	{
+		assert(segmentsCount > 0);
+		AddPass({ Kernel::SegmentedReduce, Data { segmentsCount, 0, 0, 0 }, Core::ComputePrimitives::GetSegmentedReduceGroupsCount(segmentsCount), values, nullptr, output, nullptr, segmentOffsets });
+	}
+
+	Histogram::Histogram(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& values, const BufferPtr& bins, std::uint32_t count, std::uint32_t binsCount, std::uint32_t shift)
+		: ComputePrimitive(globalContext, shaderPack)
+	{
+		assert(binsCount > 0 && binsCount <= Core::ComputePrimitives::kGroupSize);
+		AddPass({ Kernel::Clear, Data { binsCount, 0, 0, 0 }, Core::ComputePrimitives::GetGroupsCount(binsCount), nullptr, nullptr, bins, nullptr, nullptr });
+		AddPass({ Kernel::Histogram, Data { count, shift, 0, binsCount }, Core::ComputePrimitives::GetGroupsCount(count), values, nullptr, bins, nullptr, nullptr });
+	}
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <Core/ComputePrimitives.hpp>
+#include <Core/Compute.hpp>
+#include <Core/Buffer.hpp>
+#include <Core/Shader.hpp>
+
+namespace MMPEngine::Frontend
+{
+	class ComputePrimitive : public Core::IInitializationTaskSource, public std::enable_shared_from_this<ComputePrimitive>
+	{
+	protected:
+		using Kernel = Core::ComputePrimitives::Kernel;
+		using Data = Core::ComputePrimitives::Data;
+		using BufferPtr = std::shared_ptr<Core::BaseUnorderedAccessBuffer>;
+
+		struct Pass final
+		{
+			Kernel kernel;
+			Data data;
+			std::uint32_t groupsCount;
+			BufferPtr input;
+			BufferPtr inputPayload;
+			BufferPtr output;
+			BufferPtr outputPayload;
+			BufferPtr auxiliary;
+		};
+	private:
+		struct PassState final
+		{
+			Pass pass;
+			std::shared_ptr<Core::UniformBuffer<Data>> dataBuffer;
+			std::shared_ptr<Core::ComputeMaterial> material;
+			std::shared_ptr<Core::DirectComputeJob> job;
+		};
+	protected:
+		ComputePrimitive(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack);
+	public:
+		ComputePrimitive(const ComputePrimitive&) = delete;
+		ComputePrimitive(ComputePrimitive&&) noexcept = delete;
+		ComputePrimitive& operator=(const ComputePrimitive&) = delete;
+		ComputePrimitive& operator=(ComputePrimitive&&) noexcept = delete;
+		~ComputePrimitive() override;
+
+		std::shared_ptr<Core::BaseTask> CreateInitializationTask() override;
+		std::shared_ptr<Core::BaseTask> CreateExecutionTask() const;
+	protected:
+		BufferPtr CreateWorkBuffer(std::size_t elementsCount);
+		std::vector<BufferPtr> CreateScanBuffers(std::uint32_t count);
+		void AddPass(Pass&& pass);
+		void AddScanPasses(const BufferPtr& input, const BufferPtr& output, std::uint32_t count, bool inclusive, const std::vector<BufferPtr>& scanBuffers);
+	private:
+		std::shared_ptr<Core::GlobalContext> _globalContext;
+		std::shared_ptr<Core::ShaderPack> _shaderPack;
+		BufferPtr _emptyBuffer;
+		std::vector<BufferPtr> _workBuffers;
+		std::vector<PassState> _passes;
+		std::shared_ptr<Core::BaseTask> _executionTask;
+	};
+
+	class PrefixScan final : public ComputePrimitive
+	{
+	public:
+		PrefixScan(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& input, const BufferPtr& output, std::uint32_t count, bool inclusive);
+	};
+
+	class StreamCompaction final : public ComputePrimitive
+	{
+	public:
+		StreamCompaction(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& values, const BufferPtr& flags, const BufferPtr& output, std::uint32_t count);
+		BufferPtr GetCountBuffer() const;
+	private:
+		BufferPtr _countBuffer;
+	};
+
+	class RadixSort final : public ComputePrimitive
+	{
+	public:
+		RadixSort(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& keys, const BufferPtr& payload, std::uint32_t count);
+	};
+
+	class SegmentedReduction final : public ComputePrimitive
+	{
+	public:
+		SegmentedReduction(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& values, const BufferPtr& segmentOffsets, const BufferPtr& output, std::uint32_t segmentsCount);
+	};
+
+	class Histogram final : public ComputePrimitive
+	{
+	public:
+		Histogram(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::ShaderPack>& shaderPack, const BufferPtr& values, const BufferPtr& bins, std::uint32_t count, std::uint32_t binsCount, std::uint32_t shift = 0);
+	};
+}
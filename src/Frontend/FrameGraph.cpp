@@ -0,0 +1,40 @@
+#include <Frontend/FrameGraph.hpp>
+
+#ifdef MMPENGINE_BACKEND_VULKAN
+#include <Backend/Vulkan/FrameGraph.hpp>
+#endif
+
+namespace MMPEngine::Frontend
+{
+	FrameGraphJob::FrameGraphJob(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::FrameGraph>& graph)
+		: Core::FrameGraphJob(graph)
+	{
+		if (globalContext->settings.backend == Core::BackendType::Vulkan)
+		{
+#ifdef MMPENGINE_BACKEND_VULKAN
+			_impl = std::make_shared<Backend::Vulkan::FrameGraphJob>(graph);
+#else
+			throw Core::UnsupportedException("unable to create frame graph job for Vulkan backend");
+#endif
+		}
+		else
+		{
+			throw Core::UnsupportedException("frame graph job is not supported by the current backend");
+		}
+	}
+
+	std::shared_ptr<Core::BaseTask> FrameGraphJob::CreateInitializationTask()
+	{
+		return _impl->CreateInitializationTask();
+	}
+
+	std::shared_ptr<Core::BaseTask> FrameGraphJob::CreateExecutionTask()
+	{
+		return _impl->CreateExecutionTask();
+	}
+
+	std::shared_ptr<Core::Buffer> FrameGraphJob::CreateTransientArena(std::size_t)
+	{
+		throw Core::UnsupportedException("transient arena is created by the backend frame graph job");
+	}
+}
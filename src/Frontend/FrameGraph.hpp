@@ -0,0 +1,17 @@
+#pragma once
+#include <Core/FrameGraph.hpp>
+
+namespace MMPEngine::Frontend
+{
+	class FrameGraphJob final : public Core::FrameGraphJob
+	{
+	public:
+		FrameGraphJob(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::FrameGraph>& graph);
+		std::shared_ptr<Core::BaseTask> CreateInitializationTask() override;
+		std::shared_ptr<Core::BaseTask> CreateExecutionTask() override;
+	protected:
+		std::shared_ptr<Core::Buffer> CreateTransientArena(std::size_t byteLength) override;
+	private:
+		std::shared_ptr<Core::FrameGraphJob> _impl;
+	};
+}
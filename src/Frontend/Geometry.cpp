@@ -1,10 +1,220 @@
 #include <Frontend/Geometry.hpp>
+#include <Core/ThreadPool.hpp>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
 
 namespace MMPEngine::Frontend
 {
+	namespace
+	{
+		template<typename TStream>
+		std::unique_ptr<TStream> CreateVertexStream(Core::VertexBufferPrototype::Semantics semantics, std::size_t capacity)
+		{
+			auto stream = std::make_unique<TStream>(Core::VertexBufferPrototype::Settings { { semantics }, {} });
+			stream->data.reserve(capacity);
+			return stream;
+		}
+	}
+
 	Core::GeometryPrototype Geometry::Generate(const aiMesh* aiMesh)
 	{
-		return {};
+		return Generate(std::vector<const struct aiMesh*> { aiMesh });
+	}
+
+	Core::GeometryPrototype Geometry::Generate(const aiScene* aiScene)
+	{
+		std::vector<const aiMesh*> meshes {};
+
+		for (std::uint32_t i = 0; i < aiScene->mNumMeshes; ++i)
+		{
+			if (aiScene->mMeshes[i]->mPrimitiveTypes & aiPrimitiveType_TRIANGLE)
+			{
+				meshes.push_back(aiScene->mMeshes[i]);
+			}
+		}
+
+		return Generate(meshes);
+	}
+
+	Core::GeometryPrototype Geometry::Generate(const std::vector<const aiMesh*>& aiMeshes)
+	{
+		Core::GeometryPrototype proto;
+
+		bool hasNormals = false;
+		bool hasTangents = false;
+		std::uint32_t uvChannels = 0;
+		std::uint32_t colorChannels = 0;
+		std::size_t vertexCount = 0;
+		std::size_t maxMeshVertexCount = 0;
+		std::size_t indexCount = 0;
+
+		for (const auto mesh : aiMeshes)
+		{
+			hasNormals |= mesh->HasNormals();
+			hasTangents |= mesh->HasTangentsAndBitangents();
+			uvChannels = std::max(uvChannels, mesh->GetNumUVChannels());
+			colorChannels = std::max(colorChannels, mesh->GetNumColorChannels());
+			vertexCount += mesh->mNumVertices;
+			maxMeshVertexCount = std::max<std::size_t>(maxMeshVertexCount, mesh->mNumVertices);
+			indexCount += static_cast<std::size_t>(mesh->mNumFaces) * 3;
+		}
+
+		using Semantics = Core::VertexBufferPrototype::Semantics;
+
+		auto positions = CreateVertexStream<Core::VertexBufferPrototypeFloat3>(Semantics::Position, vertexCount);
+		auto normals = hasNormals ? CreateVertexStream<Core::VertexBufferPrototypeFloat3>(Semantics::Normal, vertexCount) : nullptr;
+		auto tangents = hasTangents ? CreateVertexStream<Core::VertexBufferPrototypeFloat3>(Semantics::Tangent, vertexCount) : nullptr;
+		auto biNormals = hasTangents ? CreateVertexStream<Core::VertexBufferPrototypeFloat3>(Semantics::BiNormal, vertexCount) : nullptr;
+
+		std::vector<std::unique_ptr<Core::VertexBufferPrototypeFloat2>> uvs {};
+		std::vector<std::unique_ptr<Core::VertexBufferPrototypeFloat4>> colors {};
+
+		for (std::uint32_t c = 0; c < uvChannels; ++c)
+		{
+			uvs.push_back(CreateVertexStream<Core::VertexBufferPrototypeFloat2>(Semantics::UV, vertexCount));
+		}
+
+		for (std::uint32_t c = 0; c < colorChannels; ++c)
+		{
+			colors.push_back(CreateVertexStream<Core::VertexBufferPrototypeFloat4>(Semantics::Color, vertexCount));
+		}
+
+		std::vector<std::uint32_t> indices {};
+		indices.reserve(indexCount);
+
+		for (const auto mesh : aiMeshes)
+		{
+			Core::GeometryPrototype::Subset subset {};
+			subset.indexStart = static_cast<std::uint32_t>(indices.size());
+			subset.baseVertex = static_cast<std::uint32_t>(positions->data.size());
+
+			for (std::uint32_t v = 0; v < mesh->mNumVertices; ++v)
+			{
+				const auto& p = mesh->mVertices[v];
+				positions->data.push_back({ p.x, p.y, p.z });
+
+				if (normals)
+				{
+					const auto n = mesh->HasNormals() ? mesh->mNormals[v] : aiVector3D { 0.0f, 0.0f, 0.0f };
+					normals->data.push_back({ n.x, n.y, n.z });
+				}
+
+				if (hasTangents)
+				{
+					const auto t = mesh->HasTangentsAndBitangents() ? mesh->mTangents[v] : aiVector3D { 0.0f, 0.0f, 0.0f };
+					const auto b = mesh->HasTangentsAndBitangents() ? mesh->mBitangents[v] : aiVector3D { 0.0f, 0.0f, 0.0f };
+					tangents->data.push_back({ t.x, t.y, t.z });
+					biNormals->data.push_back({ b.x, b.y, b.z });
+				}
+
+				for (std::uint32_t c = 0; c < uvChannels; ++c)
+				{
+					const auto uv = mesh->HasTextureCoords(c) ? mesh->mTextureCoords[c][v] : aiVector3D { 0.0f, 0.0f, 0.0f };
+					uvs[c]->data.push_back({ uv.x, uv.y });
+				}
+
+				for (std::uint32_t c = 0; c < colorChannels; ++c)
+				{
+					const auto color = mesh->HasVertexColors(c) ? mesh->mColors[c][v] : aiColor4D { 1.0f, 1.0f, 1.0f, 1.0f };
+					colors[c]->data.push_back({ color.r, color.g, color.b, color.a });
+				}
+			}
+
+			for (std::uint32_t f = 0; f < mesh->mNumFaces; ++f)
+			{
+				const auto& face = mesh->mFaces[f];
+
+				if (face.mNumIndices == 3)
+				{
+					indices.insert(indices.end(), face.mIndices, face.mIndices + 3);
+				}
+			}
+
+			subset.indexCount = static_cast<std::uint32_t>(indices.size()) - subset.indexStart;
+			proto.subsets.push_back(subset);
+		}
+
+		proto.vertexBuffers.push_back(std::move(positions));
+
+		for (auto& stream : { &normals, &tangents, &biNormals })
+		{
+			if (*stream)
+			{
+				proto.vertexBuffers.push_back(std::move(*stream));
+			}
+		}
+
+		for (auto& uv : uvs)
+		{
+			proto.vertexBuffers.push_back(std::move(uv));
+		}
+
+		for (auto& color : colors)
+		{
+			proto.vertexBuffers.push_back(std::move(color));
+		}
+
+		if (maxMeshVertexCount <= static_cast<std::size_t>(std::numeric_limits<std::uint16_t>::max()) + 1)
+		{
+			auto indexBuffer = std::make_unique<Core::IndexBufferPrototype16>(Core::IndexBufferPrototype::Settings {});
+			indexBuffer->data.assign(indices.cbegin(), indices.cend());
+			proto.indexBuffer = std::move(indexBuffer);
+		}
+		else
+		{
+			auto indexBuffer = std::make_unique<Core::IndexBufferPrototype32>(Core::IndexBufferPrototype::Settings {});
+			indexBuffer->data = std::move(indices);
+			proto.indexBuffer = std::move(indexBuffer);
+		}
+
+		return proto;
+	}
+
+	Core::GeometryPrototype Geometry::Load(const std::filesystem::path& path, const ImportSettings& settings)
+	{
+		std::uint32_t flags = aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_SortByPType | aiProcess_ValidateDataStructure;
+
+		if (settings.generateNormals)
+		{
+			flags |= aiProcess_GenSmoothNormals;
+		}
+
+		if (settings.calculateTangents)
+		{
+			flags |= aiProcess_CalcTangentSpace;
+		}
+
+		if (settings.preTransformVertices)
+		{
+			flags |= aiProcess_PreTransformVertices;
+		}
+
+		if (settings.flipUVs)
+		{
+			flags |= aiProcess_FlipUVs;
+		}
+
+		Assimp::Importer importer {};
+		const auto scene = importer.ReadFile(path.string(), flags);
+
+		if (!scene || (scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE))
+		{
+			throw std::runtime_error(importer.GetErrorString());
+		}
+
+		return Generate(scene);
+	}
+
+	std::future<Core::GeometryPrototype> Geometry::LoadAsync(const std::filesystem::path& path, const ImportSettings& settings)
+	{
+		return Core::ThreadPool::GetShared().Submit([path, settings]()
+		{
+			return Load(path, settings);
+		});
 	}
 
 	template<>
@@ -1,8 +1,11 @@
 #pragma once
 #include <Core/Geometry.hpp>
 #include <filesystem>
+#include <future>
+#include <vector>
 
-class aiMesh;
+struct aiMesh;
+struct aiScene;
 
 namespace MMPEngine::Frontend
 {
@@ -14,10 +17,23 @@ namespace MMPEngine::Frontend
 			Box,
 			Quad
 		};
+		struct ImportSettings final
+		{
+			bool generateNormals = true;
+			bool calculateTangents = true;
+			bool preTransformVertices = true;
+			bool flipUVs = false;
+		};
+
 		static Core::GeometryPrototype Generate(const aiMesh* aiMesh);
+		static Core::GeometryPrototype Generate(const aiScene* aiScene);
+		static Core::GeometryPrototype Load(const std::filesystem::path& path, const ImportSettings& settings);
+		static std::future<Core::GeometryPrototype> LoadAsync(const std::filesystem::path& path, const ImportSettings& settings);
 
 		template<PrimitiveType TPrimitiveType>
 		static Core::GeometryPrototype Generate();
+	private:
+		static Core::GeometryPrototype Generate(const std::vector<const aiMesh*>& aiMeshes);
 	};
 }
 
@@ -0,0 +1,24 @@
+#include <Frontend/GeometryArena.hpp>
+#include <Frontend/Buffer.hpp>
+
+namespace MMPEngine::Frontend
+{
+	GeometryArena::GeometryArena(const std::shared_ptr<Core::GlobalContext>& globalContext, const Settings& settings) : Core::GeometryArena(settings), _globalContext(globalContext)
+	{
+	}
+
+	std::shared_ptr<Core::VertexBuffer> GeometryArena::CreateVertexBlockBuffer(std::size_t byteLength)
+	{
+		return std::make_shared<VertexBuffer>(_globalContext, Core::InputAssemblerBuffer::Settings { { nullptr }, { byteLength, "geometry_arena_vertices" } });
+	}
+
+	std::shared_ptr<Core::IndexBuffer> GeometryArena::CreateIndexBlockBuffer(std::size_t byteLength)
+	{
+		return std::make_shared<IndexBuffer>(_globalContext, Core::InputAssemblerBuffer::Settings { { nullptr }, { byteLength, "geometry_arena_indices" } });
+	}
+
+	std::shared_ptr<Core::UploadBuffer> GeometryArena::CreateUploadBuffer(std::size_t byteLength)
+	{
+		return std::make_shared<UploadBuffer>(_globalContext, Core::Buffer::Settings { byteLength, "geometry_arena_upload" });
+	}
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <Core/GeometryArena.hpp>
+#include <Core/Context.hpp>
+
+namespace MMPEngine::Frontend
+{
+	class GeometryArena final : public Core::GeometryArena
+	{
+	public:
+		GeometryArena(const std::shared_ptr<Core::GlobalContext>& globalContext, const Settings& settings);
+	protected:
+		std::shared_ptr<Core::VertexBuffer> CreateVertexBlockBuffer(std::size_t byteLength) override;
+		std::shared_ptr<Core::IndexBuffer> CreateIndexBlockBuffer(std::size_t byteLength) override;
+		std::shared_ptr<Core::UploadBuffer> CreateUploadBuffer(std::size_t byteLength) override;
+	private:
+		std::shared_ptr<Core::GlobalContext> _globalContext;
+	};
+}
@@ -14,26 +14,30 @@
 
 namespace MMPEngine::Frontend
 {
-	Mesh::Mesh(const std::shared_ptr<Core::GlobalContext>& globalContext, Core::GeometryPrototype&& proto) : Core::Mesh(Core::GeometryPrototype {})
+	Mesh::Mesh(const std::shared_ptr<Core::GlobalContext>& globalContext, Core::GeometryPrototype&& proto) : Mesh(globalContext, std::move(proto), Settings {})
+	{
+	}
+
+	Mesh::Mesh(const std::shared_ptr<Core::GlobalContext>& globalContext, Core::GeometryPrototype&& proto, const Settings& settings) : Core::Mesh(Core::GeometryPrototype {}, settings)
 	{
 		if (globalContext->settings.backend == Core::BackendType::Dx12)
 		{
 #ifdef MMPENGINE_BACKEND_DX12
-			_impl = std::make_shared<Backend::Dx12::Mesh>(std::move(proto));
+			_impl = std::make_shared<Backend::Dx12::Mesh>(std::move(proto), settings);
 #else
 			throw Core::UnsupportedException("unable to create mesh for DX12 backend");
 #endif
 		} else if (globalContext->settings.backend == Core::BackendType::Vulkan)
 		{
 #ifdef MMPENGINE_BACKEND_VULKAN
-			_impl = std::make_shared<Backend::Vulkan::Mesh>(std::move(proto));
+			_impl = std::make_shared<Backend::Vulkan::Mesh>(std::move(proto), settings);
 #else
 			throw Core::UnsupportedException("unable to create mesh for Vulkan backend");
 #endif
 		} else if (globalContext->settings.backend == Core::BackendType::Metal)
         {
 #ifdef MMPENGINE_BACKEND_METAL
-            _impl = std::make_shared<Backend::Metal::Mesh>(std::move(proto));
+            _impl = std::make_shared<Backend::Metal::Mesh>(std::move(proto), settings);
 #else
             throw Core::UnsupportedException("unable to create mesh for Metal backend");
 #endif
@@ -65,6 +69,16 @@ namespace MMPEngine::Frontend
 		return _impl->GetSubsets();
 	}
 
+	std::uint32_t Mesh::GetBaseVertex() const
+	{
+		return _impl->GetBaseVertex();
+	}
+
+	std::uint32_t Mesh::GetIndexStart() const
+	{
+		return _impl->GetIndexStart();
+	}
+
 	const Mesh::VertexBufferInfo& Mesh::GetVertexBufferInfo(const Core::GeometryPrototype::VertexAttribute& attribute) const
 	{
 		return _impl->GetVertexBufferInfo(attribute);
@@ -80,7 +94,7 @@ namespace MMPEngine::Frontend
 		throw std::logic_error("impossible exception");
 	}
 
-	std::shared_ptr<Core::VertexBuffer> Mesh::CreateVertexBuffer(const Core::VertexBufferPrototype* vbPrototype)
+	std::shared_ptr<Core::VertexBuffer> Mesh::CreateVertexBuffer(const Core::BaseGeometryBufferPrototype* vbPrototype)
 	{
 		throw std::logic_error("impossible exception");
 	}
@@ -136,6 +150,11 @@ namespace MMPEngine::Frontend
 		throw std::logic_error("impossible exception");
 	}
 
+	std::shared_ptr<Core::UniformBuffer<Mesh::Renderer::AffineData>> Mesh::Renderer::CreateAffineUniformBuffer()
+	{
+		throw std::logic_error("impossible exception");
+	}
+
 	std::shared_ptr<Core::BaseTask> Mesh::Renderer::CreateInternalInitializationTask()
 	{
 		throw std::logic_error("impossible exception");
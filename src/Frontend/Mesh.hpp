@@ -7,6 +7,7 @@ namespace MMPEngine::Frontend
 	{
 	public:
 		Mesh(const std::shared_ptr<Core::GlobalContext>& globalContext, Core::GeometryPrototype&& proto);
+		Mesh(const std::shared_ptr<Core::GlobalContext>& globalContext, Core::GeometryPrototype&& proto, const Settings& settings);
 		std::shared_ptr<Core::BaseTask> CreateInitializationTask() override;
 		std::shared_ptr<const Core::Mesh> GetUnderlyingMesh() const override;
 
@@ -15,6 +16,8 @@ namespace MMPEngine::Frontend
 		const IndexBufferInfo& GetIndexBufferInfo() const override;
 		const std::vector<Core::GeometryPrototype::Subset>& GetSubsets() const override;
 		Core::GeometryPrototype::Topology GetTopology() const override;
+		std::uint32_t GetBaseVertex() const override;
+		std::uint32_t GetIndexStart() const override;
 
 		class Renderer final : public Core::Mesh::Renderer
 		{
@@ -27,6 +30,7 @@ namespace MMPEngine::Frontend
 			Settings::Dynamic& GetDynamicSettings() override;
 		protected:
 			std::shared_ptr<Core::UniformBuffer<Data>> CreateUniformBuffer() override;
+			std::shared_ptr<Core::UniformBuffer<AffineData>> CreateAffineUniformBuffer() override;
 			std::shared_ptr<Core::BaseTask> CreateInternalInitializationTask() override;
 		private:
 			std::shared_ptr<Core::Mesh::Renderer> _impl;
@@ -34,7 +38,7 @@ namespace MMPEngine::Frontend
 
 	protected:
 		std::shared_ptr<Core::BaseTask> CreateInternalInitializationTask() override;
-		std::shared_ptr<Core::VertexBuffer> CreateVertexBuffer(const Core::VertexBufferPrototype* vbPrototype) override;
+		std::shared_ptr<Core::VertexBuffer> CreateVertexBuffer(const Core::BaseGeometryBufferPrototype* vbPrototype) override;
 		std::shared_ptr<Core::IndexBuffer> CreateIndexBuffer(const Core::IndexBufferPrototype* ibPrototype) override;
 	private:
 		std::shared_ptr<Core::Mesh> _impl;
@@ -0,0 +1,125 @@
+#include <Frontend/Meshlet.hpp>
+#include <Frontend/Buffer.hpp>
+#include <Frontend/Material.hpp>
+#include <Frontend/Compute.hpp>
+#include <cassert>
+
+namespace MMPEngine::Frontend
+{
+	MeshletCuller::MeshletCuller(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::Mesh>& mesh, std::vector<Core::MeshletGeometry::Meshlet>&& meshlets, const std::shared_ptr<Core::Shader>& computeShader)
+		: _globalContext(globalContext), _mesh(mesh), _computeShader(computeShader), _meshlets(std::move(meshlets)), _initialArguments(kArgumentsCount, 0)
+	{
+		if (globalContext->settings.backend != Core::BackendType::Vulkan)
+		{
+			throw Core::UnsupportedException("meshlet culling is supported only by Vulkan backend");
+		}
+
+		assert(!_meshlets.empty());
+
+		std::size_t maxIndicesCount = 0;
+
+		for (const auto& meshlet : _meshlets)
+		{
+			maxIndicesCount += meshlet.indexCount;
+		}
+
+		_meshletsUploadBuffer = std::make_shared<StructuredUploadBuffer<Core::MeshletGeometry::Meshlet>>(globalContext, BaseStructuredBuffer::Settings { _meshlets.size(), "meshlets_upload" });
+		_meshletsBuffer = std::make_shared<StructuredResidentBuffer<Core::MeshletGeometry::Meshlet>>(globalContext, BaseStructuredBuffer::Settings { _meshlets.size(), "meshlets" });
+		_argumentsUploadBuffer = std::make_shared<UploadBuffer>(globalContext, Core::Buffer::Settings { sizeof(std::uint32_t) * kArgumentsCount, "meshlet_draw_arguments_upload" });
+		_argumentsBuffer = std::make_shared<UnorderedAccessBuffer>(globalContext, Core::BaseUnorderedAccessBuffer::Settings { sizeof(std::uint32_t), kArgumentsCount, "meshlet_draw_arguments" });
+		_compactedIndicesBuffer = std::make_shared<UnorderedAccessBuffer>(globalContext, Core::BaseUnorderedAccessBuffer::Settings { sizeof(std::uint32_t), maxIndicesCount, "meshlet_compacted_indices" });
+		_cullingDataBuffer = std::make_shared<UniformBuffer<Core::MeshletGeometry::CullingData>>(globalContext, "meshlet_culling_data");
+	}
+
+	std::shared_ptr<Core::BaseTask> MeshletCuller::CreateInitializationTask()
+	{
+		const auto culler = shared_from_this();
+
+		return std::make_shared<Core::StaticBatchTask>(std::initializer_list<std::shared_ptr<Core::BaseTask>>{
+			_meshletsUploadBuffer->CreateInitializationTask(),
+			_meshletsBuffer->CreateInitializationTask(),
+			_argumentsUploadBuffer->CreateInitializationTask(),
+			_argumentsBuffer->CreateInitializationTask(),
+			_compactedIndicesBuffer->CreateInitializationTask(),
+			_cullingDataBuffer->CreateInitializationTask(),
+			std::make_shared<Core::FunctionalTask>(
+				[culler](const auto& stream)
+				{
+					stream->Schedule(culler->_meshletsUploadBuffer->CreateWriteTask(culler->_meshlets.data(), culler->_meshlets.size() * sizeof(Core::MeshletGeometry::Meshlet)));
+					stream->Schedule(culler->_argumentsUploadBuffer->CreateWriteTask(culler->_initialArguments.data(), culler->_initialArguments.size() * sizeof(std::uint32_t)));
+					stream->Schedule(culler->_meshletsUploadBuffer->CopyToBuffer(culler->_meshletsBuffer));
+					stream->Schedule(culler->_argumentsUploadBuffer->CopyToBuffer(culler->_argumentsBuffer));
+
+					const auto& ibInfo = culler->_mesh->GetIndexBufferInfo();
+					assert(ibInfo.ptr);
+
+					Core::BaseMaterial::Parameters params {
+						std::vector {
+							Core::BaseMaterial::Parameters::Entry { "cullingData", culler->_cullingDataBuffer, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::Uniform } },
+							Core::BaseMaterial::Parameters::Entry { "meshlets", culler->_meshletsBuffer, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::ReadonlyAccess } },
+							Core::BaseMaterial::Parameters::Entry { "sourceIndices", ibInfo.ptr, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::ReadonlyAccess } },
+							Core::BaseMaterial::Parameters::Entry { "compactedIndices", culler->_compactedIndicesBuffer, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::UnorderedAccess } },
+							Core::BaseMaterial::Parameters::Entry { "drawArguments", culler->_argumentsBuffer, Core::BaseMaterial::Parameters::Buffer { Core::BaseMaterial::Parameters::Buffer::Type::UnorderedAccess } }
+						},
+						Core::BaseMaterial::Parameters::Bindings {}
+					};
+
+					culler->_material = std::make_shared<ComputeMaterial>(culler->_globalContext, std::move(params), culler->_computeShader);
+					culler->_job = std::make_shared<DirectComputeJob>(culler->_globalContext, culler->_material);
+
+					stream->Schedule(culler->_material->CreateInitializationTask());
+					stream->Schedule(culler->_job->CreateInitializationTask());
+				},
+				Core::FunctionalTask::Handler {},
+				[culler](const auto&)
+				{
+					culler->_cullingDataWriteTask = culler->_cullingDataBuffer->CreateWriteAsyncTask({});
+					culler->_dispatchTask = culler->_job->CreateExecutionTask();
+					culler->_dispatchTask->GetTaskContext()->groups = { (culler->GetMeshletsCount() + kThreadsPerGroup - 1) / kThreadsPerGroup, 1, 1 };
+					culler->_dispatchTask->GetTaskContext()->threadsPerGroup = { kThreadsPerGroup, 1, 1 };
+
+					culler->_meshletsUploadBuffer.reset();
+					culler->_argumentsUploadBuffer.reset();
+				}
+			)
+		});
+	}
+
+	std::shared_ptr<Core::ContextualTask<MeshletCuller::CullTaskContext>> MeshletCuller::CreateCullTask()
+	{
+		const auto ctx = std::make_shared<InternalCullTaskContext>();
+		ctx->culler = shared_from_this();
+		ctx->data.meshletCount = GetMeshletsCount();
+		ctx->data.instanceCount = 1;
+		ctx->data.indexFormat = static_cast<std::uint32_t>(_mesh->GetIndexBufferInfo().format);
+		ctx->data.flags = Core::MeshletGeometry::CullingData::kFrustum | Core::MeshletGeometry::CullingData::kCone;
+		return std::make_shared<CullTask>(ctx);
+	}
+
+	Core::Mesh::Renderer::Settings::Indirect MeshletCuller::GetIndirectSettings() const
+	{
+		return { _compactedIndicesBuffer, _argumentsBuffer };
+	}
+
+	std::uint32_t MeshletCuller::GetMeshletsCount() const
+	{
+		return static_cast<std::uint32_t>(_meshlets.size());
+	}
+
+	MeshletCuller::CullTask::CullTask(const std::shared_ptr<InternalCullTaskContext>& ctx) : ContextualTask(ctx), _internalContext(ctx)
+	{
+	}
+
+	void MeshletCuller::CullTask::OnScheduled(const std::shared_ptr<Core::BaseStream>& stream)
+	{
+		ContextualTask::OnScheduled(stream);
+
+		const auto culler = _internalContext->culler;
+		assert(culler->_cullingDataWriteTask);
+		assert(culler->_dispatchTask);
+
+		culler->_cullingDataWriteTask->GetTaskContext()->data = _internalContext->data;
+		stream->Schedule(culler->_cullingDataWriteTask);
+		stream->Schedule(culler->_dispatchTask);
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <Core/Meshlet.hpp>
+#include <Core/Mesh.hpp>
+#include <Core/Compute.hpp>
+#include <Core/Shader.hpp>
+
+namespace MMPEngine::Frontend
+{
+	class MeshletCuller final : public Core::IInitializationTaskSource, public std::enable_shared_from_this<MeshletCuller>
+	{
+	public:
+		static constexpr std::uint32_t kThreadsPerGroup = 64;
+		static constexpr std::uint32_t kArgumentsCount = 8;
+
+		class CullTaskContext : public Core::TaskContext
+		{
+		public:
+			Core::MeshletGeometry::CullingData data {};
+		};
+	private:
+		class InternalCullTaskContext final : public CullTaskContext
+		{
+		public:
+			std::shared_ptr<MeshletCuller> culler;
+		};
+
+		class CullTask final : public Core::ContextualTask<CullTaskContext>
+		{
+		public:
+			CullTask(const std::shared_ptr<InternalCullTaskContext>& ctx);
+			void OnScheduled(const std::shared_ptr<Core::BaseStream>& stream) override;
+		private:
+			std::shared_ptr<InternalCullTaskContext> _internalContext;
+		};
+	public:
+		MeshletCuller(const std::shared_ptr<Core::GlobalContext>& globalContext, const std::shared_ptr<Core::Mesh>& mesh, std::vector<Core::MeshletGeometry::Meshlet>&& meshlets, const std::shared_ptr<Core::Shader>& computeShader);
+		std::shared_ptr<Core::BaseTask> CreateInitializationTask() override;
+		std::shared_ptr<Core::ContextualTask<CullTaskContext>> CreateCullTask();
+		Core::Mesh::Renderer::Settings::Indirect GetIndirectSettings() const;
+		std::uint32_t GetMeshletsCount() const;
+	private:
+		std::shared_ptr<Core::GlobalContext> _globalContext;
+		std::shared_ptr<Core::Mesh> _mesh;
+		std::shared_ptr<Core::Shader> _computeShader;
+		std::vector<Core::MeshletGeometry::Meshlet> _meshlets;
+		std::vector<std::uint32_t> _initialArguments;
+
+		std::shared_ptr<Core::UploadBuffer> _meshletsUploadBuffer;
+		std::shared_ptr<Core::UploadBuffer> _argumentsUploadBuffer;
+		std::shared_ptr<Core::ResidentBuffer> _meshletsBuffer;
+		std::shared_ptr<Core::BaseUnorderedAccessBuffer> _compactedIndicesBuffer;
+		std::shared_ptr<Core::BaseUnorderedAccessBuffer> _argumentsBuffer;
+		std::shared_ptr<Core::UniformBuffer<Core::MeshletGeometry::CullingData>> _cullingDataBuffer;
+
+		std::shared_ptr<Core::ComputeMaterial> _material;
+		std::shared_ptr<Core::DirectComputeJob> _job;
+		std::shared_ptr<Core::ContextualTask<Core::UniformBuffer<Core::MeshletGeometry::CullingData>::WriteTaskContext>> _cullingDataWriteTask;
+		std::shared_ptr<Core::ContextualTask<Core::DirectComputeContext>> _dispatchTask;
+	};
+}
@@ -0,0 +1,14 @@
+#include <Frontend/ReadBackQueue.hpp>
+#include <Frontend/Buffer.hpp>
+
+namespace MMPEngine::Frontend
+{
+	ReadBackQueue::ReadBackQueue(const std::shared_ptr<Core::GlobalContext>& globalContext, const Settings& settings) : Core::ReadBackQueue(settings), _globalContext(globalContext)
+	{
+	}
+
+	std::shared_ptr<Core::ReadBackBuffer> ReadBackQueue::CreateReadBackBuffer(std::size_t byteLength)
+	{
+		return std::make_shared<ReadBackBuffer>(_globalContext, Core::Buffer::Settings { byteLength, GetSettings().name.empty() ? "read_back_queue" : GetSettings().name });
+	}
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <Core/ReadBackQueue.hpp>
+#include <Core/Context.hpp>
+
+namespace MMPEngine::Frontend
+{
+	class ReadBackQueue final : public Core::ReadBackQueue
+	{
+	public:
+		ReadBackQueue(const std::shared_ptr<Core::GlobalContext>& globalContext, const Settings& settings);
+	protected:
+		std::shared_ptr<Core::ReadBackBuffer> CreateReadBackBuffer(std::size_t byteLength) override;
+	private:
+		std::shared_ptr<Core::GlobalContext> _globalContext;
+	};
+}
@@ -16,6 +16,58 @@ struct MeshRendererData
 	float4x4 worldMatIT;
 };
 
+struct MeshRendererAffineData
+{
+	float4 worldMat[3];
+	float4 worldMatIT[3];
+};
+
+float3 MMPEngineAffineTransformPoint(MeshRendererAffineData data, float3 p)
+{
+	const float4 v = float4(p, 1.0f);
+	return float3(dot(data.worldMat[0], v), dot(data.worldMat[1], v), dot(data.worldMat[2], v));
+}
+
+float3 MMPEngineAffineTransformNormal(MeshRendererAffineData data, float3 n)
+{
+	const float4 v = float4(n, 0.0f);
+	return float3(dot(data.worldMatIT[0], v), dot(data.worldMatIT[1], v), dot(data.worldMatIT[2], v));
+}
+
+struct MeshletData
+{
+	float3 center;
+	float radius;
+	float3 coneAxis;
+	float coneCutoff;
+	uint vertexOffset;
+	uint vertexCount;
+	uint triangleOffset;
+	uint triangleCount;
+	uint indexStart;
+	uint indexCount;
+	uint baseVertex;
+	uint reserved;
+};
+
+struct MeshletCullingData
+{
+	float4 frustumPlanes[6];
+	float4 cameraPosition;
+	uint meshletCount;
+	uint instanceCount;
+	uint indexFormat;
+	uint flags;
+};
+
+struct ComputePrimitiveData
+{
+	uint count;
+	uint shift;
+	uint flags;
+	uint binsCount;
+};
+
 #endif
 
 
@@ -34,6 +86,58 @@ struct MeshRendererData
 	mat4 worldMatIT;
 };
 
+struct MeshRendererAffineData
+{
+	vec4 worldMat[3];
+	vec4 worldMatIT[3];
+};
+
+vec3 MMPEngineAffineTransformPoint(MeshRendererAffineData data, vec3 p)
+{
+	const vec4 v = vec4(p, 1.0f);
+	return vec3(dot(data.worldMat[0], v), dot(data.worldMat[1], v), dot(data.worldMat[2], v));
+}
+
+vec3 MMPEngineAffineTransformNormal(MeshRendererAffineData data, vec3 n)
+{
+	const vec4 v = vec4(n, 0.0f);
+	return vec3(dot(data.worldMatIT[0], v), dot(data.worldMatIT[1], v), dot(data.worldMatIT[2], v));
+}
+
+struct MeshletData
+{
+	vec3 center;
+	float radius;
+	vec3 coneAxis;
+	float coneCutoff;
+	uint vertexOffset;
+	uint vertexCount;
+	uint triangleOffset;
+	uint triangleCount;
+	uint indexStart;
+	uint indexCount;
+	uint baseVertex;
+	uint reserved;
+};
+
+struct MeshletCullingData
+{
+	vec4 frustumPlanes[6];
+	vec4 cameraPosition;
+	uint meshletCount;
+	uint instanceCount;
+	uint indexFormat;
+	uint flags;
+};
+
+struct ComputePrimitiveData
+{
+	uint count;
+	uint shift;
+	uint flags;
+	uint binsCount;
+};
+
 #endif
 
 #if MMPENGINE_MSL
@@ -51,6 +155,58 @@ struct MeshRendererData
     float4x4 worldMatIT;
 };
 
+struct MeshRendererAffineData
+{
+    float4 worldMat[3];
+    float4 worldMatIT[3];
+};
+
+float3 MMPEngineAffineTransformPoint(constant MeshRendererAffineData& data, float3 p)
+{
+    const float4 v = float4(p, 1.0f);
+    return float3(dot(data.worldMat[0], v), dot(data.worldMat[1], v), dot(data.worldMat[2], v));
+}
+
+float3 MMPEngineAffineTransformNormal(constant MeshRendererAffineData& data, float3 n)
+{
+    const float4 v = float4(n, 0.0f);
+    return float3(dot(data.worldMatIT[0], v), dot(data.worldMatIT[1], v), dot(data.worldMatIT[2], v));
+}
+
+struct MeshletData
+{
+    packed_float3 center;
+    float radius;
+    packed_float3 coneAxis;
+    float coneCutoff;
+    uint vertexOffset;
+    uint vertexCount;
+    uint triangleOffset;
+    uint triangleCount;
+    uint indexStart;
+    uint indexCount;
+    uint baseVertex;
+    uint reserved;
+};
+
+struct MeshletCullingData
+{
+    float4 frustumPlanes[6];
+    float4 cameraPosition;
+    uint meshletCount;
+    uint instanceCount;
+    uint indexFormat;
+    uint flags;
+};
+
+struct ComputePrimitiveData
+{
+    uint count;
+    uint shift;
+    uint flags;
+    uint binsCount;
+};
+
 #endif
 
 #endif
@@ -0,0 +1,87 @@
+#include <array>
+#include <memory>
+#include <gtest/gtest.h>
+#include <Frontend/Geometry.hpp>
+#include <assimp/scene.h>
+
+namespace MMPEngine::Frontend::Tests
+{
+	class GeometryTests : public testing::Test
+	{
+	protected:
+		static aiMesh* CreateMesh(std::uint32_t verticesCount, const std::vector<std::array<std::uint32_t, 3>>& triangles)
+		{
+			const auto mesh = new aiMesh();
+			mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+			mesh->mNumVertices = verticesCount;
+			mesh->mVertices = new aiVector3D[verticesCount];
+
+			for (std::uint32_t i = 0; i < verticesCount; ++i)
+			{
+				mesh->mVertices[i] = aiVector3D { static_cast<float>(i), 0.0f, 0.0f };
+			}
+
+			mesh->mNumFaces = static_cast<std::uint32_t>(triangles.size());
+			mesh->mFaces = new aiFace[triangles.size()];
+
+			for (std::size_t i = 0; i < triangles.size(); ++i)
+			{
+				auto& face = mesh->mFaces[i];
+				face.mNumIndices = 3;
+				face.mIndices = new std::uint32_t[3] { triangles[i][0], triangles[i][1], triangles[i][2] };
+			}
+
+			return mesh;
+		}
+	};
+
+	TEST_F(GeometryTests, ConvertsMeshesIntoSubsets)
+	{
+		aiScene scene {};
+		scene.mNumMeshes = 2;
+		scene.mMeshes = new aiMesh* [2] {
+			CreateMesh(4, { { 0, 1, 2 }, { 2, 1, 3 } }),
+			CreateMesh(3, { { 2, 1, 0 } })
+		};
+
+		const auto proto = Geometry::Generate(&scene);
+
+		ASSERT_EQ(proto.subsets.size(), 2);
+		ASSERT_EQ(proto.subsets[0].indexStart, 0);
+		ASSERT_EQ(proto.subsets[0].indexCount, 6);
+		ASSERT_EQ(proto.subsets[0].baseVertex, 0);
+		ASSERT_EQ(proto.subsets[1].indexStart, 6);
+		ASSERT_EQ(proto.subsets[1].indexCount, 3);
+		ASSERT_EQ(proto.subsets[1].baseVertex, 4);
+
+		ASSERT_EQ(proto.vertexBuffers.size(), 1);
+		ASSERT_EQ(proto.vertexBuffers.front()->GetElementsCount(), 7);
+
+		const auto indexBuffer = dynamic_cast<const Core::IndexBufferPrototype16*>(proto.indexBuffer.get());
+		ASSERT_NE(indexBuffer, nullptr);
+		ASSERT_EQ(indexBuffer->data, (std::vector<std::uint16_t> { 0, 1, 2, 2, 1, 3, 2, 1, 0 }));
+	}
+
+	TEST_F(GeometryTests, ChoosesIndexWidthFromLargestMesh)
+	{
+		constexpr std::uint32_t maxShortVerticesCount = 65536;
+
+		{
+			const std::unique_ptr<aiMesh> mesh { CreateMesh(maxShortVerticesCount, { { 0, 1, maxShortVerticesCount - 1 } }) };
+			const auto proto = Geometry::Generate(mesh.get());
+			const auto indexBuffer = dynamic_cast<const Core::IndexBufferPrototype16*>(proto.indexBuffer.get());
+
+			ASSERT_NE(indexBuffer, nullptr);
+			ASSERT_EQ(indexBuffer->data, (std::vector<std::uint16_t> { 0, 1, 65535 }));
+		}
+
+		{
+			const std::unique_ptr<aiMesh> mesh { CreateMesh(maxShortVerticesCount + 1, { { 0, 1, maxShortVerticesCount } }) };
+			const auto proto = Geometry::Generate(mesh.get());
+			const auto indexBuffer = dynamic_cast<const Core::IndexBufferPrototype32*>(proto.indexBuffer.get());
+
+			ASSERT_NE(indexBuffer, nullptr);
+			ASSERT_EQ(indexBuffer->data, (std::vector<std::uint32_t> { 0, 1, maxShortVerticesCount }));
+		}
+	}
+}